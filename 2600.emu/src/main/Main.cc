@@ -175,21 +175,6 @@ FS::PathString EmuSystem::sprintStateFilename(int slot, const char *savePath, co
 	return FS::makePathStringPrintf("%s/%s.0%c.sta", savePath, gameName, saveSlotChar(slot));
 }
 
-void EmuSystem::saveAutoState()
-{
-	if(gameIsRunning() && optionAutoSaveState)
-	{
-		auto saveStr = sprintStateFilename(-1);
-		logMsg("saving autosave-state %s", saveStr.data());
-		fixFilePermissions(saveStr);
-		Serializer state(string(saveStr.data()), 0);
-		if(!stateManager.saveState(state))
-		{
-			logMsg("failed");
-		}
-	}
-}
-
 void EmuSystem::saveBackupMem() { }
 
 void EmuSystem::closeSystem()
@@ -439,25 +424,21 @@ void EmuSystem::reset(ResetMode mode)
 	}
 }
 
-std::error_code EmuSystem::saveState()
+std::error_code EmuSystem::saveStateToBuffer(std::vector<uint8_t> &buff)
 {
-	auto saveStr = sprintStateFilename(saveStateSlot);
-	logMsg("saving state %s", saveStr.data());
-	fixFilePermissions(saveStr);
-	Serializer state(string(saveStr.data()), 0);
+	Serializer state;
 	if(!stateManager.saveState(state))
 	{
 		return {EIO, std::system_category()};
 	}
+	state.getData(buff);
 	return {};
 }
 
-std::system_error EmuSystem::loadState(int saveStateSlot)
+std::system_error EmuSystem::loadStateFromBuffer(const uint8_t *data, size_t size)
 {
-	auto saveStr = sprintStateFilename(saveStateSlot);
-	logMsg("loading state %s", saveStr.data());
-	fixFilePermissions(saveStr);
-	Serializer state(string(saveStr.data()), 1);
+	Serializer state;
+	state.setData(data, size);
 	if(!stateManager.loadState(state))
 	{
 		return {{EIO, std::system_category()}};
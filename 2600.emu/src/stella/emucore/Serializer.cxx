@@ -95,6 +95,25 @@ void Serializer::reset()
   myStream->seekp(ios_base::beg);
 }
 
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Serializer::getData(ByteArray& data)
+{
+  uInt32 size = myStream->tellp();
+  data.resize(size);
+  myStream->seekg(ios_base::beg);
+  myStream->read((char*)data.data(), size);
+}
+
+// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+void Serializer::setData(const uInt8* data, uInt32 size)
+{
+  if(myUseFilestream)
+    return;
+
+  static_cast<stringstream*>(myStream.get())->str(string((const char*)data, size));
+  reset();
+}
+
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 uInt8 Serializer::getByte() const
 {
@@ -68,6 +68,22 @@ class Serializer
     */
     void reset();
 
+    /**
+      Copies all data written to the stream so far into the given array.
+
+      @param data  The array to receive the stream contents
+    */
+    void getData(ByteArray& data);
+
+    /**
+      Replaces the contents of an in-memory stream with the given data
+      and resets the read/write location to the beginning of the stream.
+
+      @param data  The location of the bytes to use as the stream contents
+      @param size  The number of bytes to use
+    */
+    void setData(const uInt8* data, uInt32 size);
+
     /**
       Reads a byte value (unsigned 8-bit) from the current input stream.
 
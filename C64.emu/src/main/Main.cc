@@ -22,6 +22,7 @@
 #include <imagine/thread/Thread.hh>
 #include <imagine/thread/Semaphore.hh>
 #include <imagine/gui/AlertView.hh>
+#include <imagine/util/ScopeGuard.hh>
 #include "internal.hh"
 #include <sys/time.h>
 
@@ -481,6 +482,8 @@ const uint EmuSystem::aspectRatioInfos = IG::size(EmuSystem::aspectRatioInfo);
 bool EmuSystem::hasPALVideoSystem = true;
 bool EmuSystem::hasResetModes = true;
 bool EmuSystem::handlesGenericIO = false;
+// state loads go through a scratch file and run extra frames to settle
+bool EmuSystem::hasRunAhead = false;
 
 const char *EmuSystem::shortSystemName()
 {
@@ -1065,21 +1068,38 @@ static void saveSnapshotTrap(WORD, void *data)
 		snapData->hasError = false;
 }
 
-std::error_code EmuSystem::saveState()
+// VICE snapshots are only written to and read from files, so go through a scratch file
+static FS::PathString sprintScratchStateFilename()
+{
+	return FS::makePathStringPrintf("%s/.%s.tmp.vsf", EmuSystem::savePath(), EmuSystem::gameName().data());
+}
+
+std::error_code EmuSystem::saveStateToBuffer(std::vector<uint8_t> &buff)
 {
 	SnapshotTrapData data;
-	data.pathStr = sprintStateFilename(saveStateSlot);
-	fixFilePermissions(data.pathStr);
+	data.pathStr = sprintScratchStateFilename();
 	plugin.interrupt_maincpu_trigger_trap(saveSnapshotTrap, (void*)&data);
 	runFrame(0, 0, 0); // execute cpu trap
-	return data.hasError ? std::error_code{EIO, std::system_category()} : std::error_code{};
+	auto removeScratchFile = IG::scopeGuard([&](){ FS::remove(data.pathStr); });
+	if(data.hasError)
+		return {EIO, std::system_category()};
+	FileIO f;
+	auto ec = f.open(data.pathStr);
+	if(ec)
+		return ec;
+	buff.resize(f.size());
+	return f.readAll(buff.data(), buff.size());
 }
 
-std::system_error EmuSystem::loadState(int saveStateSlot)
+std::system_error EmuSystem::loadStateFromBuffer(const uint8_t *stateData, size_t size)
 {
 	plugin.resources_set_int("WarpMode", 0);
 	SnapshotTrapData data;
-	data.pathStr = sprintStateFilename(saveStateSlot);
+	data.pathStr = sprintScratchStateFilename();
+	auto ec = writeToNewFile(data.pathStr.data(), (void*)stateData, size);
+	if(ec)
+		return {ec};
+	auto removeScratchFile = IG::scopeGuard([&](){ FS::remove(data.pathStr); });
 	runFrame(0, 0, 0); // run extra frame in case C64 was just started
 	plugin.interrupt_maincpu_trigger_trap(loadSnapshotTrap, (void*)&data);
 	runFrame(0, 0, 0); // execute cpu trap, snapshot load may cause reboot from a C64 model change
@@ -1093,22 +1113,6 @@ std::system_error EmuSystem::loadState(int saveStateSlot)
 	return hasError ? std::system_error{{EIO, std::system_category()}} : std::system_error{{}};
 }
 
-void EmuSystem::saveAutoState()
-{
-	if(gameIsRunning() && optionAutoSaveState)
-	{
-		SnapshotTrapData data;
-		data.pathStr = sprintStateFilename(-1);
-		fixFilePermissions(data.pathStr);
-		plugin.interrupt_maincpu_trigger_trap(saveSnapshotTrap, (void*)&data);
-		runFrame(0, 0, 0); // execute cpu trap
-		if(data.hasError)
-		{
-			logErr("error writing auto-save state %s", data.pathStr.data());
-		}
-	}
-}
-
 void EmuSystem::saveBackupMem()
 {
 	if(gameIsRunning())
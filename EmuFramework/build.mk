@@ -27,7 +27,14 @@ EmuVideo.cc \
 EmuInputView.cc \
 EmuVideoLayer.cc \
 Cheats.cc \
-Recent.cc
+Recent.cc \
+Rewind.cc \
+RewindRing.cc \
+Benchmark.cc \
+EmuThread.cc \
+RunAhead.cc \
+AudioRateControl.cc \
+FrameTelemetry.cc
 
 ifeq ($(emuFramework_onScreenControls), 1)
  SRC += TouchConfigView.cc \
@@ -55,6 +62,7 @@ LDLIBS := -l$(libName) $(LDLIBS)
 
 include $(IMAGINE_PATH)/make/package/imagine.mk
 include $(IMAGINE_PATH)/make/package/stdc++.mk
+include $(IMAGINE_PATH)/make/package/zlib.mk
 
 include $(IMAGINE_PATH)/make/imagineStaticLibTarget.mk
 
@@ -0,0 +1,53 @@
+#pragma once
+
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <vector>
+#include <cstdint>
+
+// Keeps the audio output buffer near half full to absorb drift between the
+// display and audio clocks. Each video frame's samples are resampled with a
+// polyphase Kaiser-windowed sinc filter by a ratio within MAX_RATIO_DELTA
+// of 1, chosen from how far the buffer's free space is from the target.
+class EmuAudioRateControl
+{
+public:
+	static constexpr double MAX_RATIO_DELTA = 0.005;
+
+	// bufferFrames is the output buffer size from Audio::bufferFrames()
+	void reset(uint channels, int bufferFrames);
+	double updateRatio(int framesFree);
+	double ratio() const { return ratio_; }
+	// returns the number of frames written to out, which stays valid until the next call
+	uint resample(const int16_t *in, uint inFrames, const int16_t *&out);
+
+	// filter length in input frames and number of fractional positions
+	// in the coefficient table, interpolated linearly between them
+	static constexpr uint TAPS = 32;
+	static constexpr uint PHASES = 256;
+
+private:
+	static constexpr uint HISTORY_FRAMES = TAPS - 1;
+
+	std::vector<int16_t> input{};
+	std::vector<int16_t> output{};
+	double pos = TAPS / 2 - 1;
+	double ratio_ = 1;
+	uint channels = 2;
+	int bufferFrames = 0;
+};
+
+extern EmuAudioRateControl emuAudioRateControl;
@@ -0,0 +1,40 @@
+#pragma once
+
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/time/Time.hh>
+#include <cstdio>
+
+struct BenchmarkStats
+{
+	uint frames = 0;
+	IG::Time total{};
+	IG::Time min{};
+	IG::Time median{};
+	IG::Time p99{};
+	IG::Time max{};
+
+	constexpr BenchmarkStats() {}
+	double fps() const;
+	void writeJSON(FILE *file, bool processGfx, bool renderAudio) const;
+};
+
+// Times each call of runFrame(false, processGfx, renderAudio) individually
+BenchmarkStats runBenchmark(uint frames, bool processGfx, bool renderAudio);
+
+// Loads a game and prints its benchmark stats as JSON to stdout, returns the process exit code
+// Usage: --headless <game path> [--frames N] [--no-gfx] [--audio]
+int runHeadlessBenchmark(int argc, char** argv);
@@ -56,6 +56,7 @@ static const int guiKeyIdxIncStateSlot = 5;
 static const int guiKeyIdxFastForward = 6;
 static const int guiKeyIdxGameScreenshot = 7;
 static const int guiKeyIdxExit = 8;
+static const int guiKeyIdxRewind = 9;
 
 void processRelPtr(Input::Event e);
 void commonInitInput();
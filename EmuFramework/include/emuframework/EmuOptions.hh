@@ -40,6 +40,7 @@ bool optionIsValidWithMinMax(T val)
 extern Byte1Option optionAutoSaveState;
 extern Byte1Option optionConfirmAutoLoadState;
 extern Byte1Option optionSound;
+extern Byte1Option optionAudioRateControl;
 #ifdef CONFIG_AUDIO_LATENCY_HINT
 	#if defined CONFIG_AUDIO_ALSA || defined CONFIG_AUDIO_OPENSL_ES || defined CONFIG_AUDIO_PULSEAUDIO
 	// these backends may have additional buffering in the OS/driver
@@ -71,7 +72,15 @@ extern Byte1Option optionIdleDisplayPowerSave;
 extern Byte1Option optionHideStatusBar;
 extern OptionSwappedGamepadConfirm optionSwappedGamepadConfirm;
 extern Byte1Option optionConfirmOverwriteState;
+// runs as many frames as possible on the emulation thread instead of a fixed count per screen frame
+static constexpr uint8 FAST_FORWARD_SPEED_UNCAPPED = 0;
 extern Byte1Option optionFastForwardSpeed;
+extern Byte1Option optionFastForwardAudio;
+extern Byte2Option optionRewindMemory;
+extern Byte1Option optionRewindInterval;
+extern Byte1Option optionEmuThread;
+extern Byte1Option optionRunAheadFrames;
+extern Byte1Option optionFrameTelemetry;
 #ifdef CONFIG_INPUT_DEVICE_HOTSWAP
 extern Byte1Option optionNotifyInputDeviceChange;
 #endif
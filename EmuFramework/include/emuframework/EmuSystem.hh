@@ -27,6 +27,7 @@
 #include <imagine/util/audio/PcmFormat.hh>
 #include <imagine/util/string.h>
 #include <system_error>
+#include <vector>
 
 #ifdef ENV_NOTE
 #define PLATFORM_INFO_STR ENV_NOTE " (" CONFIG_ARCH_STR ")"
@@ -115,6 +116,10 @@ public:
 	static bool handlesArchiveFiles;
 	static bool handlesGenericIO;
 	static bool hasCheats;
+	// false if loadStateFromBuffer() isn't a clean restore of the running state
+	static bool hasRunAhead;
+	// true if state files are gzip-compressed, as older versions of the core wrote them
+	static bool gzipsStateFiles;
 	static NameFilterFunc defaultFsFilter;
 	static NameFilterFunc defaultBenchmarkFsFilter;
 	static const char *creditsViewStr;
@@ -130,6 +135,14 @@ public:
 	static void startAutoSaveStateTimer();
 	static std::system_error loadState(int slot = saveStateSlot);
 	static std::error_code saveState();
+	static std::system_error loadStateFromFile(const char *path);
+	// called before a state file replaces the running state, unlike rewind & run-ahead loads
+	static void willLoadStateFromFile();
+	static std::error_code saveStateToFile(const char *path);
+	// data written by saveStateToFile(), saveStateToBuffer() output unless overridden
+	static std::error_code saveStateToFileBuffer(std::vector<uint8_t> &buff);
+	static std::system_error loadStateFromBuffer(const uint8_t *data, size_t size);
+	static std::error_code saveStateToBuffer(std::vector<uint8_t> &buff);
 	static bool stateExists(int slot);
 	static bool shouldOverwriteExistingState();
 	static const char *systemName();
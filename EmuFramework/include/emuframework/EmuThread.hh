@@ -0,0 +1,83 @@
+#pragma once
+
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/thread/Thread.hh>
+#include <imagine/thread/Semaphore.hh>
+#include <atomic>
+#include <array>
+
+// Runs EmuSystem::runFrame() on a dedicated thread so the main thread only handles
+// input and drawing. The main thread posts one job per screen frame and never
+// touches the emulated system while a job is running without calling waitIdle().
+// An uncapped job instead runs frames back to back until waitIdle() or
+// stopUncapped() is called, rendering only the frames the main thread requests.
+class EmuThread
+{
+public:
+	struct Job
+	{
+		uint frames;
+		bool renderAudio;
+		bool rewind;
+		bool runAhead;
+		bool uncapped;
+	};
+
+	EmuThread() {}
+	void start();
+	void stop();
+	bool isActive() const { return active; }
+	bool isEmuThread() const;
+	bool postJob(Job job);
+	bool isBusy() const { return busy.load(std::memory_order_acquire); }
+	void waitIdle();
+	void handleInputAction(uint state, uint action);
+	bool isRunningUncapped() const { return jobPending && job.uncapped; }
+	void requestUncappedFrame();
+	void stopUncapped();
+	// returns the frames run by the uncapped job since the last call
+	uint takeUncappedFrames();
+
+private:
+	struct InputAction
+	{
+		uint state;
+		uint action;
+	};
+	static constexpr uint INPUT_QUEUE_SIZE = 64;
+
+	IG::Semaphore jobSem{0}, jobDoneSem{0};
+	IG::thread::id threadID{};
+	Job job{};
+	std::atomic_bool busy{false};
+	bool jobPending = false;
+	bool active = false;
+	bool quit = false;
+	// single-producer/single-consumer queue from the main thread to the emulation thread
+	std::array<InputAction, INPUT_QUEUE_SIZE> inputQueue{};
+	std::atomic_uint inputHead{0}, inputTail{0};
+	std::atomic_bool uncappedFrameRequested{false};
+	std::atomic_bool uncappedQuit{false};
+	std::atomic_uint uncappedFrames{0};
+
+	void run();
+	void runJob();
+	void runUncapped();
+	void drainInputQueue();
+};
+
+extern EmuThread emuThread;
@@ -16,6 +16,9 @@
 	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
 
 #include <imagine/gfx/Texture.hh>
+#include <imagine/pixmap/Pixmap.hh>
+#include <atomic>
+#include <array>
 
 class EmuVideo
 {
@@ -25,8 +28,16 @@ public:
 	char *pixBuff{};
 	uint vidPixAlign = Gfx::Texture::MAX_ASSUME_ALIGN;
 
+protected:
+	// triple buffer of frames handed from the emulation thread to the main thread,
+	// each side owns one buffer and swaps with the shared one
+	static constexpr uint THREAD_FRAME_UPDATED = 0x4;
+	std::array<IG::MemPixmap, 3> threadFrame{};
+	uint threadBackFrame = 0, threadFrontFrame = 1;
+	std::atomic_uint threadReadyFrame{2};
+
 public:
-	constexpr EmuVideo() {}
+	EmuVideo() {}
 	void initPixmap(char *pixBuff, IG::PixelFormat format, uint x, uint y, uint pitch = 0);
 	void reinitImage();
 	void clearImage();
@@ -35,6 +46,9 @@ public:
 	void initImage(bool force, uint x, uint y, uint pitch = 0);
 	void initImage(bool force, uint xO, uint yO, uint x, uint y, uint totalX, uint totalY, uint pitch = 0);
 	void updateImage();
+	void commitThreadFrame();
+	bool hasThreadFrame() const;
+	bool updateImageFromThreadFrame();
 	void takeGameScreenshot();
 	bool isExternalTexture();
 };
@@ -0,0 +1,113 @@
+#pragma once
+
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/base/Base.hh>
+#include <imagine/time/Time.hh>
+#include <imagine/gfx/GfxText.hh>
+#include <imagine/gfx/GeomRect.hh>
+#include <atomic>
+#include <array>
+#include <cstdio>
+#include <cstdint>
+
+// Records how each screen frame was paced: frames elapsed according to
+// advanceFramesWithTime(), frames emulated and skipped, time spent in runFrame()
+// and uploading the video texture, and the audio buffer's free space
+class EmuFrameTelemetry
+{
+public:
+	struct Sample
+	{
+		Base::FrameTimeBase timestamp;
+		uint32_t runUSecs;
+		uint32_t uploadUSecs;
+		int32_t audioFramesFree;
+		uint16_t framesElapsed;
+		uint16_t framesRun;
+		uint16_t framesSkipped;
+	};
+
+	static constexpr uint MAX_SAMPLES = 1024;
+
+	void setEnabled(bool on);
+	bool isEnabled() const { return enabled; }
+	void reset();
+	// called from the main thread on each screen frame, finishes the previous sample
+	void beginFrame(Base::FrameTimeBase timestamp, uint framesElapsed, uint framesRun, uint framesSkipped);
+	// may be called from the emulation thread
+	void addRunTime(IG::Time time);
+	void addUploadTime(IG::Time time);
+
+	template <class FUNC>
+	void timeRun(FUNC func)
+	{
+		if(!enabled)
+			func();
+		else
+			addRunTime(IG::timeFunc(func));
+	}
+
+	template <class FUNC>
+	void timeUpload(FUNC func)
+	{
+		if(!enabled)
+			func();
+		else
+			addUploadTime(IG::timeFunc(func));
+	}
+
+	uint samples() const
+	{
+		auto count = written.load(std::memory_order_acquire);
+		return count < MAX_SAMPLES ? count : MAX_SAMPLES;
+	}
+	// copies up to max of the newest samples, oldest first, and returns the count
+	uint copySamples(Sample *out, uint max) const;
+	void writeCSV(FILE *file) const;
+
+private:
+	// written only by the main thread, the count is published with release
+	// ordering so the newest MAX_SAMPLES entries can be read from any thread
+	std::array<Sample, MAX_SAMPLES> sample{};
+	std::atomic_uint written{0};
+	std::atomic_uint runUSecs{0};
+	std::atomic_uint uploadUSecs{0};
+	Sample current{};
+	bool hasCurrent = false;
+	bool enabled = false;
+};
+
+// Summarizes recent samples in a corner of the emulated video
+class FrameTelemetryOverlay
+{
+public:
+	FrameTelemetryOverlay() {}
+	void init();
+	void place(const Gfx::ProjectionPlane &projP);
+	void draw();
+
+private:
+	Gfx::Text text{};
+	Gfx::ProjectionPlane projP{};
+	std::array<char, 192> str{};
+	uint framesUntilUpdate = 0;
+
+	void update();
+};
+
+extern EmuFrameTelemetry emuFrameTelemetry;
+extern FrameTelemetryOverlay frameTelemetryOverlay;
@@ -94,6 +94,7 @@ protected:
 	#endif
 	TextMenuItem audioRateItem[4];
 	MultiChoiceMenuItem audioRate;
+	BoolMenuItem audioRateControl;
 	#ifdef CONFIG_AUDIO_OPENSL_ES
 	BoolMenuItem sndUnderrunCheck;
 	#endif
@@ -119,14 +120,24 @@ protected:
 	TextMenuItem savePath;
 	BoolMenuItem checkSavePathWriteAccess;
 	static constexpr uint MIN_FAST_FORWARD_SPEED = 2;
-	TextMenuItem fastForwardSpeedItem[6];
+	TextMenuItem fastForwardSpeedItem[7];
 	MultiChoiceMenuItem fastForwardSpeed;
+	BoolMenuItem fastForwardAudio;
+	TextMenuItem rewindMemoryItem[6];
+	MultiChoiceMenuItem rewindMemory;
+	TextMenuItem rewindIntervalItem[4];
+	MultiChoiceMenuItem rewindInterval;
+	BoolMenuItem separateEmuThread;
+	TextMenuItem runAheadFramesItem[4];
+	MultiChoiceMenuItem runAheadFrames;
+	BoolMenuItem frameTelemetry;
+	TextMenuItem saveFrameTelemetry;
 	#if defined __ANDROID__
 	TextMenuItem processPriorityItem[3];
 	MultiChoiceMenuItem processPriority;
 	BoolMenuItem fakeUserActivity;
 	#endif
-	StaticArrayList<MenuItem*, 24> item{};
+	StaticArrayList<MenuItem*, 32> item{};
 
 public:
 	SystemOptionView(Base::Window &win, bool customMenu = false);
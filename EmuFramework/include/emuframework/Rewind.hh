@@ -0,0 +1,63 @@
+#pragma once
+
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <emuframework/RewindRing.hh>
+#include <imagine/time/Time.hh>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Stores recent save states in a fixed-size ring, each one either a keyframe
+// or an XOR delta against its group's keyframe, run-length encoded on zero bytes
+class EmuRewind
+{
+public:
+	static constexpr uint KEYFRAME_INTERVAL = 30;
+
+	void setMemoryLimit(size_t bytes);
+	size_t memoryLimit() const { return limit; }
+	void setCaptureInterval(uint frames);
+	bool isEnabled() const { return limit; }
+	void reset();
+	void addFrames(uint frames);
+	bool capture();
+	bool rewind();
+	uint snapshots() const { return ring.entries(); }
+	size_t memoryUsed() const { return ring.memoryUsed(); }
+	IG::Time lastCaptureTime() const { return lastCaptureTime_; }
+	IG::Time maxCaptureTime() const { return maxCaptureTime_; }
+
+private:
+	RewindRing ring{};
+	std::vector<uint8_t> state{};
+	std::vector<uint8_t> keyframe{};
+	std::vector<uint8_t> encoded{};
+	size_t limit = 0;
+	uint interval = 4;
+	uint frameCount = 0;
+	uint deltasSinceKeyframe = 0;
+	IG::Time lastCaptureTime_{};
+	IG::Time maxCaptureTime_{};
+
+	bool store(const std::vector<uint8_t> &data, bool isKeyframe);
+	bool restoreKeyframeBefore(size_t idx);
+	static void encode(const uint8_t *data, const uint8_t *ref, size_t size, std::vector<uint8_t> &out);
+	static bool decode(const uint8_t *src, size_t srcSize, const std::vector<uint8_t> *ref, std::vector<uint8_t> &out);
+};
+
+extern EmuRewind emuRewind;
+extern bool rewindActive;
@@ -0,0 +1,57 @@
+#pragma once
+
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <deque>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+// Fixed-size byte ring holding variable-size snapshots from oldest to newest.
+// Each keyframe starts a group with the deltas after it, and the oldest group
+// is evicted as a whole when a new snapshot needs its space.
+class RewindRing
+{
+public:
+	struct Entry
+	{
+		size_t offset;
+		size_t size;
+		bool isKeyframe;
+	};
+
+	void allocate(size_t size);
+	void deallocate();
+	size_t capacity() const { return ringSize; }
+	void clear();
+	bool push(const uint8_t *data, size_t size, bool isKeyframe);
+	void popBack();
+	bool empty() const { return entry.empty(); }
+	size_t entries() const { return entry.size(); }
+	const Entry &operator[](size_t idx) const { return entry[idx]; }
+	const Entry &back() const { return entry.back(); }
+	const uint8_t *data(const Entry &e) const { return &ring[e.offset]; }
+	size_t memoryUsed() const;
+
+private:
+	std::unique_ptr<uint8_t[]> ring{};
+	size_t ringSize = 0;
+	std::deque<Entry> entry{};
+	size_t writeOffset = 0;
+
+	void evictOldestGroup();
+	bool overlapsLiveEntry(size_t offset, size_t size) const;
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <vector>
+#include <cstdint>
+
+// Hides input latency by showing a frame from the future: after the real frame
+// runs, the state is saved, the next frames run hidden with the current input
+// and the last one is displayed, then the saved state is restored
+class EmuRunAhead
+{
+public:
+	static constexpr uint MAX_FRAMES = 3;
+
+	void setFrames(uint frames);
+	uint frames() const { return frames_; }
+	bool isEnabled() const { return frames_ && !failed; }
+	void runFrame(bool renderGfx, bool processGfx, bool renderAudio);
+
+private:
+	std::vector<uint8_t> state{};
+	uint frames_ = 0;
+	bool failed = false;
+};
+
+extern EmuRunAhead emuRunAhead;
@@ -0,0 +1,145 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <emuframework/AudioRateControl.hh>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+EmuAudioRateControl emuAudioRateControl{};
+
+// passband edge as a fraction of the input rate and Kaiser window shape,
+// about 70dB of stopband rejection with 32 taps
+static constexpr double CUTOFF = 0.45;
+static constexpr double KAISER_BETA = 7.;
+
+using FilterTable = std::array<std::array<float, EmuAudioRateControl::TAPS>, EmuAudioRateControl::PHASES + 1>;
+
+static double besselI0(double x)
+{
+	double sum = 1, term = 1;
+	for(int k = 1; k < 32; k++)
+	{
+		term *= (x / (2 * k)) * (x / (2 * k));
+		sum += term;
+	}
+	return sum;
+}
+
+// row p holds the taps for an output frame p / PHASES of the way between
+// two input frames, the last row repeats the first shifted by one frame
+static FilterTable makeFilterTable()
+{
+	constexpr int taps = EmuAudioRateControl::TAPS;
+	constexpr int phases = EmuAudioRateControl::PHASES;
+	FilterTable table;
+	double halfLength = taps / 2.;
+	for(int p = 0; p <= phases; p++)
+	{
+		double t = p / (double)phases;
+		double sum = 0;
+		for(int k = 0; k < taps; k++)
+		{
+			double d = (k - (taps / 2 - 1)) - t;
+			double x = 2. * CUTOFF * d;
+			double sinc = d == 0 ? 1. : std::sin(M_PI * x) / (M_PI * x);
+			double w = d / halfLength;
+			double window = besselI0(KAISER_BETA * std::sqrt(std::max(1. - w * w, 0.))) / besselI0(KAISER_BETA);
+			table[p][k] = sinc * window;
+			sum += table[p][k];
+		}
+		// unity gain at DC for every phase
+		for(auto &h : table[p])
+			h /= sum;
+	}
+	return table;
+}
+
+static const FilterTable &filterTable()
+{
+	static const FilterTable table = makeFilterTable();
+	return table;
+}
+
+void EmuAudioRateControl::reset(uint channels, int bufferFrames)
+{
+	this->channels = channels;
+	input.assign(HISTORY_FRAMES * channels, 0);
+	pos = TAPS / 2 - 1;
+	ratio_ = 1;
+	this->bufferFrames = bufferFrames;
+	filterTable();
+}
+
+double EmuAudioRateControl::updateRatio(int framesFree)
+{
+	if(bufferFrames < 2)
+	{
+		ratio_ = 1;
+		return ratio_;
+	}
+	double halfSize = bufferFrames / 2.;
+	double direction = std::min(std::max((framesFree - halfSize) / halfSize, -1.), 1.);
+	// more free space than the target means output more frames per input frame
+	ratio_ = 1. + MAX_RATIO_DELTA * direction;
+	return ratio_;
+}
+
+uint EmuAudioRateControl::resample(const int16_t *in, uint inFrames, const int16_t *&out)
+{
+	// the last frames of the previous call come first so filtering is continuous
+	auto historySamples = HISTORY_FRAMES * channels;
+	if(input.size() < historySamples)
+		input.assign(historySamples, 0);
+	input.resize(historySamples + inFrames * channels);
+	memcpy(&input[historySamples], in, inFrames * channels * sizeof(int16_t));
+	auto totalFrames = HISTORY_FRAMES + inFrames;
+	auto maxOutFrames = (uint)(inFrames * ratio_) + 4;
+	output.resize(maxOutFrames * channels);
+	auto &table = filterTable();
+	double step = 1. / ratio_;
+	uint outFrames = 0;
+	// each output frame uses input frames i - (TAPS / 2 - 1) to i + TAPS / 2
+	while(pos + TAPS / 2 < totalFrames && outFrames < maxOutFrames)
+	{
+		uint i = pos;
+		double phasePos = (pos - i) * PHASES;
+		uint phase = phasePos;
+		float phaseFrac = phasePos - phase;
+		float h[TAPS];
+		for(uint k = 0; k < TAPS; k++)
+		{
+			h[k] = table[phase][k] + phaseFrac * (table[phase + 1][k] - table[phase][k]);
+		}
+		auto x = &input[(i - (TAPS / 2 - 1)) * channels];
+		auto y = &output[outFrames * channels];
+		for(uint c = 0; c < channels; c++)
+		{
+			float acc = 0;
+			for(uint k = 0; k < TAPS; k++)
+			{
+				acc += x[k * channels + c] * h[k];
+			}
+			y[c] = std::lround(std::min(std::max(acc, -32768.f), 32767.f));
+		}
+		outFrames++;
+		pos += step;
+	}
+	pos -= inFrames;
+	memmove(input.data(), &input[inFrames * channels], historySamples * sizeof(int16_t));
+	out = output.data();
+	return outFrames;
+}
@@ -0,0 +1,119 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <emuframework/Benchmark.hh>
+#include <emuframework/EmuSystem.hh>
+#include <emuframework/EmuOptions.hh>
+#include <imagine/logger/logger.h>
+#include <algorithm>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+
+double BenchmarkStats::fps() const
+{
+	return (double)total ? frames / (double)total : 0.;
+}
+
+static void writeJSONString(FILE *file, const char *str)
+{
+	fputc('"', file);
+	for(; *str; str++)
+	{
+		auto c = (unsigned char)*str;
+		if(c == '"' || c == '\\')
+			fprintf(file, "\\%c", c);
+		else if(c < 0x20)
+			fprintf(file, "\\u%04x", c);
+		else
+			fputc(c, file);
+	}
+	fputc('"', file);
+}
+
+void BenchmarkStats::writeJSON(FILE *file, bool processGfx, bool renderAudio) const
+{
+	auto msecs = [](IG::Time t){ return (double)t * 1000.; };
+	fprintf(file, "{\"system\":");
+	writeJSONString(file, EmuSystem::shortSystemName());
+	fprintf(file, ",\"game\":");
+	writeJSONString(file, EmuSystem::gameName().data());
+	fprintf(file, ",\"frames\":%u,\"processGfx\":%s,\"renderAudio\":%s,"
+		"\"totalSecs\":%.6f,\"fps\":%.3f,"
+		"\"frameTimeMSecs\":{\"min\":%.4f,\"median\":%.4f,\"p99\":%.4f,\"max\":%.4f}}\n",
+		frames, processGfx ? "true" : "false", renderAudio ? "true" : "false",
+		(double)total, fps(),
+		msecs(min), msecs(median), msecs(p99), msecs(max));
+}
+
+BenchmarkStats runBenchmark(uint frames, bool processGfx, bool renderAudio)
+{
+	BenchmarkStats stats{};
+	if(!frames)
+		return stats;
+	std::vector<IG::Time> frameTime(frames);
+	for(auto &t : frameTime)
+	{
+		t = IG::timeFunc([&](){ EmuSystem::runFrame(false, processGfx, renderAudio); });
+		stats.total += t;
+	}
+	std::sort(frameTime.begin(), frameTime.end());
+	stats.frames = frames;
+	stats.min = frameTime.front();
+	stats.median = frameTime[frames / 2];
+	stats.p99 = frameTime[std::max((frames * 99 + 99) / 100, 1u) - 1];
+	stats.max = frameTime.back();
+	return stats;
+}
+
+int runHeadlessBenchmark(int argc, char** argv)
+{
+	if(argc < 3)
+	{
+		fprintf(stderr, "usage: %s --headless <game path> [--frames N] [--no-gfx] [--audio]\n", argv[0]);
+		return 1;
+	}
+	auto gamePath = argv[2];
+	uint frames = 600;
+	bool processGfx = true, renderAudio = false;
+	for(int i = 3; i < argc; i++)
+	{
+		if(!strcmp(argv[i], "--frames") && i + 1 < argc)
+			frames = std::max(atoi(argv[++i]), 1);
+		else if(!strcmp(argv[i], "--no-gfx"))
+			processGfx = false;
+		else if(!strcmp(argv[i], "--audio"))
+			renderAudio = true;
+		else
+		{
+			fprintf(stderr, "unknown argument: %s\n", argv[i]);
+			return 1;
+		}
+	}
+	initOptions();
+	EmuSystem::onOptionsLoaded();
+	auto res = EmuSystem::loadGameFromPath(FS::makePathString(gamePath));
+	if(res != 1)
+	{
+		fprintf(stderr, "error loading game: %s\n", gamePath);
+		return 1;
+	}
+	EmuSystem::configAudioPlayback();
+	logMsg("running %u frame benchmark", frames);
+	auto stats = runBenchmark(frames, processGfx, renderAudio);
+	stats.writeJSON(stdout, processGfx, renderAudio);
+	fflush(stdout);
+	return 0;
+}
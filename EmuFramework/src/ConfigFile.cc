@@ -161,6 +161,7 @@ static bool readConfig2(IO &io)
 				}
 			}
 			bcase CFGKEY_SOUND: optionSound.readFromIO(io, size);
+			bcase CFGKEY_AUDIO_RATE_CONTROL: optionAudioRateControl.readFromIO(io, size);
 			bcase CFGKEY_SOUND_RATE: optionSoundRate.readFromIO(io, size);
 			bcase CFGKEY_TOUCH_CONTROL_ALPHA: optionTouchCtrlAlpha.readFromIO(io, size);
 			#ifdef CONFIG_VCONTROLS_GAMEPAD
@@ -221,6 +222,12 @@ static bool readConfig2(IO &io)
 			bcase CFGKEY_HIDE_STATUS_BAR: optionHideStatusBar.readFromIO(io, size);
 			bcase CFGKEY_CONFIRM_OVERWRITE_STATE: optionConfirmOverwriteState.readFromIO(io, size);
 			bcase CFGKEY_FAST_FORWARD_SPEED: optionFastForwardSpeed.readFromIO(io, size);
+			bcase CFGKEY_FAST_FORWARD_AUDIO: optionFastForwardAudio.readFromIO(io, size);
+			bcase CFGKEY_REWIND_MEMORY: optionRewindMemory.readFromIO(io, size);
+			bcase CFGKEY_REWIND_INTERVAL: optionRewindInterval.readFromIO(io, size);
+			bcase CFGKEY_EMU_THREAD: optionEmuThread.readFromIO(io, size);
+			bcase CFGKEY_RUN_AHEAD_FRAMES: optionRunAheadFrames.readFromIO(io, size);
+			bcase CFGKEY_FRAME_TELEMETRY: optionFrameTelemetry.readFromIO(io, size);
 			#ifdef CONFIG_INPUT_DEVICE_HOTSWAP
 			bcase CFGKEY_NOTIFY_INPUT_DEVICE_CHANGE: optionNotifyInputDeviceChange.readFromIO(io, size);
 			#endif
@@ -405,6 +412,7 @@ static OptionBase *cfgFileOption[] =
 	&optionAutoSaveState,
 	&optionConfirmAutoLoadState,
 	&optionSound,
+	&optionAudioRateControl,
 	&optionSoundRate,
 	&optionAspectRatio,
 	&optionImageZoom,
@@ -448,6 +456,12 @@ static OptionBase *cfgFileOption[] =
 	&optionSwappedGamepadConfirm,
 	&optionConfirmOverwriteState,
 	&optionFastForwardSpeed,
+	&optionFastForwardAudio,
+	&optionRewindMemory,
+	&optionRewindInterval,
+	&optionEmuThread,
+	&optionRunAheadFrames,
+	&optionFrameTelemetry,
 	#ifdef CONFIG_INPUT_DEVICE_HOTSWAP
 	&optionNotifyInputDeviceChange,
 	#endif
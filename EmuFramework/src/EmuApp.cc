@@ -20,6 +20,11 @@
 #include <emuframework/FilePicker.hh>
 #include <emuframework/ConfigFile.hh>
 #include <emuframework/EmuView.hh>
+#include <emuframework/Rewind.hh>
+#include <emuframework/RunAhead.hh>
+#include <emuframework/FrameTelemetry.hh>
+#include <emuframework/Benchmark.hh>
+#include <emuframework/EmuThread.hh>
 #include <imagine/gui/AlertView.hh>
 #include <imagine/util/assume.h>
 #include <cmath>
@@ -95,13 +100,21 @@ static void drawEmuVideo()
 	else if(emuView2.layer)
 		emuView2.draw();
 	popup.draw();
+	if(emuFrameTelemetry.isEnabled())
+		frameTelemetryOverlay.draw();
 	Gfx::setClipRect(false);
 	Gfx::presentWindow(emuWin->win);
 }
 
 void updateAndDrawEmuVideo()
 {
-	emuVideo.updateImage();
+	if(emuThread.isEmuThread())
+	{
+		// main thread uploads and draws the frame on its next screen update
+		emuVideo.commitThreadFrame();
+		return;
+	}
+	emuFrameTelemetry.timeUpload([](){ emuVideo.updateImage(); });
 	drawEmuVideo();
 }
 
@@ -142,19 +155,119 @@ void setCPUNeedsLowLatency(bool needed)
 	#endif
 }
 
+static uint maxFrameSkip()
+{
+	const uint maxLateFrameSkip = 6;
+	uint maxFrameSkip = optionSkipLateFrames ? maxLateFrameSkip : 0;
+	#if defined CONFIG_BASE_SCREEN_FRAME_INTERVAL
+	if(!optionSkipLateFrames)
+		maxFrameSkip = optionFrameInterval - 1;
+	#endif
+	assumeExpr(maxFrameSkip <= maxLateFrameSkip);
+	return maxFrameSkip;
+}
+
+static bool fastForwardIsUncapped()
+{
+	return fastForwardActive && !rewindActive && optionFastForwardSpeed == FAST_FORWARD_SPEED_UNCAPPED;
+}
+
+static void postEmuThreadFrames(Base::FrameTimeBase timestamp, bool uncappedFastForward)
+{
+	if(emuVideo.hasThreadFrame())
+		postDrawToEmuWindows();
+	if(emuThread.isRunningUncapped())
+	{
+		if(uncappedFastForward)
+		{
+			// present the newest frame on the next screen update and keep running
+			uint frames = emuThread.takeUncappedFrames();
+			emuFrameTelemetry.beginFrame(timestamp, 0, frames, frames ? frames - 1 : 0);
+			emuThread.requestUncappedFrame();
+			return;
+		}
+		emuThread.stopUncapped();
+	}
+	if(emuThread.isBusy())
+	{
+		// frame time keeps accumulating so late frames are skipped on the next job
+		emuFrameTelemetry.beginFrame(timestamp, 0, 0, 0);
+		return;
+	}
+	if(unlikely(rewindActive))
+	{
+		uint frames = EmuSystem::advanceFramesWithTime(timestamp);
+		emuFrameTelemetry.beginFrame(timestamp, frames, 1, 0);
+		emuThread.postJob({1, false, true, false});
+	}
+	else if(unlikely(uncappedFastForward))
+	{
+		emuFrameTelemetry.beginFrame(timestamp, 0, 0, 0);
+		emuThread.takeUncappedFrames();
+		emuThread.postJob({0, optionSound && optionFastForwardAudio, false, false, true});
+	}
+	else if(unlikely(fastForwardActive))
+	{
+		emuFrameTelemetry.beginFrame(timestamp, 0, optionFastForwardSpeed + 1, optionFastForwardSpeed);
+		emuThread.postJob({optionFastForwardSpeed + 1u, false, false, false});
+	}
+	else if(uint frames = EmuSystem::advanceFramesWithTime(timestamp))
+	{
+		uint framesToSkip = std::min(frames - 1, maxFrameSkip());
+		emuFrameTelemetry.beginFrame(timestamp, frames, framesToSkip + 1, framesToSkip);
+		emuThread.postJob({framesToSkip + 1, (bool)optionSound, false, true});
+	}
+	else
+	{
+		emuFrameTelemetry.beginFrame(timestamp, 0, 0, 0);
+	}
+}
+
 static Base::Screen::OnFrameDelegate onFrameUpdate
 {
 	[](Base::Screen::FrameParams params)
 	{
 		commonUpdateInput();
-		if(unlikely(fastForwardActive))
+		bool uncappedFastForward = fastForwardIsUncapped();
+		if(unlikely(uncappedFastForward != emuThread.isActive()) && !optionEmuThread)
 		{
-			EmuSystem::runFrameOnDraw = true;
-			postDrawToEmuWindows();
-			iterateTimes((uint)optionFastForwardSpeed, i)
+			// uncapped fast-forward always runs on the emulation thread
+			if(uncappedFastForward)
 			{
-				EmuSystem::runFrame(false, false, false);
+				EmuSystem::runFrameOnDraw = false;
+				emuThread.start();
 			}
+			else
+				emuThread.stop();
+		}
+		if(emuThread.isActive())
+		{
+			postEmuThreadFrames(params.timestamp(), uncappedFastForward);
+		}
+		else if(unlikely(rewindActive))
+		{
+			uint frames = EmuSystem::advanceFramesWithTime(params.timestamp());
+			emuFrameTelemetry.beginFrame(params.timestamp(), frames, 1, 0);
+			if(emuRewind.rewind())
+			{
+				EmuSystem::runFrameOnDraw = true;
+				postDrawToEmuWindows();
+			}
+		}
+		else if(unlikely(fastForwardActive))
+		{
+			EmuSystem::runFrameOnDraw = true;
+			postDrawToEmuWindows();
+			emuFrameTelemetry.beginFrame(params.timestamp(), 0, optionFastForwardSpeed + 1, optionFastForwardSpeed);
+			emuFrameTelemetry.timeRun(
+				[]()
+				{
+					iterateTimes((uint)optionFastForwardSpeed, i)
+					{
+						EmuSystem::runFrame(false, false, false);
+					}
+				});
+			emuRewind.addFrames(optionFastForwardSpeed + 1);
 		}
 		else
 		{
@@ -164,23 +277,30 @@ static Base::Screen::OnFrameDelegate onFrameUpdate
 			{
 				EmuSystem::runFrameOnDraw = true;
 				postDrawToEmuWindows();
-				const uint maxLateFrameSkip = 6;
-				uint maxFrameSkip = optionSkipLateFrames ? maxLateFrameSkip : 0;
-				#if defined CONFIG_BASE_SCREEN_FRAME_INTERVAL
-				if(!optionSkipLateFrames)
-					maxFrameSkip = optionFrameInterval - 1;
-				#endif
-				assumeExpr(maxFrameSkip <= maxLateFrameSkip);
-				if(frames > 1 && maxFrameSkip)
+				uint framesToSkip = 0;
+				if(frames > 1 && maxFrameSkip())
+				{
+					framesToSkip = frames - 1;
+					framesToSkip = std::min(framesToSkip, maxFrameSkip());
+				}
+				emuFrameTelemetry.beginFrame(params.timestamp(), frames, framesToSkip + 1, framesToSkip);
+				if(framesToSkip)
 				{
-					uint framesToSkip = frames - 1;
-					framesToSkip = std::min(framesToSkip, maxFrameSkip);
 					bool renderAudio = optionSound;
-					iterateTimes(framesToSkip, i)
-					{
-						EmuSystem::runFrame(false, false, renderAudio);
-					}
+					emuFrameTelemetry.timeRun(
+						[=]()
+						{
+							iterateTimes(framesToSkip, i)
+							{
+								EmuSystem::runFrame(false, false, renderAudio);
+							}
+						});
 				}
+				emuRewind.addFrames(framesToSkip + 1);
+			}
+			else
+			{
+				emuFrameTelemetry.beginFrame(params.timestamp(), 0, 0, 0);
 			}
 		}
 		params.readdOnFrame();
@@ -199,12 +319,21 @@ static void applyFrameRates()
 static void startEmulation()
 {
 	setCPUNeedsLowLatency(true);
+	if(optionEmuThread)
+		emuThread.start();
+	else
+		emuThread.stop();
+	emuRewind.setMemoryLimit((size_t)optionRewindMemory * 1024 * 1024);
+	emuRewind.setCaptureInterval(optionRewindInterval);
+	emuRunAhead.setFrames(optionRunAheadFrames);
+	emuFrameTelemetry.setEnabled(optionFrameTelemetry);
 	EmuSystem::start();
 	emuWin->win.screen()->addOnFrameOnce(onFrameUpdate);
 }
 
 static void pauseEmulation()
 {
+	emuThread.waitIdle();
 	EmuSystem::pause();
 	emuWin->win.screen()->removeOnFrame(onFrameUpdate);
 	setCPUNeedsLowLatency(false);
@@ -219,10 +348,22 @@ void closeGame(bool allowAutosaveState)
 
 static void drawEmuFrame()
 {
-	if(EmuSystem::runFrameOnDraw)
+	if(emuThread.isActive())
 	{
-		bool renderAudio = optionSound;
-		EmuSystem::runFrame(true, true, renderAudio);
+		emuFrameTelemetry.timeUpload([](){ emuVideo.updateImageFromThreadFrame(); });
+		drawEmuVideo();
+	}
+	else if(EmuSystem::runFrameOnDraw)
+	{
+		bool renderAudio = optionSound && !rewindActive;
+		emuFrameTelemetry.timeRun(
+			[=]()
+			{
+				if(rewindActive || fastForwardActive)
+					EmuSystem::runFrame(true, true, renderAudio);
+				else
+					emuRunAhead.runFrame(true, true, renderAudio);
+			});
 		EmuSystem::runFrameOnDraw = false;
 	}
 	else
@@ -756,6 +897,7 @@ void mainInitWindowCommon(Base::Window &win)
 
 	setupFont();
 	popup.init();
+	frameTelemetryOverlay.init();
 	#ifdef CONFIG_EMUFRAMEWORK_VCONTROLS
 	initVControls();
 	EmuControls::updateVControlImg();
@@ -882,6 +1024,7 @@ void placeElements()
 	logMsg("placing app elements");
 	TableView::setDefaultXIndent(mainWin.projectionPlane);
 	popup.place(emuWin->projectionPlane);
+	frameTelemetryOverlay.place(emuWin->projectionPlane);
 	placeEmuViews();
 	viewStack.place(mainWin.viewport().bounds(), mainWin.projectionPlane);
 	modalViewController.place(mainWin.viewport().bounds(), mainWin.projectionPlane);
@@ -927,6 +1070,10 @@ namespace Base
 void onInit(int argc, char** argv)
 {
 	EmuSystem::onInit();
+	if(Base::isHeadless())
+	{
+		Base::exit(runHeadlessBenchmark(argc, argv));
+	}
 	mainInitCommon(argc, argv);
 }
 
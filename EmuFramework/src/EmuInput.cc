@@ -22,6 +22,7 @@
 #include <emuframework/EmuOptions.hh>
 #include <emuframework/EmuApp.hh>
 #include <emuframework/InputManagerView.hh>
+#include <emuframework/EmuThread.hh>
 #ifdef CONFIG_EMUFRAMEWORK_VCONTROLS
 #include <emuframework/VController.hh>
 SysVController vController;
@@ -201,7 +202,7 @@ void processRelPtr(Input::Event e)
 	{
 		//logMsg("reversed trackball X direction");
 		relPtr.x = e.x;
-		EmuSystem::handleInputAction(Input::RELEASED, relPtr.xAction);
+		emuThread.handleInputAction(Input::RELEASED, relPtr.xAction);
 	}
 	else
 		relPtr.x += e.x;
@@ -209,14 +210,14 @@ void processRelPtr(Input::Event e)
 	if(e.x)
 	{
 		relPtr.xAction = EmuSystem::translateInputAction(e.x > 0 ? EmuControls::systemKeyMapStart+1 : EmuControls::systemKeyMapStart+3);
-		EmuSystem::handleInputAction(Input::PUSHED, relPtr.xAction);
+		emuThread.handleInputAction(Input::PUSHED, relPtr.xAction);
 	}
 
 	if(relPtr.y != 0 && sign(relPtr.y) != sign(e.y))
 	{
 		//logMsg("reversed trackball Y direction");
 		relPtr.y = e.y;
-		EmuSystem::handleInputAction(Input::RELEASED, relPtr.yAction);
+		emuThread.handleInputAction(Input::RELEASED, relPtr.yAction);
 	}
 	else
 		relPtr.y += e.y;
@@ -224,7 +225,7 @@ void processRelPtr(Input::Event e)
 	if(e.y)
 	{
 		relPtr.yAction = EmuSystem::translateInputAction(e.y > 0 ? EmuControls::systemKeyMapStart+2 : EmuControls::systemKeyMapStart);
-		EmuSystem::handleInputAction(Input::PUSHED, relPtr.yAction);
+		emuThread.handleInputAction(Input::PUSHED, relPtr.yAction);
 	}
 
 	//logMsg("trackball event %d,%d, rel ptr %d,%d", e.x, e.y, relPtr.x, relPtr.y);
@@ -250,12 +251,12 @@ void commonUpdateInput()
 			if(turboClock == 0)
 			{
 				//logMsg("turbo push for player %d, action %d", e.player, e.action);
-				EmuSystem::handleInputAction(Input::PUSHED, e.action);
+				emuThread.handleInputAction(Input::PUSHED, e.action);
 			}
 			else if(turboClock == turboFrames/2)
 			{
 				//logMsg("turbo release for player %d, action %d", e.player, e.action);
-				EmuSystem::handleInputAction(Input::RELEASED, e.action);
+				emuThread.handleInputAction(Input::RELEASED, e.action);
 			}
 		}
 	}
@@ -273,13 +274,13 @@ void commonUpdateInput()
 	{
 		relPtr.x = applyRelPointerDecel(relPtr.x);
 		if(!relPtr.x)
-			EmuSystem::handleInputAction(Input::RELEASED, relPtr.xAction);
+			emuThread.handleInputAction(Input::RELEASED, relPtr.xAction);
 	}
 	if(relPtr.y)
 	{
 		relPtr.y = applyRelPointerDecel(relPtr.y);
 		if(!relPtr.y)
-			EmuSystem::handleInputAction(Input::RELEASED, relPtr.yAction);
+			emuThread.handleInputAction(Input::RELEASED, relPtr.yAction);
 	}
 #endif
 }
@@ -19,6 +19,8 @@
 #include <emuframework/EmuApp.hh>
 #include <imagine/gui/AlertView.hh>
 #include <emuframework/FilePicker.hh>
+#include <emuframework/Rewind.hh>
+#include <emuframework/EmuThread.hh>
 
 extern bool touchControlsAreOn;
 bool touchControlsApplicable();
@@ -42,6 +44,7 @@ void EmuInputView::resetInput()
 	vController.resetInput();
 	#endif
 	ffKeyPushed = ffToggleActive = false;
+	rewindActive = false;
 }
 
 void EmuInputView::updateFastforward()
@@ -238,6 +241,17 @@ void EmuInputView::inputEvent(Input::Event e)
 						return;
 					}
 
+					bcase guiKeyIdxRewind:
+					{
+						if(e.state == Input::PUSHED && !emuRewind.isEnabled())
+						{
+							popup.post("Set Rewind Memory in System Options to enable rewind");
+							return;
+						}
+						rewindActive = e.state == Input::PUSHED;
+						logMsg("rewind key state: %d", rewindActive);
+					}
+
 					bdefault:
 					{
 						//logMsg("action %d, %d", emuKey, state);
@@ -255,7 +269,7 @@ void EmuInputView::inputEvent(Input::Event e)
 								turboActions.removeEvent(sysAction);
 							}
 						}
-						EmuSystem::handleInputAction(e.state, sysAction);
+						emuThread.handleInputAction(e.state, sysAction);
 					}
 				}
 			}
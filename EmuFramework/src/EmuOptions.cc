@@ -19,6 +19,7 @@
 #include <emuframework/EmuApp.hh>
 #include <emuframework/VideoImageEffect.hh>
 #include <emuframework/VController.hh>
+#include <emuframework/RunAhead.hh>
 #ifdef CONFIG_EMUFRAMEWORK_VCONTROLS
 extern SysVController vController;
 #endif
@@ -47,6 +48,7 @@ bool optionOrientationIsValid(uint32 val)
 Byte1Option optionAutoSaveState(CFGKEY_AUTO_SAVE_STATE, 1);
 Byte1Option optionConfirmAutoLoadState(CFGKEY_CONFIRM_AUTO_LOAD_STATE, 1);
 Byte1Option optionSound(CFGKEY_SOUND, 1);
+Byte1Option optionAudioRateControl(CFGKEY_AUDIO_RATE_CONTROL, 1);
 
 #ifdef CONFIG_AUDIO_LATENCY_HINT
 Byte1Option optionSoundBuffers(CFGKEY_SOUND_BUFFERS,
@@ -92,7 +94,18 @@ Byte1Option optionIdleDisplayPowerSave(CFGKEY_IDLE_DISPLAY_POWER_SAVE, 1, !Confi
 Byte1Option optionHideStatusBar(CFGKEY_HIDE_STATUS_BAR, 1, (!Config::envIsAndroid || Config::MACHINE_IS_OUYA) && !Config::envIsIOS);
 OptionSwappedGamepadConfirm optionSwappedGamepadConfirm(CFGKEY_SWAPPED_GAMEPAD_CONFIM, Input::SWAPPED_GAMEPAD_CONFIRM_DEFAULT);
 Byte1Option optionConfirmOverwriteState(CFGKEY_CONFIRM_OVERWRITE_STATE, 1, 0);
-Byte1Option optionFastForwardSpeed(CFGKEY_FAST_FORWARD_SPEED, 4, 0, optionIsValidWithMinMax<2, 7>);
+static bool optionFastForwardSpeedIsValid(uint8 val)
+{
+	return val == FAST_FORWARD_SPEED_UNCAPPED || optionIsValidWithMinMax<2, 7>(val);
+}
+Byte1Option optionFastForwardSpeed(CFGKEY_FAST_FORWARD_SPEED, 4, 0, optionFastForwardSpeedIsValid);
+Byte1Option optionFastForwardAudio(CFGKEY_FAST_FORWARD_AUDIO, 1);
+// Store in MiB, 0 disables rewind
+Byte2Option optionRewindMemory(CFGKEY_REWIND_MEMORY, 0, 0, optionIsValidWithMax<512, uint16>);
+Byte1Option optionRewindInterval(CFGKEY_REWIND_INTERVAL, 4, 0, optionIsValidWithMinMax<1, 60>);
+Byte1Option optionEmuThread(CFGKEY_EMU_THREAD, 0, 0);
+Byte1Option optionRunAheadFrames(CFGKEY_RUN_AHEAD_FRAMES, 0, 0, optionIsValidWithMax<EmuRunAhead::MAX_FRAMES>);
+Byte1Option optionFrameTelemetry(CFGKEY_FRAME_TELEMETRY, 0);
 #ifdef CONFIG_INPUT_DEVICE_HOTSWAP
 Byte1Option optionNotifyInputDeviceChange(CFGKEY_NOTIFY_INPUT_DEVICE_CHANGE, Config::Input::DEVICE_HOTSWAP, !Config::Input::DEVICE_HOTSWAP);
 #endif
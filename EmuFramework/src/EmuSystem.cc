@@ -18,12 +18,17 @@
 #include <emuframework/EmuApp.hh>
 #include <emuframework/FileUtils.hh>
 #include <emuframework/FilePicker.hh>
+#include <emuframework/Rewind.hh>
+#include <emuframework/Benchmark.hh>
+#include <emuframework/EmuThread.hh>
+#include <emuframework/AudioRateControl.hh>
 #include <imagine/fs/ArchiveFS.hh>
 #include <imagine/audio/Audio.hh>
 #include <imagine/util/assume.h>
 #include <imagine/util/math/int.hh>
 #include <algorithm>
 #include <string>
+#include <zlib.h>
 
 EmuSystem::State EmuSystem::state = EmuSystem::State::OFF;
 FS::PathString EmuSystem::gamePath_{};
@@ -51,6 +56,8 @@ double EmuSystem::frameTimePAL = 1./50.;
 [[gnu::weak]] bool EmuSystem::handlesArchiveFiles = false;
 [[gnu::weak]] bool EmuSystem::handlesGenericIO = true;
 [[gnu::weak]] bool EmuSystem::hasCheats = false;
+[[gnu::weak]] bool EmuSystem::hasRunAhead = true;
+[[gnu::weak]] bool EmuSystem::gzipsStateFiles = false;
 
 void saveAutoStateFromTimer();
 
@@ -86,6 +93,7 @@ void EmuSystem::startSound()
 			Audio::setHintOutputLatency(wantedLatency);
 			#endif
 			Audio::openPcm(pcmFormat);
+			emuAudioRateControl.reset(pcmFormat.channels, Audio::bufferFrames());
 		}
 		else if(Audio::framesFree() <= (int)audioFramesPerVideoFrame)
 			Audio::resumePcm();
@@ -103,7 +111,15 @@ void EmuSystem::stopSound()
 
 void EmuSystem::writeSound(const void *samples, uint framesToWrite)
 {
-	Audio::writePcm(samples, framesToWrite);
+	if(optionAudioRateControl && pcmFormat.sample.bits == 16 && Audio::isPlaying())
+	{
+		emuAudioRateControl.updateRatio(Audio::framesFree());
+		const int16_t *resampled;
+		auto frames = emuAudioRateControl.resample((const int16_t*)samples, framesToWrite, resampled);
+		Audio::writePcm(resampled, frames);
+	}
+	else
+		Audio::writePcm(samples, framesToWrite);
 	if(!Audio::isPlaying() && Audio::framesFree() <= (int)audioFramesPerVideoFrame)
 	{
 		logMsg("starting audio playback with %d frames free in buffer", Audio::framesFree());
@@ -121,6 +137,114 @@ void EmuSystem::commitSound(Audio::BufferContext buffer, uint frames)
 	}
 }
 
+static bool isGzipData(const uint8_t *data, size_t size)
+{
+	return size > 18 && data[0] == 0x1f && data[1] == 0x8b && data[2] == Z_DEFLATED;
+}
+
+// older versions of some cores wrote gzip-compressed state files,
+// inflate them so they can be passed to loadStateFromBuffer()
+static bool inflateGzipData(const uint8_t *data, size_t size, std::vector<uint8_t> &out)
+{
+	// uncompressed size modulo 2^32 is stored in the last 4 bytes
+	uint32_t sizeHint = data[size-4] | (data[size-3] << 8) | (data[size-2] << 16) | (data[size-1] << 24);
+	out.resize(std::max(sizeHint, (uint32_t)size));
+	z_stream strm{};
+	if(inflateInit2(&strm, 16 + MAX_WBITS) != Z_OK)
+		return false;
+	strm.next_in = (Bytef*)data;
+	strm.avail_in = size;
+	int ret;
+	do
+	{
+		if(strm.total_out == out.size())
+			out.resize(out.size() * 2);
+		strm.next_out = &out[strm.total_out];
+		strm.avail_out = out.size() - strm.total_out;
+		ret = inflate(&strm, Z_NO_FLUSH);
+	} while(ret == Z_OK);
+	out.resize(strm.total_out);
+	inflateEnd(&strm);
+	return ret == Z_STREAM_END;
+}
+
+static bool deflateGzipData(const uint8_t *data, size_t size, std::vector<uint8_t> &out)
+{
+	z_stream strm{};
+	if(deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+		return false;
+	// gzip header & trailer aren't included in deflateBound()
+	out.resize(deflateBound(&strm, size) + 18);
+	strm.next_in = (Bytef*)data;
+	strm.avail_in = size;
+	strm.next_out = out.data();
+	strm.avail_out = out.size();
+	int ret = deflate(&strm, Z_FINISH);
+	out.resize(strm.total_out);
+	deflateEnd(&strm);
+	return ret == Z_STREAM_END;
+}
+
+std::error_code EmuSystem::saveState()
+{
+	auto saveStr = sprintStateFilename(saveStateSlot);
+	return saveStateToFile(saveStr.data());
+}
+
+std::system_error EmuSystem::loadState(int slot)
+{
+	auto saveStr = sprintStateFilename(slot);
+	if(!FS::exists(saveStr))
+		return {{ENOENT, std::system_category()}};
+	return loadStateFromFile(saveStr.data());
+}
+
+std::error_code EmuSystem::saveStateToFile(const char *path)
+{
+	emuThread.waitIdle();
+	std::vector<uint8_t> buff;
+	auto ec = saveStateToFileBuffer(buff);
+	if(ec)
+		return ec;
+	fixFilePermissions(path);
+	logMsg("writing %d byte state to %s", (int)buff.size(), path);
+	return writeToNewFile(path, buff.data(), buff.size());
+}
+
+std::system_error EmuSystem::loadStateFromFile(const char *path)
+{
+	logMsg("loading state %s", path);
+	emuThread.waitIdle();
+	FileIO f;
+	auto ec = f.open(path);
+	if(ec)
+		return {ec};
+	auto data = (const uint8_t*)f.mmapConst();
+	auto size = f.size();
+	if(!data || !size)
+		return {{EIO, std::system_category()}};
+	willLoadStateFromFile();
+	if(isGzipData(data, size))
+	{
+		std::vector<uint8_t> inflatedData;
+		if(!inflateGzipData(data, size, inflatedData))
+			return {{EILSEQ, std::system_category()}, "Invalid compressed data in file"};
+		return loadStateFromBuffer(inflatedData.data(), inflatedData.size());
+	}
+	return loadStateFromBuffer(data, size);
+}
+
+void EmuSystem::saveAutoState()
+{
+	if(gameIsRunning() && optionAutoSaveState)
+	{
+		auto saveStr = sprintStateFilename(-1);
+		auto ec = saveStateToFile(saveStr.data());
+		if(ec)
+			logErr("error writing auto-save state %s", saveStr.data());
+	}
+}
+
 bool EmuSystem::stateExists(int slot)
 {
 	auto saveStr = sprintStateFilename(slot);
@@ -324,6 +448,7 @@ FS::PathString EmuSystem::baseDefaultGameSavePath()
 
 void EmuSystem::closeGame(bool allowAutosaveState)
 {
+	emuThread.waitIdle();
 	if(gameIsRunning())
 	{
 		if(Audio::isOpen())
@@ -332,6 +457,7 @@ void EmuSystem::closeGame(bool allowAutosaveState)
 			saveAutoState();
 		logMsg("closing game %s", gameName_.data());
 		closeSystem();
+		emuRewind.reset();
 		clearGamePaths();
 		cancelAutoSaveStateTimer();
 		viewStack.navView()->showRightBtn(false);
@@ -363,13 +489,7 @@ void EmuSystem::start()
 
 IG::Time EmuSystem::benchmark()
 {
-	auto now = IG::Time::now();
-	iterateTimes(180, i)
-	{
-		runFrame(0, 1, 0);
-	}
-	auto after = IG::Time::now();
-	return after-now;
+	return runBenchmark(180, true, false).total;
 }
 
 void EmuSystem::configFrameTime()
@@ -443,6 +563,21 @@ bool EmuSystem::setFrameTime(VideoSystem system, double time)
 
 [[gnu::weak]] void EmuSystem::onCustomizeNavView(EmuNavView &view) {}
 
+[[gnu::weak]] void EmuSystem::willLoadStateFromFile() {}
+
+[[gnu::weak]] std::error_code EmuSystem::saveStateToFileBuffer(std::vector<uint8_t> &buff)
+{
+	if(!gzipsStateFiles)
+		return saveStateToBuffer(buff);
+	std::vector<uint8_t> stateData;
+	auto ec = saveStateToBuffer(stateData);
+	if(ec)
+		return ec;
+	if(!deflateGzipData(stateData.data(), stateData.size(), buff))
+		return {EIO, std::system_category()};
+	return {};
+}
+
 [[gnu::weak]] FS::PathString EmuSystem::willLoadGameFromPath(FS::PathString path)
 {
 	return path;
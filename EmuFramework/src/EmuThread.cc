@@ -0,0 +1,219 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <emuframework/EmuThread.hh>
+#include <emuframework/EmuSystem.hh>
+#include <emuframework/Rewind.hh>
+#include <emuframework/RunAhead.hh>
+#include <emuframework/FrameTelemetry.hh>
+#include <emuframework/EmuOptions.hh>
+#include <imagine/audio/Audio.hh>
+#include <imagine/logger/logger.h>
+#include <cassert>
+
+EmuThread emuThread{};
+
+void EmuThread::start()
+{
+	if(active)
+		return;
+	logMsg("starting emulation thread");
+	quit = false;
+	IG::makeDetachedThread(
+		[this]()
+		{
+			run();
+		});
+	// wait for the thread to record its ID
+	jobDoneSem.wait();
+	active = true;
+}
+
+void EmuThread::stop()
+{
+	if(!active)
+		return;
+	logMsg("stopping emulation thread");
+	waitIdle();
+	quit = true;
+	jobSem.notify();
+	jobDoneSem.wait();
+	active = false;
+	threadID = {};
+}
+
+bool EmuThread::isEmuThread() const
+{
+	return active && IG::this_thread::get_id() == threadID;
+}
+
+void EmuThread::run()
+{
+	threadID = IG::this_thread::get_id();
+	jobDoneSem.notify();
+	while(true)
+	{
+		jobSem.wait();
+		if(quit)
+		{
+			jobDoneSem.notify();
+			return;
+		}
+		runJob();
+		busy.store(false, std::memory_order_release);
+		jobDoneSem.notify();
+	}
+}
+
+void EmuThread::runJob()
+{
+	drainInputQueue();
+	if(job.uncapped)
+	{
+		runUncapped();
+		return;
+	}
+	auto frames = job.frames;
+	if(job.rewind)
+	{
+		if(!emuRewind.rewind())
+			return;
+		frames = 1;
+	}
+	if(!frames)
+		return;
+	emuFrameTelemetry.timeRun(
+		[&]()
+		{
+			iterateTimes(frames - 1, i)
+			{
+				EmuSystem::runFrame(false, false, job.renderAudio);
+			}
+			if(job.runAhead)
+				emuRunAhead.runFrame(true, true, job.renderAudio);
+			else
+				EmuSystem::runFrame(true, true, job.renderAudio);
+		});
+	if(!job.rewind)
+		emuRewind.addFrames(frames);
+}
+
+void EmuThread::runUncapped()
+{
+	logMsg("running uncapped");
+	while(!uncappedQuit.load(std::memory_order_acquire))
+	{
+		bool render = uncappedFrameRequested.exchange(false, std::memory_order_acquire);
+		// only write a frame's audio when the buffer has room for it so the output
+		// plays back at normal pitch with the skipped frames' audio dropped
+		bool renderAudio = job.renderAudio && Audio::isOpen()
+			&& Audio::framesFree() >= (int)EmuSystem::audioFramesPerVideoFrame * 2;
+		emuFrameTelemetry.timeRun(
+			[=]()
+			{
+				EmuSystem::runFrame(render, render, renderAudio);
+			});
+		emuRewind.addFrames(1);
+		uncappedFrames.fetch_add(1, std::memory_order_relaxed);
+		drainInputQueue();
+	}
+	logMsg("stopped uncapped run");
+}
+
+bool EmuThread::postJob(Job job)
+{
+	assert(active);
+	if(jobPending)
+	{
+		if(isBusy())
+			return false; // previous frame hasn't finished, drop this one
+		jobDoneSem.wait();
+		jobPending = false;
+	}
+	this->job = job;
+	if(job.uncapped)
+	{
+		uncappedQuit.store(false, std::memory_order_relaxed);
+		uncappedFrameRequested.store(true, std::memory_order_relaxed);
+	}
+	jobPending = true;
+	busy.store(true, std::memory_order_release);
+	jobSem.notify();
+	return true;
+}
+
+void EmuThread::waitIdle()
+{
+	if(!active || isEmuThread())
+		return;
+	if(jobPending)
+	{
+		if(job.uncapped)
+			uncappedQuit.store(true, std::memory_order_release);
+		jobDoneSem.wait();
+		jobPending = false;
+	}
+	// the thread is idle so any queued input can be applied from this one
+	drainInputQueue();
+}
+
+void EmuThread::requestUncappedFrame()
+{
+	uncappedFrameRequested.store(true, std::memory_order_release);
+}
+
+void EmuThread::stopUncapped()
+{
+	if(isRunningUncapped())
+		waitIdle();
+}
+
+uint EmuThread::takeUncappedFrames()
+{
+	return uncappedFrames.exchange(0, std::memory_order_relaxed);
+}
+
+void EmuThread::handleInputAction(uint state, uint action)
+{
+	if(!active)
+	{
+		EmuSystem::handleInputAction(state, action);
+		return;
+	}
+	auto head = inputHead.load(std::memory_order_relaxed);
+	auto nextHead = (head + 1) % INPUT_QUEUE_SIZE;
+	if(nextHead == inputTail.load(std::memory_order_acquire))
+	{
+		// queue is full, let the thread catch up and apply the backlog
+		waitIdle();
+		EmuSystem::handleInputAction(state, action);
+		return;
+	}
+	inputQueue[head] = {state, action};
+	inputHead.store(nextHead, std::memory_order_release);
+}
+
+void EmuThread::drainInputQueue()
+{
+	auto tail = inputTail.load(std::memory_order_relaxed);
+	auto head = inputHead.load(std::memory_order_acquire);
+	while(tail != head)
+	{
+		auto &e = inputQueue[tail];
+		EmuSystem::handleInputAction(e.state, e.action);
+		tail = (tail + 1) % INPUT_QUEUE_SIZE;
+	}
+	inputTail.store(tail, std::memory_order_release);
+}
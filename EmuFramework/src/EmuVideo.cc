@@ -17,6 +17,7 @@
 #include <emuframework/EmuOptions.hh>
 #include <emuframework/EmuApp.hh>
 #include <emuframework/Screenshot.hh>
+#include <emuframework/EmuThread.hh>
 
 void EmuVideo::initPixmap(char *pixBuff, IG::PixelFormat format, uint x, uint y, uint pitch)
 {
@@ -62,6 +63,12 @@ void EmuVideo::resizeImage(uint xO, uint yO, uint x, uint y, uint totalX, uint t
 	else
 		basePix = {{{(int)totalX, (int)totalY}, vidPix.format()}, pixBuff};
 	vidPix = basePix.subPixmap({(int)xO, (int)yO}, {(int)x, (int)y});
+	if(Base::isHeadless() || emuThread.isEmuThread())
+	{
+		// no texture to update without a window system,
+		// or the main thread handles it when the next frame is committed
+		return;
+	}
 	if(!vidImg)
 	{
 		reinitImage();
@@ -100,8 +107,48 @@ void EmuVideo::updateImage()
 	vidImg.write(0, vidPix, {}, vidPixAlign);
 }
 
+void EmuVideo::commitThreadFrame()
+{
+	auto &frame = threadFrame[threadBackFrame];
+	if(frame != vidPix)
+	{
+		frame = IG::MemPixmap{vidPix};
+	}
+	frame.write(vidPix);
+	threadBackFrame = threadReadyFrame.exchange(threadBackFrame | THREAD_FRAME_UPDATED, std::memory_order_acq_rel)
+		& ~THREAD_FRAME_UPDATED;
+}
+
+bool EmuVideo::hasThreadFrame() const
+{
+	return threadReadyFrame.load(std::memory_order_acquire) & THREAD_FRAME_UPDATED;
+}
+
+bool EmuVideo::updateImageFromThreadFrame()
+{
+	if(!hasThreadFrame())
+		return false;
+	threadFrontFrame = threadReadyFrame.exchange(threadFrontFrame, std::memory_order_acq_rel)
+		& ~THREAD_FRAME_UPDATED;
+	auto &frame = threadFrame[threadFrontFrame];
+	if(!vidImg)
+		return false;
+	if(frame != vidImg.usedPixmapDesc())
+	{
+		// the emulation thread resized the image since the last frame
+		vidImg.setFormat(frame, 1);
+		vidPixAlign = vidImg.bestAlignment(frame);
+		emuVideoLayer.resetImage();
+		if((uint)optionImageZoom > 100)
+			placeEmuViews();
+	}
+	vidImg.write(0, frame, {}, vidPixAlign);
+	return true;
+}
+
 void EmuVideo::takeGameScreenshot()
 {
+	emuThread.waitIdle();
 	FS::PathString path;
 	int screenshotNum = sprintScreenshotFilename(path);
 	if(screenshotNum == -1)
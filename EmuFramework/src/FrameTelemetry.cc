@@ -0,0 +1,174 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <emuframework/FrameTelemetry.hh>
+#include <emuframework/EmuSystem.hh>
+#include <imagine/audio/Audio.hh>
+#include <imagine/gui/View.hh>
+#include <imagine/util/string.h>
+#include <algorithm>
+#include <cstring>
+
+EmuFrameTelemetry emuFrameTelemetry{};
+FrameTelemetryOverlay frameTelemetryOverlay{};
+static constexpr uint overlayUpdateFrames = 30;
+static constexpr uint overlaySummaryFrames = 120;
+
+void EmuFrameTelemetry::setEnabled(bool on)
+{
+	if(on == enabled)
+		return;
+	enabled = on;
+	reset();
+}
+
+void EmuFrameTelemetry::reset()
+{
+	written.store(0, std::memory_order_release);
+	runUSecs = 0;
+	uploadUSecs = 0;
+	hasCurrent = false;
+}
+
+void EmuFrameTelemetry::beginFrame(Base::FrameTimeBase timestamp, uint framesElapsed, uint framesRun, uint framesSkipped)
+{
+	if(!enabled)
+		return;
+	if(hasCurrent)
+	{
+		current.runUSecs = runUSecs.exchange(0, std::memory_order_relaxed);
+		current.uploadUSecs = uploadUSecs.exchange(0, std::memory_order_relaxed);
+		auto idx = written.load(std::memory_order_relaxed);
+		sample[idx % MAX_SAMPLES] = current;
+		written.store(idx + 1, std::memory_order_release);
+	}
+	current.timestamp = timestamp;
+	current.framesElapsed = std::min(framesElapsed, 0xFFFFu);
+	current.framesRun = std::min(framesRun, 0xFFFFu);
+	current.framesSkipped = std::min(framesSkipped, 0xFFFFu);
+	current.audioFramesFree = Audio::isOpen() ? Audio::framesFree() : -1;
+	hasCurrent = true;
+}
+
+void EmuFrameTelemetry::addRunTime(IG::Time time)
+{
+	if(enabled)
+		runUSecs.fetch_add(time.uSecs(), std::memory_order_relaxed);
+}
+
+void EmuFrameTelemetry::addUploadTime(IG::Time time)
+{
+	if(enabled)
+		uploadUSecs.fetch_add(time.uSecs(), std::memory_order_relaxed);
+}
+
+uint EmuFrameTelemetry::copySamples(Sample *out, uint max) const
+{
+	auto end = written.load(std::memory_order_acquire);
+	auto count = std::min(std::min(end, max), (uint)MAX_SAMPLES);
+	for(auto i = end - count; i != end; i++)
+	{
+		*out++ = sample[i % MAX_SAMPLES];
+	}
+	return count;
+}
+
+void EmuFrameTelemetry::writeCSV(FILE *file) const
+{
+	std::array<Sample, MAX_SAMPLES> s;
+	auto count = copySamples(s.data(), s.size());
+	fprintf(file, "timestampSecs,frameTimeMSecs,framesElapsed,framesRun,framesSkipped,"
+		"runFrameMSecs,textureUploadMSecs,audioFramesFree\n");
+	for(uint i = 0; i < count; i++)
+	{
+		auto &e = s[i];
+		double frameTime = i ? Base::frameTimeBaseToSecsDec(e.timestamp - s[i - 1].timestamp) * 1000. : 0.;
+		fprintf(file, "%.6f,%.3f,%u,%u,%u,%.3f,%.3f,%d\n",
+			Base::frameTimeBaseToSecsDec(e.timestamp), frameTime,
+			e.framesElapsed, e.framesRun, e.framesSkipped,
+			e.runUSecs / 1000., e.uploadUSecs / 1000., e.audioFramesFree);
+	}
+}
+
+void FrameTelemetryOverlay::init()
+{
+	text = {nullptr, View::defaultFace};
+	text.setString(str.data());
+}
+
+void FrameTelemetryOverlay::place(const Gfx::ProjectionPlane &projP)
+{
+	this->projP = projP;
+	text.maxLineSize = projP.w;
+	if(strlen(str.data()))
+		text.compile(projP);
+}
+
+void FrameTelemetryOverlay::update()
+{
+	std::array<EmuFrameTelemetry::Sample, overlaySummaryFrames> s;
+	auto count = emuFrameTelemetry.copySamples(s.data(), s.size());
+	if(count < 2)
+	{
+		string_copy(str, "Collecting frame telemetry...");
+		return;
+	}
+	Base::FrameTimeBase maxFrameTime = 0;
+	uint64_t runUSecs = 0, uploadUSecs = 0, maxRunUSecs = 0;
+	uint elapsed = 0, run = 0, skipped = 0, dropped = 0;
+	int minAudioFree = s[0].audioFramesFree;
+	for(uint i = 0; i < count; i++)
+	{
+		auto &e = s[i];
+		if(i)
+			maxFrameTime = std::max(maxFrameTime, e.timestamp - s[i - 1].timestamp);
+		runUSecs += e.runUSecs;
+		uploadUSecs += e.uploadUSecs;
+		maxRunUSecs = std::max(maxRunUSecs, (uint64_t)e.runUSecs);
+		elapsed += e.framesElapsed;
+		run += e.framesRun;
+		skipped += e.framesSkipped;
+		if(e.framesElapsed > e.framesRun)
+			dropped += e.framesElapsed - e.framesRun;
+		minAudioFree = std::min(minAudioFree, e.audioFramesFree);
+	}
+	auto avgFrameTime = Base::frameTimeBaseToSecsDec(s[count - 1].timestamp - s[0].timestamp) / (count - 1);
+	string_printf(str, "Frame %.2fms (max %.2fms)\nRun %.2fms (max %.2fms) Upload %.2fms\n"
+		"Elapsed %u Emulated %u Skipped %u Dropped %u\nAudio frames free %d (min %d)",
+		avgFrameTime * 1000., Base::frameTimeBaseToSecsDec(maxFrameTime) * 1000.,
+		runUSecs / 1000. / count, maxRunUSecs / 1000., uploadUSecs / 1000. / count,
+		elapsed, run, skipped, dropped, s[count - 1].audioFramesFree, minAudioFree);
+}
+
+void FrameTelemetryOverlay::draw()
+{
+	using namespace Gfx;
+	if(!framesUntilUpdate)
+	{
+		update();
+		text.compile(projP);
+		framesUntilUpdate = overlayUpdateFrames;
+	}
+	framesUntilUpdate--;
+	noTexProgram.use(projP.makeTranslate());
+	setBlendMode(BLEND_MODE_ALPHA);
+	setColor(0, 0, 0, .5);
+	Gfx::GCRect rect(-projP.wHalf(), projP.hHalf() - text.ySize,
+		-projP.wHalf() + text.xSize, projP.hHalf());
+	GeomRect::draw(rect);
+	setColor(1., 1., 1., 1.);
+	texAlphaProgram.use();
+	text.draw(-projP.wHalf(), projP.hHalf(), LT2DO, projP);
+}
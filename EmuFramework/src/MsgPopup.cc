@@ -18,6 +18,7 @@
 #include <emuframework/EmuApp.hh>
 #include <imagine/gui/View.hh>
 #include <string>
+#include <cstdio>
 
 using namespace Base;
 
@@ -56,6 +57,11 @@ void MsgPopup::unpost()
 void MsgPopup::postContent(int secs, bool error)
 {
 	assert(strlen(str.data()));
+	if(Base::isHeadless())
+	{
+		fprintf(stderr, "%s\n", str.data());
+		return;
+	}
 	mainWin.win.postDraw();
 	logMsg("%s", str.data());
 	text.compile(projP);
@@ -16,6 +16,7 @@
 #include <emuframework/OptionView.hh>
 #include <emuframework/EmuApp.hh>
 #include <emuframework/FilePicker.hh>
+#include <emuframework/FrameTelemetry.hh>
 #include <imagine/gui/TextEntry.hh>
 #include <algorithm>
 
@@ -646,6 +647,7 @@ void AudioOptionView::loadStockItems()
 	#ifdef CONFIG_AUDIO_LATENCY_HINT
 	item.emplace_back(&soundBuffers);
 	#endif
+	item.emplace_back(&audioRateControl);
 	#ifdef EMU_FRAMEWORK_STRICT_UNDERRUN_CHECK_OPTION
 	item.emplace_back(&sndUnderrunCheck);
 	#endif
@@ -663,6 +665,14 @@ void SystemOptionView::loadStockItems()
 	item.emplace_back(&savePath);
 	item.emplace_back(&checkSavePathWriteAccess);
 	item.emplace_back(&fastForwardSpeed);
+	item.emplace_back(&fastForwardAudio);
+	item.emplace_back(&rewindMemory);
+	item.emplace_back(&rewindInterval);
+	item.emplace_back(&separateEmuThread);
+	if(EmuSystem::hasRunAhead)
+		item.emplace_back(&runAheadFrames);
+	item.emplace_back(&frameTelemetry);
+	item.emplace_back(&saveFrameTelemetry);
 	#ifdef __ANDROID__
 	item.emplace_back(&processPriority);
 	if(!optionFakeUserActivity.isConst)
@@ -1219,6 +1229,15 @@ AudioOptionView::AudioOptionView(Base::Window &win, bool customMenu):
 		{
 			return audioRateItem[idx];
 		}
+	},
+	audioRateControl
+	{
+		"Dynamic Rate Control",
+		(bool)optionAudioRateControl,
+		[this](BoolMenuItem &item, View &, Input::Event e)
+		{
+			optionAudioRateControl = item.flipBoolValue(*this);
+		}
 	}
 	#ifdef EMU_FRAMEWORK_STRICT_UNDERRUN_CHECK_OPTION
 	,sndUnderrunCheck
@@ -1332,6 +1351,7 @@ SystemOptionView::SystemOptionView(Base::Window &win, bool customMenu):
 		{"6x", [this]() { optionFastForwardSpeed = 5; }},
 		{"7x", [this]() { optionFastForwardSpeed = 6; }},
 		{"8x", [this]() { optionFastForwardSpeed = 7; }},
+		{"Uncapped", [this]() { optionFastForwardSpeed = FAST_FORWARD_SPEED_UNCAPPED; }},
 	},
 	fastForwardSpeed
 	{
@@ -1342,9 +1362,124 @@ SystemOptionView::SystemOptionView(Base::Window &win, bool customMenu):
 			{
 				return optionFastForwardSpeed - MIN_FAST_FORWARD_SPEED;
 			}
+			if(optionFastForwardSpeed == FAST_FORWARD_SPEED_UNCAPPED)
+			{
+				return 6;
+			}
 			return 0;
 		}(),
 		fastForwardSpeedItem
+	},
+	fastForwardAudio
+	{
+		"Uncapped Fast Forward Audio",
+		(bool)optionFastForwardAudio,
+		[this](BoolMenuItem &item, View &, Input::Event e)
+		{
+			optionFastForwardAudio = item.flipBoolValue(*this);
+		}
+	},
+	rewindMemoryItem
+	{
+		{"Off", []() { optionRewindMemory = 0; }},
+		{"16MB", []() { optionRewindMemory = 16; }},
+		{"32MB", []() { optionRewindMemory = 32; }},
+		{"64MB", []() { optionRewindMemory = 64; }},
+		{"128MB", []() { optionRewindMemory = 128; }},
+		{"256MB", []() { optionRewindMemory = 256; }},
+	},
+	rewindMemory
+	{
+		"Rewind Memory",
+		[]() -> uint
+		{
+			switch(optionRewindMemory)
+			{
+				default: return 0;
+				case 16: return 1;
+				case 32: return 2;
+				case 64: return 3;
+				case 128: return 4;
+				case 256: return 5;
+			}
+		}(),
+		rewindMemoryItem
+	},
+	rewindIntervalItem
+	{
+		{"1 Frame", []() { optionRewindInterval = 1; }},
+		{"2 Frames", []() { optionRewindInterval = 2; }},
+		{"4 Frames", []() { optionRewindInterval = 4; }},
+		{"8 Frames", []() { optionRewindInterval = 8; }},
+	},
+	rewindInterval
+	{
+		"Rewind Snapshot Interval",
+		[]() -> uint
+		{
+			switch(optionRewindInterval)
+			{
+				case 1: return 0;
+				case 2: return 1;
+				default: return 2;
+				case 8: return 3;
+			}
+		}(),
+		rewindIntervalItem
+	},
+	separateEmuThread
+	{
+		"Run Emulation On Separate Thread",
+		(bool)optionEmuThread,
+		[this](BoolMenuItem &item, View &, Input::Event e)
+		{
+			optionEmuThread = item.flipBoolValue(*this);
+		}
+	},
+	runAheadFramesItem
+	{
+		{"Off", []() { optionRunAheadFrames = 0; }},
+		{"1 Frame", []() { optionRunAheadFrames = 1; }},
+		{"2 Frames", []() { optionRunAheadFrames = 2; }},
+		{"3 Frames", []() { optionRunAheadFrames = 3; }},
+	},
+	runAheadFrames
+	{
+		"Run-ahead",
+		(uint)optionRunAheadFrames,
+		runAheadFramesItem
+	},
+	frameTelemetry
+	{
+		"Show Frame Telemetry",
+		(bool)optionFrameTelemetry,
+		[this](BoolMenuItem &item, View &, Input::Event e)
+		{
+			optionFrameTelemetry = item.flipBoolValue(*this);
+			emuFrameTelemetry.setEnabled(optionFrameTelemetry);
+		}
+	},
+	saveFrameTelemetry
+	{
+		"Save Frame Telemetry To CSV",
+		[this](TextMenuItem &, View &, Input::Event e)
+		{
+			if(!emuFrameTelemetry.samples())
+			{
+				popup.postError("No telemetry recorded, enable Show Frame Telemetry and run a game first");
+				return;
+			}
+			auto path = FS::makePathStringPrintf("%s/%s.telemetry.csv", EmuSystem::savePath(), EmuSystem::gameName().data());
+			auto file = fopen(path.data(), "w");
+			if(!file)
+			{
+				popup.printf(3, true, "Can't write %s", path.data());
+				return;
+			}
+			emuFrameTelemetry.writeCSV(file);
+			fclose(file);
+			popup.printf(3, false, "Wrote %s", path.data());
+		}
 	}
 	#if defined __ANDROID__
 	,processPriorityItem
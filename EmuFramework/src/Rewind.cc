@@ -0,0 +1,278 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <emuframework/Rewind.hh>
+#include <emuframework/EmuSystem.hh>
+#include <imagine/logger/logger.h>
+#include <algorithm>
+#include <cstring>
+
+EmuRewind emuRewind{};
+bool rewindActive = false;
+static constexpr uint64_t captureTimeWarnUSecs = 1000;
+
+static void writeVarInt(std::vector<uint8_t> &out, size_t val)
+{
+	while(val >= 0x80)
+	{
+		out.push_back((val & 0x7F) | 0x80);
+		val >>= 7;
+	}
+	out.push_back(val);
+}
+
+static bool readVarInt(const uint8_t *&src, const uint8_t *end, size_t &val)
+{
+	val = 0;
+	for(uint shift = 0; shift < sizeof(size_t) * 8; shift += 7)
+	{
+		if(src == end)
+			return false;
+		auto byte = *src++;
+		val |= (size_t)(byte & 0x7F) << shift;
+		if(!(byte & 0x80))
+			return true;
+	}
+	return false;
+}
+
+static uint8_t xorByte(const uint8_t *data, const uint8_t *ref, size_t i)
+{
+	return ref ? data[i] ^ ref[i] : data[i];
+}
+
+static size_t zeroRunLength(const uint8_t *data, const uint8_t *ref, size_t pos, size_t size)
+{
+	auto start = pos;
+	// compare a word at a time before finishing byte-wise
+	while(pos + sizeof(uint64_t) <= size)
+	{
+		uint64_t a, b = 0;
+		memcpy(&a, &data[pos], sizeof(a));
+		if(ref)
+			memcpy(&b, &ref[pos], sizeof(b));
+		if(a != b)
+			break;
+		pos += sizeof(uint64_t);
+	}
+	while(pos < size && !xorByte(data, ref, pos))
+		pos++;
+	return pos - start;
+}
+
+void EmuRewind::encode(const uint8_t *data, const uint8_t *ref, size_t size, std::vector<uint8_t> &out)
+{
+	// format: total size, then pairs of (zero run, literal run) each followed by the literal bytes
+	out.clear();
+	writeVarInt(out, size);
+	size_t pos = 0;
+	while(pos < size)
+	{
+		auto zeros = zeroRunLength(data, ref, pos, size);
+		pos += zeros;
+		auto literalStart = pos;
+		// end a literal run once enough zero bytes follow to make a new token worthwhile
+		while(pos < size)
+		{
+			while(pos < size && xorByte(data, ref, pos))
+				pos++;
+			if(pos == size || zeroRunLength(data, ref, pos, std::min(pos + 4, size)) >= 4)
+				break;
+			pos++;
+		}
+		writeVarInt(out, zeros);
+		writeVarInt(out, pos - literalStart);
+		auto literalOut = out.size();
+		out.resize(literalOut + (pos - literalStart));
+		for(auto i = literalStart; i < pos; i++)
+		{
+			out[literalOut++] = xorByte(data, ref, i);
+		}
+	}
+}
+
+bool EmuRewind::decode(const uint8_t *src, size_t srcSize, const std::vector<uint8_t> *refData, std::vector<uint8_t> &out)
+{
+	auto end = src + srcSize;
+	size_t size;
+	if(!readVarInt(src, end, size))
+		return false;
+	if(refData && refData->size() != size)
+		return false;
+	auto ref = refData ? refData->data() : nullptr;
+	out.resize(size);
+	size_t pos = 0;
+	while(pos < size)
+	{
+		size_t zeros, literals;
+		if(!readVarInt(src, end, zeros) || !readVarInt(src, end, literals))
+			return false;
+		if(zeros > size - pos || literals > size - pos - zeros || literals > (size_t)(end - src))
+			return false;
+		if(ref)
+			memcpy(&out[pos], &ref[pos], zeros);
+		else
+			memset(&out[pos], 0, zeros);
+		pos += zeros;
+		for(size_t i = 0; i < literals; i++, pos++)
+		{
+			out[pos] = ref ? ref[pos] ^ src[i] : src[i];
+		}
+		src += literals;
+	}
+	return true;
+}
+
+void EmuRewind::setMemoryLimit(size_t bytes)
+{
+	if(bytes == limit)
+		return;
+	limit = bytes;
+	reset();
+	ring.deallocate();
+}
+
+void EmuRewind::setCaptureInterval(uint frames)
+{
+	interval = std::max(frames, 1u);
+}
+
+void EmuRewind::reset()
+{
+	ring.clear();
+	keyframe.clear();
+	frameCount = 0;
+	deltasSinceKeyframe = 0;
+	maxCaptureTime_ = {};
+}
+
+void EmuRewind::addFrames(uint frames)
+{
+	if(!isEnabled())
+		return;
+	frameCount += frames;
+	if(frameCount >= interval)
+	{
+		frameCount = 0;
+		capture();
+	}
+}
+
+bool EmuRewind::store(const std::vector<uint8_t> &data, bool isKeyframe)
+{
+	if(data.size() > ring.capacity())
+	{
+		logWarn("rewind snapshot of %zu bytes exceeds memory limit", data.size());
+		return false;
+	}
+	bool stored = ring.push(data.data(), data.size(), isKeyframe);
+	if(ring.empty())
+		keyframe.clear();
+	return stored;
+}
+
+bool EmuRewind::capture()
+{
+	bool success = false;
+	auto time = IG::timeFunc(
+		[&]()
+		{
+			if(ring.capacity() != limit)
+			{
+				// allocated on first use so a disabled rewind costs no memory
+				ring.allocate(limit);
+			}
+			if(EmuSystem::saveStateToBuffer(state))
+			{
+				return;
+			}
+			bool makeKeyframe = ring.empty() || keyframe.size() != state.size()
+				|| deltasSinceKeyframe >= KEYFRAME_INTERVAL;
+			if(!makeKeyframe)
+			{
+				encode(state.data(), keyframe.data(), state.size(), encoded);
+				if(store(encoded, false))
+				{
+					deltasSinceKeyframe++;
+					success = true;
+					return;
+				}
+				// the group's keyframe was evicted to make room, start a new one
+			}
+			encode(state.data(), nullptr, state.size(), encoded);
+			if(store(encoded, true))
+			{
+				keyframe = state;
+				deltasSinceKeyframe = 0;
+				success = true;
+			}
+		});
+	lastCaptureTime_ = time;
+	if(time > maxCaptureTime_)
+		maxCaptureTime_ = time;
+	if(time.uSecs() > captureTimeWarnUSecs)
+	{
+		logWarn("rewind capture took %lluus (%zu bytes in %u snapshots)",
+			(unsigned long long)time.uSecs(), memoryUsed(), snapshots());
+	}
+	return success;
+}
+
+bool EmuRewind::restoreKeyframeBefore(size_t idx)
+{
+	while(idx--)
+	{
+		auto &e = ring[idx];
+		if(e.isKeyframe)
+		{
+			return decode(ring.data(e), e.size, nullptr, keyframe);
+		}
+	}
+	keyframe.clear();
+	return false;
+}
+
+bool EmuRewind::rewind()
+{
+	if(ring.empty())
+		return false;
+	auto e = ring.back();
+	bool decoded = decode(ring.data(e), e.size, e.isKeyframe ? nullptr : &keyframe, state);
+	ring.popBack();
+	frameCount = 0;
+	if(e.isKeyframe)
+	{
+		// newer captures now continue the previous group
+		restoreKeyframeBefore(ring.entries());
+		deltasSinceKeyframe = KEYFRAME_INTERVAL;
+	}
+	else if(deltasSinceKeyframe)
+	{
+		deltasSinceKeyframe--;
+	}
+	if(!decoded)
+	{
+		logErr("error decoding rewind snapshot");
+		reset();
+		return false;
+	}
+	auto err = EmuSystem::loadStateFromBuffer(state.data(), state.size());
+	if(err.code())
+	{
+		logErr("error loading rewind snapshot: %s", err.what());
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,107 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <emuframework/RewindRing.hh>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+void RewindRing::allocate(size_t size)
+{
+	clear();
+	ring.reset(new uint8_t[size]);
+	ringSize = size;
+}
+
+void RewindRing::deallocate()
+{
+	clear();
+	ring.reset();
+	ringSize = 0;
+}
+
+void RewindRing::clear()
+{
+	entry.clear();
+	writeOffset = 0;
+}
+
+size_t RewindRing::memoryUsed() const
+{
+	size_t used = 0;
+	for(auto &e : entry)
+	{
+		used += e.size;
+	}
+	return used;
+}
+
+void RewindRing::evictOldestGroup()
+{
+	// deltas depend on the keyframe starting their group, so they're evicted together
+	assert(entry.size());
+	entry.pop_front();
+	while(entry.size() && !entry.front().isKeyframe)
+	{
+		entry.pop_front();
+	}
+}
+
+bool RewindRing::overlapsLiveEntry(size_t offset, size_t size) const
+{
+	return std::any_of(entry.begin(), entry.end(),
+		[&](const Entry &e)
+		{
+			return e.offset < offset + size && offset < e.offset + e.size;
+		});
+}
+
+bool RewindRing::push(const uint8_t *data, size_t size, bool isKeyframe)
+{
+	if(size > ringSize)
+		return false;
+	if(writeOffset + size > ringSize)
+	{
+		// anything left past the write position is from the previous lap and older
+		// than the entries at the start of the ring, so it all goes before wrapping
+		auto lapEnd = writeOffset;
+		while(entry.size() && entry.front().offset >= lapEnd)
+		{
+			evictOldestGroup();
+		}
+		writeOffset = 0;
+	}
+	// entries at or after the write position are now in allocation order,
+	// so evicting from the front frees the space in the order it's needed
+	while(entry.size() && entry.front().offset < writeOffset + size
+		&& writeOffset < entry.front().offset + entry.front().size)
+	{
+		evictOldestGroup();
+	}
+	if(!isKeyframe && entry.empty())
+		return false; // the delta's keyframe was evicted
+	assert(!overlapsLiveEntry(writeOffset, size));
+	memcpy(&ring[writeOffset], data, size);
+	entry.push_back({writeOffset, size, isKeyframe});
+	writeOffset += size;
+	return true;
+}
+
+void RewindRing::popBack()
+{
+	assert(entry.size());
+	writeOffset = entry.back().offset;
+	entry.pop_back();
+}
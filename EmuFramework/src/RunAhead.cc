@@ -0,0 +1,59 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <emuframework/RunAhead.hh>
+#include <emuframework/EmuSystem.hh>
+#include <imagine/logger/logger.h>
+#include <algorithm>
+
+EmuRunAhead emuRunAhead{};
+
+void EmuRunAhead::setFrames(uint frames)
+{
+	frames_ = EmuSystem::hasRunAhead ? std::min(frames, MAX_FRAMES) : 0;
+	failed = false;
+	if(!frames_)
+		std::vector<uint8_t>{}.swap(state);
+}
+
+void EmuRunAhead::runFrame(bool renderGfx, bool processGfx, bool renderAudio)
+{
+	if(!isEnabled())
+	{
+		EmuSystem::runFrame(renderGfx, processGfx, renderAudio);
+		return;
+	}
+	// only the real frame outputs audio since the hidden frames are undone
+	EmuSystem::runFrame(false, false, renderAudio);
+	if(EmuSystem::saveStateToBuffer(state))
+	{
+		logErr("error saving run-ahead state, disabling run-ahead");
+		failed = true;
+		// still present a frame, this puts emulation one frame ahead once
+		EmuSystem::runFrame(renderGfx, processGfx, false);
+		return;
+	}
+	iterateTimes(frames_ - 1, i)
+	{
+		EmuSystem::runFrame(false, false, false);
+	}
+	EmuSystem::runFrame(renderGfx, processGfx, false);
+	auto err = EmuSystem::loadStateFromBuffer(state.data(), state.size());
+	if(err.code())
+	{
+		logErr("error restoring run-ahead state: %s, disabling run-ahead", err.what());
+		failed = true;
+	}
+}
@@ -17,7 +17,7 @@
 #include <emuframework/EmuSystem.hh>
 #include <imagine/logger/logger.h>
 #include <imagine/data-type/image/sys.hh>
-#include <imagine/pixmap/Pixmap.hh>
+#include <imagine/pixmap/PixmapConvert.hh>
 #include <imagine/io/FileIO.hh>
 #include <imagine/mem/mem.h>
 
@@ -25,22 +25,9 @@
 
 bool writeScreenshot(const IG::Pixmap &vidPix, const char *fname)
 {
-	auto screen = vidPix.pixel({});
 	IG::MemPixmap tempPix{{vidPix.size(), IG::PIXEL_FMT_RGB888}};
-	for(uint y = 0; y < vidPix.h(); y++, screen += vidPix.pitchBytes())
-	{
-		auto rowpix = tempPix.pixel({0, (int)y});
-		for(uint x = 0; x < vidPix.w(); x++)
-		{
-			// assumes RGB565
-			uint16 pixVal = *(uint16 *)(screen+2*x);
-			uint32 r = pixVal >> 11, g = (pixVal >> 5) & 0x3f, b = pixVal & 0x1f;
-			r *= 8; g *= 4; b *= 8;
-			*(rowpix++) = r;
-			*(rowpix++) = g;
-			*(rowpix++) = b;
-		}
-	}
+	if(!IG::convertPixmap(tempPix, vidPix))
+		return false;
 	Quartz2dImage::writeImage(tempPix, fname);
 	logMsg("%s saved.", fname);
 	return 1;
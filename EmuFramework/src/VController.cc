@@ -16,6 +16,7 @@
 #define LOGTAG "VController"
 #include <emuframework/VController.hh>
 #include <emuframework/EmuApp.hh>
+#include <emuframework/EmuThread.hh>
 #include <imagine/util/algorithm.h>
 #include <imagine/util/math/int.hh>
 
@@ -732,7 +733,7 @@ void VController::inputAction(uint action, uint vBtn)
 	if(isInKeyboardMode())
 	{
 		assert(vBtn < IG::size(kbMap));
-		EmuSystem::handleInputAction(action, kbMap[vBtn]);
+		emuThread.handleInputAction(action, kbMap[vBtn]);
 	}
 	else
 	{
@@ -750,7 +751,7 @@ void VController::inputAction(uint action, uint vBtn)
 				turboActions.removeEvent(keyCode);
 			}
 		}
-		EmuSystem::handleInputAction(action, keyCode);
+		emuThread.handleInputAction(action, keyCode);
 	}
 }
 
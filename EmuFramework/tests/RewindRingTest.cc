@@ -0,0 +1,113 @@
+/*  This file is part of EmuFramework.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with EmuFramework.  If not, see <http://www.gnu.org/licenses/> */
+
+// Pushes variable-size snapshots through several laps of a RewindRing and
+// checks every live entry still holds the bytes written for it.
+// Build & run from EmuFramework:
+// c++ -std=c++14 -Iinclude tests/RewindRingTest.cc src/RewindRing.cc -o RewindRingTest && ./RewindRingTest
+
+#include <emuframework/RewindRing.hh>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <random>
+#include <vector>
+
+#define CHECK(cond) do { if(!(cond)) { fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); exit(1); } } while(0)
+
+static std::vector<uint8_t> snapshotData(unsigned id, size_t size)
+{
+	std::vector<uint8_t> data(size);
+	for(size_t i = 0; i < size; i++)
+		data[i] = id * 31 + i;
+	return data;
+}
+
+static void checkLiveEntries(const RewindRing &ring, const std::deque<std::pair<unsigned, bool>> &expected)
+{
+	CHECK(ring.entries() == expected.size());
+	CHECK(ring.empty() || ring[0].isKeyframe);
+	for(size_t i = 0; i < ring.entries(); i++)
+	{
+		auto &e = ring[i];
+		CHECK(e.offset + e.size <= ring.capacity());
+		CHECK(e.isKeyframe == expected[i].second);
+		auto data = snapshotData(expected[i].first, e.size);
+		CHECK(!memcmp(ring.data(e), data.data(), e.size));
+	}
+}
+
+static void runLaps(unsigned seed, size_t ringSize, size_t minSize, size_t maxSize, unsigned groupSize)
+{
+	RewindRing ring;
+	ring.allocate(ringSize);
+	std::mt19937 rng{seed};
+	std::uniform_int_distribution<size_t> sizeDist{minSize, maxSize};
+	// mirror of the ring's expected contents: snapshot id and keyframe flag, oldest first
+	std::deque<std::pair<unsigned, bool>> expected;
+	size_t bytesPushed = 0;
+	unsigned sinceKeyframe = groupSize;
+	for(unsigned id = 0; bytesPushed < ringSize * 5; id++)
+	{
+		bool isKeyframe = sinceKeyframe == groupSize;
+		auto size = sizeDist(rng);
+		auto data = snapshotData(id, size);
+		if(!ring.push(data.data(), size, isKeyframe))
+		{
+			CHECK(!isKeyframe && ring.empty());
+			expected.clear();
+			sinceKeyframe = groupSize;
+			continue;
+		}
+		sinceKeyframe = isKeyframe ? 0 : sinceKeyframe + 1;
+		bytesPushed += size;
+		// drop the groups the ring evicted from the mirror
+		while(expected.size() + 1 > ring.entries())
+		{
+			expected.pop_front();
+			while(expected.size() && !expected.front().second)
+				expected.pop_front();
+		}
+		expected.emplace_back(id, isKeyframe);
+		checkLiveEntries(ring, expected);
+		// occasionally rewind a few snapshots, as EmuRewind does
+		if(rng() % 16 == 0)
+		{
+			for(auto pops = rng() % 4; pops-- && !ring.empty();)
+			{
+				ring.popBack();
+				expected.pop_back();
+			}
+			checkLiveEntries(ring, expected);
+			sinceKeyframe = groupSize;
+		}
+	}
+}
+
+int main()
+{
+	for(unsigned seed = 0; seed < 200; seed++)
+	{
+		// sizes vary enough that laps end at different offsets
+		runLaps(seed, 4096, 16, 700, 1 + seed % 8);
+		runLaps(seed, 4096, 400, 1400, 1 + seed % 3);
+		runLaps(seed, 65536, 1, 2048, 30);
+	}
+	// every push is a single-entry group that doesn't fit after the last one
+	runLaps(0, 1000, 334, 500, 0);
+	printf("RewindRing: all tests passed\n");
+	return 0;
+}
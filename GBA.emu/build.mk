@@ -24,6 +24,7 @@ gba/Mode2.cpp \
 gba/Mode3.cpp \
 gba/Mode4.cpp \
 gba/Mode5.cpp \
+gba/GBAMix.cpp \
 gba/EEprom.cpp \
 gba/Flash.cpp \
 gba/GBA-arm.cpp \
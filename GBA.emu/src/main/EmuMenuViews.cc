@@ -21,6 +21,17 @@ class EmuSystemOptionView : public SystemOptionView
 		rtcItem
 	};
 
+	BoolMenuItem codeCache
+	{
+		"CPU Code Cache",
+		(bool)optionCodeCache,
+		[this](BoolMenuItem &item, View &, Input::Event e)
+		{
+			optionCodeCache = item.flipBoolValue(*this);
+			cpuCodeCacheEnabled = optionCodeCache;
+		}
+	};
+
 	static void setRTCEmulation(uint val)
 	{
 		optionRtcEmulation = val;
@@ -42,6 +53,7 @@ public:
 	{
 		loadStockItems();
 		item.emplace_back(&rtc);
+		item.emplace_back(&codeCache);
 	}
 };
 
@@ -44,6 +44,7 @@ const bool EmuSystem::inputHasRevBtnLayout = false;
 const char *EmuSystem::configFilename = "GbaEmu.config";
 bool EmuSystem::hasBundledGames = true;
 bool EmuSystem::hasCheats = true;
+bool EmuSystem::gzipsStateFiles = true;
 const uint EmuSystem::maxPlayers = 1;
 const AspectRatioInfo EmuSystem::aspectRatioInfo[]
 {
@@ -188,11 +189,12 @@ void EmuSystem::handleInputAction(uint state, uint emuKey)
 
 enum
 {
-	CFGKEY_RTC_EMULATION = 256
+	CFGKEY_RTC_EMULATION = 256, CFGKEY_CODE_CACHE = 257
 };
 
 Byte1Option optionRtcEmulation(CFGKEY_RTC_EMULATION, RTC_EMU_AUTO, 0, optionIsValidWithMax<2>);
 bool detectedRtcGame = 0;
+Byte1Option optionCodeCache(CFGKEY_CODE_CACHE, 0);
 
 bool EmuSystem::readConfig(IO &io, uint key, uint readSize)
 {
@@ -200,6 +202,7 @@ bool EmuSystem::readConfig(IO &io, uint key, uint readSize)
 	{
 		default: return 0;
 		bcase CFGKEY_RTC_EMULATION: optionRtcEmulation.readFromIO(io, readSize);
+		bcase CFGKEY_CODE_CACHE: optionCodeCache.readFromIO(io, readSize);
 	}
 	return 1;
 }
@@ -207,6 +210,7 @@ bool EmuSystem::readConfig(IO &io, uint key, uint readSize)
 void EmuSystem::writeConfig(IO &io)
 {
 	optionRtcEmulation.writeWithKeyIfNotDefault(io);
+	optionCodeCache.writeWithKeyIfNotDefault(io);
 }
 
 static bool hasGBAExtension(const char *name)
@@ -234,7 +238,10 @@ int systemBlueShift = 3;
 
 void EmuSystem::initOptions() {}
 
-void EmuSystem::onOptionsLoaded() {}
+void EmuSystem::onOptionsLoaded()
+{
+	cpuCodeCacheEnabled = optionCodeCache;
+}
 
 void EmuSystem::reset(ResetMode mode)
 {
@@ -257,35 +264,22 @@ FS::PathString EmuSystem::sprintStateFilename(int slot, const char *statePath, c
 	return FS::makePathStringPrintf("%s/%s%c.sgm", statePath, gameName, saveSlotChar(slot));
 }
 
-std::error_code EmuSystem::saveState()
+std::error_code EmuSystem::saveStateToBuffer(std::vector<uint8_t> &buff)
 {
-	auto saveStr = sprintStateFilename(saveStateSlot);
-	fixFilePermissions(saveStr);
-	if(CPUWriteState(gGba, saveStr.data()))
+	if(CPUWriteState(gGba, buff))
 		return {};
 	else
 		return {EIO, std::system_category()};
 }
 
-std::system_error EmuSystem::loadState(int saveStateSlot)
+std::system_error EmuSystem::loadStateFromBuffer(const uint8_t *data, size_t size)
 {
-	auto saveStr = sprintStateFilename(saveStateSlot);
-	if(CPUReadState(gGba, saveStr.data()))
+	if(CPUReadState(gGba, data, size))
 		return {{}};
 	else
 		return {{EIO, std::system_category()}};
 }
 
-void EmuSystem::saveAutoState()
-{
-	if(gameIsRunning() && optionAutoSaveState)
-	{
-		auto saveStr = sprintStateFilename(-1);
-		fixFilePermissions(saveStr);
-		CPUWriteState(gGba, saveStr.data());
-	}
-}
-
 void EmuSystem::saveBackupMem()
 {
 	if(gameIsRunning())
@@ -5,4 +5,5 @@
 static const uint RTC_EMU_AUTO = 0, RTC_EMU_OFF = 1, RTC_EMU_ON = 2;
 
 extern Byte1Option optionRtcEmulation;
+extern Byte1Option optionCodeCache;
 extern bool detectedRtcGame;
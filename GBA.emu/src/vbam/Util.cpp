@@ -2,6 +2,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <zlib.h>
+#include <algorithm>
+#include <vector>
 
 #ifndef NO_PNG
 extern "C" {
@@ -487,6 +489,80 @@ gzFile utilMemGzOpen(char *memory, int available, const char *mode)
   return memgzopen(memory, available, mode);
 }
 
+// Uncompressed memory stream for quick save states,
+// accessed through the same function pointers as the gzip streams
+struct MemStateStream
+{
+  std::vector<u8> *out;
+  const u8 *in;
+  size_t size;
+  size_t pos;
+};
+
+static int ZEXPORT memStateWrite(gzFile file, voidpc buffer, unsigned len)
+{
+  auto &s = *(MemStateStream*)file;
+  if(!s.out)
+    return 0;
+  auto bytes = (const u8*)buffer;
+  s.out->insert(s.out->end(), bytes, bytes + len);
+  return len;
+}
+
+static int ZEXPORT memStateRead(gzFile file, voidp buffer, unsigned len)
+{
+  auto &s = *(MemStateStream*)file;
+  len = std::min((size_t)len, s.size - s.pos);
+  memcpy(buffer, s.in + s.pos, len);
+  s.pos += len;
+  return len;
+}
+
+static z_off_t ZEXPORT memStateSeek(gzFile file, z_off_t offset, int whence)
+{
+  auto &s = *(MemStateStream*)file;
+  if(s.out)
+  {
+    // like gzseek(), only forward seeks are supported when writing
+    if(whence != SEEK_CUR || offset < 0)
+      return -1;
+    s.out->resize(s.out->size() + offset);
+    return s.out->size();
+  }
+  size_t newPos = whence == SEEK_CUR ? s.pos + offset : offset;
+  if(whence == SEEK_END || newPos > s.size)
+    return -1;
+  s.pos = newPos;
+  return s.pos;
+}
+
+static int ZEXPORT memStateClose(gzFile file)
+{
+  delete (MemStateStream*)file;
+  return Z_OK;
+}
+
+static gzFile utilMemStateOpen(MemStateStream *stream)
+{
+  utilGzWriteFunc = memStateWrite;
+  utilGzReadFunc = memStateRead;
+  utilGzCloseFunc = memStateClose;
+  utilGzSeekFunc = memStateSeek;
+
+  return (gzFile)stream;
+}
+
+gzFile utilMemStateOpen(std::vector<u8> &out)
+{
+  out.clear();
+  return utilMemStateOpen(new MemStateStream{&out, nullptr, 0, 0});
+}
+
+gzFile utilMemStateOpen(const u8 *data, size_t size)
+{
+  return utilMemStateOpen(new MemStateStream{nullptr, data, size, 0});
+}
+
 int utilGzWrite(gzFile file, const voidp buffer, unsigned int len)
 {
   return utilGzWriteFunc(file, buffer, len);
@@ -3,6 +3,7 @@
 
 #include "System.h"
 #include <imagine/util/builtins.h>
+#include <vector>
 
 enum IMAGE_TYPE {
   IMAGE_UNKNOWN = -1,
@@ -36,6 +37,8 @@ int utilReadInt(gzFile);
 void utilWriteInt(gzFile, int);
 gzFile utilGzOpen(const char *file, const char *mode);
 gzFile utilMemGzOpen(char *memory, int available, const char *mode);
+gzFile utilMemStateOpen(std::vector<u8> &out);
+gzFile utilMemStateOpen(const u8 *data, size_t size);
 int utilGzWrite(gzFile file, const voidp buffer, unsigned int len);
 int utilGzRead(gzFile file, voidp buffer, unsigned int len);
 int utilGzClose(gzFile file);
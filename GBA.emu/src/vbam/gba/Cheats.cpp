@@ -301,10 +301,16 @@ u8 v3_deadtable2[256] = {
 #define CHEAT_IS_HEX(a) ( ((a)>='A' && (a) <='F') || ((a) >='0' && (a) <= '9'))
 
 #define CHEAT_PATCH_ROM_16BIT(a,v) \
-  WRITE16LE(((u16 *)&cpu.gba->mem.rom[(a) & 0x1ffffff]), v);
+  do { \
+    WRITE16LE(((u16 *)&cpu.gba->mem.rom[(a) & 0x1ffffff]), v); \
+    cpuCodeCacheInvalidate(0x08000000 | ((a) & 0x1ffffff)); \
+  } while(0)
 
 #define CHEAT_PATCH_ROM_32BIT(a,v) \
-  WRITE32LE(((u32 *)&cpu.gba->mem.rom[(a) & 0x1ffffff]), v);
+  do { \
+    WRITE32LE(((u32 *)&cpu.gba->mem.rom[(a) & 0x1ffffff]), v); \
+    cpuCodeCacheInvalidate(0x08000000 | ((a) & 0x1ffffff)); \
+  } while(0)
 
 static bool isMultilineWithData(int i)
 {
@@ -2293,11 +2293,65 @@ static void tester(void) {
 }
 #endif
 
-int armExecute(ARM7TDMI &cpu)
+// Code cache ///////////////////////////////////////////////////////////
+
+static insnfunc_t armDecode(u32 opcode)
+{
+    return armInsnTable[((opcode>>16)&0xFF0) | ((opcode>>4)&0x0F)];
+}
+
+struct ArmCodePage
+{
+    u32 tag; // page + 1, or 0 if the slot is empty
+    struct
+    {
+        insnfunc_t func;
+        u32 opcode;
+    } op[CODE_CACHE_PAGE_SIZE / 4];
+};
+
+static ArmCodePage armCodePage[CODE_CACHE_SLOTS];
+
+static ArmCodePage *armCodeCacheLookup(ARM7TDMI &cpu, u32 address)
+{
+    u32 page = cpuCodeCachePage(address);
+    if (page == CODE_CACHE_NO_PAGE)
+        return nullptr;
+    ArmCodePage &codePage = armCodePage[cpuCodeCacheSlot(page)];
+    if (codePage.tag != page + 1) {
+        u32 addr = address & ~(CODE_CACHE_PAGE_SIZE - 1);
+        for (auto &op : codePage.op) {
+            op.opcode = CPUReadMemoryQuick(cpu, addr);
+            op.func = armDecode(op.opcode);
+            addr += 4;
+        }
+        codePage.tag = page + 1;
+        cpuCodeCacheMarkPage(page);
+    }
+    return &codePage;
+}
+
+void armCodeCacheInvalidate(u32 page)
+{
+    ArmCodePage &codePage = armCodePage[cpuCodeCacheSlot(page)];
+    if (codePage.tag == page + 1)
+        codePage.tag = 0;
+}
+
+void armCodeCacheFlush()
+{
+    for (auto &codePage : armCodePage)
+        codePage.tag = 0;
+}
+
+template <bool useCodeCache>
+static int armExecuteLoop(ARM7TDMI &cpu)
 {
 	//ARM7TDMI cpu = cpuO;
 	int &cpuNextEvent = cpu.cpuNextEvent;
 	int &cpuTotalTicks = cpu.cpuTotalTicks;
+	ArmCodePage *codePage = nullptr;
+	u32 codePageAddr = 0;
     do {
 		if( cheatsEnabled ) {
 			cpuMasterCodeCheck(cpu);
@@ -2323,7 +2377,33 @@ int armExecute(ARM7TDMI &cpu)
 
         armNextPC = reg[15].I;
         reg[15].I += 4;
-        ARM_PREFETCH_NEXT;
+        insnfunc_t func;
+        if (useCodeCache) {
+            // the opcode to run is still the prefetched one, the cached decode
+            // is only used when it matches, and the next prefetch comes from
+            // the cache while the page hasn't been written to
+            u32 offset = oldArmNextPC - codePageAddr;
+            if (UNLIKELY(offset >= CODE_CACHE_PAGE_SIZE || !codePage || !codePage->tag)) {
+                codePage = armCodeCacheLookup(cpu, oldArmNextPC);
+                codePageAddr = oldArmNextPC & ~(CODE_CACHE_PAGE_SIZE - 1);
+                offset = oldArmNextPC - codePageAddr;
+            }
+            if (LIKELY(codePage != nullptr)) {
+                u32 nextOffset = armNextPC + 4 - codePageAddr;
+                if (LIKELY(nextOffset < CODE_CACHE_PAGE_SIZE && !(nextOffset & 3)))
+                    cpu.setPrefetchNext(codePage->op[nextOffset >> 2].opcode);
+                else
+                    ARM_PREFETCH_NEXT;
+                auto &op = codePage->op[offset >> 2];
+                func = LIKELY(opcode == op.opcode) ? op.func : armDecode(opcode);
+            } else {
+                ARM_PREFETCH_NEXT;
+                func = armDecode(opcode);
+            }
+        } else {
+            ARM_PREFETCH_NEXT;
+            func = armDecode(opcode);
+        }
 
         int cond = opcode >> 28;
         u32 cond_res = true;
@@ -2383,7 +2463,7 @@ int armExecute(ARM7TDMI &cpu)
         }
 
         if (cond_res)
-            (*armInsnTable[((opcode>>16)&0xFF0) | ((opcode>>4)&0x0F)])(cpu, opcode, clockTicks);
+            (*func)(cpu, opcode, clockTicks);
 #ifdef INSN_COUNTER
         count(opcode, cond_res);
 #endif
@@ -2408,3 +2488,13 @@ int armExecute(ARM7TDMI &cpu)
     //cpuO = cpu;
     return 1;
 }
+
+int armExecute(ARM7TDMI &cpu)
+{
+    return armExecuteLoop<false>(cpu);
+}
+
+int armExecuteCached(ARM7TDMI &cpu)
+{
+    return armExecuteLoop<true>(cpu);
+}
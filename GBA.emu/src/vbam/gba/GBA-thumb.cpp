@@ -1730,11 +1730,65 @@ static const insnfunc_t thumbInsnTable[1024] = {
 
 // Wrapper routine (execution loop) ///////////////////////////////////////
 
-int thumbExecute(ARM7TDMI &cpu)
+// Code cache ///////////////////////////////////////////////////////////
+
+static insnfunc_t thumbDecode(u32 opcode)
+{
+  return thumbInsnTable[opcode>>6];
+}
+
+struct ThumbCodePage
+{
+  u32 tag; // page + 1, or 0 if the slot is empty
+  struct
+  {
+    insnfunc_t func;
+    u32 opcode;
+  } op[CODE_CACHE_PAGE_SIZE / 2];
+};
+
+static ThumbCodePage thumbCodePage[CODE_CACHE_SLOTS];
+
+static ThumbCodePage *thumbCodeCacheLookup(ARM7TDMI &cpu, u32 address)
+{
+  u32 page = cpuCodeCachePage(address);
+  if(page == CODE_CACHE_NO_PAGE)
+    return nullptr;
+  ThumbCodePage &codePage = thumbCodePage[cpuCodeCacheSlot(page)];
+  if(codePage.tag != page + 1) {
+    u32 addr = address & ~(CODE_CACHE_PAGE_SIZE - 1);
+    for(auto &op : codePage.op) {
+      op.opcode = CPUReadHalfWordQuick(cpu, addr);
+      op.func = thumbDecode(op.opcode);
+      addr += 2;
+    }
+    codePage.tag = page + 1;
+    cpuCodeCacheMarkPage(page);
+  }
+  return &codePage;
+}
+
+void thumbCodeCacheInvalidate(u32 page)
+{
+  ThumbCodePage &codePage = thumbCodePage[cpuCodeCacheSlot(page)];
+  if(codePage.tag == page + 1)
+    codePage.tag = 0;
+}
+
+void thumbCodeCacheFlush()
+{
+  for(auto &codePage : thumbCodePage)
+    codePage.tag = 0;
+}
+
+template <bool useCodeCache>
+static int thumbExecuteLoop(ARM7TDMI &cpu)
 {
 	//ARM7TDMI cpu = cpuO;
 	int &cpuNextEvent = cpu.cpuNextEvent;
 	int &cpuTotalTicks = cpu.cpuTotalTicks;
+	ThumbCodePage *codePage = nullptr;
+	u32 codePageAddr = 0;
   do {
 	  if( cheatsEnabled ) {
 		  cpuMasterCodeCheck(cpu);
@@ -1758,9 +1812,33 @@ int thumbExecute(ARM7TDMI &cpu)
 
     armNextPC = reg[15].I;
     reg[15].I += 2;
-    THUMB_PREFETCH_NEXT;
+    insnfunc_t func;
+    if(useCodeCache) {
+      // see armExecuteLoop()
+      u32 offset = oldArmNextPC - codePageAddr;
+      if(UNLIKELY(offset >= CODE_CACHE_PAGE_SIZE || !codePage || !codePage->tag)) {
+        codePage = thumbCodeCacheLookup(cpu, oldArmNextPC);
+        codePageAddr = oldArmNextPC & ~(CODE_CACHE_PAGE_SIZE - 1);
+        offset = oldArmNextPC - codePageAddr;
+      }
+      if(LIKELY(codePage != nullptr)) {
+        u32 nextOffset = armNextPC + 2 - codePageAddr;
+        if(LIKELY(nextOffset < CODE_CACHE_PAGE_SIZE && !(nextOffset & 1)))
+          cpu.setPrefetchNext(codePage->op[nextOffset >> 1].opcode);
+        else
+          THUMB_PREFETCH_NEXT;
+        auto &op = codePage->op[offset >> 1];
+        func = LIKELY(opcode == op.opcode) ? op.func : thumbDecode(opcode);
+      } else {
+        THUMB_PREFETCH_NEXT;
+        func = thumbDecode(opcode);
+      }
+    } else {
+      THUMB_PREFETCH_NEXT;
+      func = thumbDecode(opcode);
+    }
 
-    int clockTicks = (*thumbInsnTable[opcode>>6])(cpu, opcode, oldArmNextPC);
+    int clockTicks = (*func)(cpu, opcode, oldArmNextPC);
 
 		#ifdef BKPT_SUPPORT
     if (clockTicks < 0)
@@ -1781,3 +1859,13 @@ int thumbExecute(ARM7TDMI &cpu)
   //cpuO = cpu;
   return 1;
 }
+
+int thumbExecute(ARM7TDMI &cpu)
+{
+  return thumbExecuteLoop<false>(cpu);
+}
+
+int thumbExecuteCached(ARM7TDMI &cpu)
+{
+  return thumbExecuteLoop<true>(cpu);
+}
@@ -57,6 +57,24 @@ static const memoryMap gbaMap[256] =
 
 GBASys gGba;
 
+bool cpuCodeCacheEnabled = false;
+u8 cpuCodeCacheWRAMPage[CODE_CACHE_WRAM_PAGES]{};
+
+void cpuCodeCacheInvalidatePage(u32 page)
+{
+  armCodeCacheInvalidate(page);
+  thumbCodeCacheInvalidate(page);
+  if(page < CODE_CACHE_WRAM_PAGES)
+    cpuCodeCacheWRAMPage[page] = 0;
+}
+
+void cpuCodeCacheFlush()
+{
+  armCodeCacheFlush();
+  thumbCodeCacheFlush();
+  memset(cpuCodeCacheWRAMPage, 0, sizeof(cpuCodeCacheWRAMPage));
+}
+
 #ifdef USE_MEM_HANDLERS
 u32 biosRead32(ARM7TDMI &cpu, u32 address)
 {
@@ -803,6 +821,17 @@ bool CPUWriteMemState(GBASys &gba, char *memory, int available)
   return res;
 }
 
+bool CPUWriteState(GBASys &gba, std::vector<u8> &buff)
+{
+  gzFile gzFile = utilMemStateOpen(buff);
+
+  bool res = CPUWriteState(gba, gzFile);
+
+  utilGzClose(gzFile);
+
+  return res;
+}
+
 static bool CPUReadState(GBASys &gba, gzFile gzFile)
 {
   int version = utilReadInt(gzFile);
@@ -973,6 +1002,7 @@ static bool CPUReadState(GBASys &gba, gzFile gzFile)
     gbaSaveType = 3;
 
   systemSaveUpdateCounter = SYSTEM_SAVE_NOT_UPDATED;
+  cpuCodeCacheFlush();
   if(gba.cpu.armState) {
   	gba.cpu.ARM_PREFETCH();
   } else {
@@ -995,6 +1025,17 @@ bool CPUReadMemState(GBASys &gba, char *memory, int available)
   return res;
 }
 
+bool CPUReadState(GBASys &gba, const u8 *data, size_t size)
+{
+  gzFile gzFile = utilMemStateOpen(data, size);
+
+  bool res = CPUReadState(gba, gzFile);
+
+  utilGzClose(gzFile);
+
+  return res;
+}
+
 bool CPUReadState(GBASys &gba, const char * file)
 {
   gzFile gzFile = utilGzOpen(file, "rb");
@@ -1473,6 +1514,7 @@ static void postLoadRomSetup(GBASys &gba)
   eepromInit();
 
   CPUUpdateRenderBuffers(gba, true);
+  cpuCodeCacheFlush();
 }
 
 int CPULoadRom(GBASys &gba, const char *szFile)
@@ -1534,6 +1576,7 @@ void doMirroring (GBASys &gba, bool b)
       memcpy ((u16 *)(gba.mem.rom+mirroredRomAddress), (u16 *)(gba.mem.rom), mirroredRomSize);
       mirroredRomAddress+=mirroredRomSize;
     }
+    cpuCodeCacheFlush();
   }
 }
 
@@ -3014,6 +3057,7 @@ void CPUInit(GBASys &gba, const char *biosFileName, bool useBiosFile)
 
 void CPUReset(GBASys &gba)
 {
+  cpuCodeCacheFlush();
   if(gbaSaveType == 0) {
     if(eepromInUse)
       gbaSaveType = 3;
@@ -3269,7 +3313,7 @@ void CPULoop(GBASys &gba, bool renderGfx, bool processGfx, bool renderAudio)
 #endif
     		) {
       if(cpu.armState) {
-        if (!armExecute(cpu))
+        if (!(cpuCodeCacheEnabled ? armExecuteCached(cpu) : armExecute(cpu)))
         {
 					#ifdef BKPT_SUPPORT
         	gCpu = cpu;
@@ -3277,7 +3321,7 @@ void CPULoop(GBASys &gba, bool renderGfx, bool processGfx, bool renderAudio)
 					#endif
         }
       } else {
-        if (!thumbExecute(cpu))
+        if (!(cpuCodeCacheEnabled ? thumbExecuteCached(cpu) : thumbExecute(cpu)))
         {
 					#ifdef BKPT_SUPPORT
         	gCpu = cpu;
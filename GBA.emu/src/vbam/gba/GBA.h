@@ -10,6 +10,7 @@
 #include <imagine/util/ansiTypes.h>
 #include <imagine/logger/logger.h>
 #include <imagine/io/IO.hh>
+#include <vector>
 
 #define SAVE_GAME_VERSION_1 1
 #define SAVE_GAME_VERSION_2 2
@@ -635,6 +636,14 @@ public:
 #endif
 	}
 
+	// same as ARM_PREFETCH_NEXT/THUMB_PREFETCH_NEXT when the opcode is already known
+	void setPrefetchNext(u32 opcode) ATTRS(always_inline)
+	{
+#ifdef VBAM_USE_CPU_PREFETCH
+		cpuPrefetch[1] = opcode;
+#endif
+	}
+
 	int prefetchArmOpcode() ATTRS(always_inline)
 	{
 #ifdef VBAM_USE_CPU_PREFETCH
@@ -972,6 +981,9 @@ struct GBASys
 
 extern GBASys gGba;
 
+// run CPU code through the pre-decoded instruction cache (GBAcodeCache.h)
+extern bool cpuCodeCacheEnabled;
+
 u32 biosRead8(ARM7TDMI &cpu, u32 address);
 u32 biosRead16(ARM7TDMI &cpu, u32 address);
 u32 biosRead32(ARM7TDMI &cpu, u32 address);
@@ -1025,8 +1037,10 @@ extern void CPUCleanUp();
 extern void CPUUpdateRender(GBASys &gba);
 extern bool CPUReadMemState(GBASys &gba, char *, int);
 extern bool CPUReadState(GBASys &gba, const char *);
+extern bool CPUReadState(GBASys &gba, const u8 *, size_t);
 extern bool CPUWriteMemState(GBASys &gba, char *, int);
 extern bool CPUWriteState(GBASys &gba, const char *);
+extern bool CPUWriteState(GBASys &gba, std::vector<u8> &);
 extern int CPULoadRom(GBASys &gba, const char *);
 extern int CPULoadRomWithIO(GBASys &gba, IO &);
 extern void doMirroring(GBASys &gba, bool);
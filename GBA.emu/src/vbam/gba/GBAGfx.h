@@ -84,6 +84,14 @@ void mode5RenderLine(MixColorType *, GBALCD &lcd, const GBAMem::IoMem &ioMem);
 void mode5RenderLineNoWindow(MixColorType *, GBALCD &lcd, const GBAMem::IoMem &ioMem);
 void mode5RenderLineAll(MixColorType *, GBALCD &lcd, const GBAMem::IoMem &ioMem);
 
+// compose the layer lines into lineMix, layers has bit n set for each BGn of the mode
+void gfxMixLine(MixColorType *, const GBALCD &lcd, const GBAMem::IoMem &ioMem, u32 backdrop, uint layers);
+void gfxMixLineNoWindow(MixColorType *, const GBALCD &lcd, const GBAMem::IoMem &ioMem, u32 backdrop, uint layers);
+void gfxMixLineAll(MixColorType *, const GBALCD &lcd, const GBAMem::IoMem &ioMem, u32 backdrop, uint layers,
+                   bool inWindow0, bool inWindow1);
+// use the SSE2/NEON compositor when built with one, otherwise the scalar reference
+extern bool gfxMixVector;
+
 static const int coeff[32] = {
   0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
   16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16};
@@ -0,0 +1,348 @@
+#include "GBA.h"
+#include "Globals.h"
+#include "GBAGfx.h"
+
+// Line compositor shared by the mode renderers: picks the top pixel of the
+// enabled layers in priority order, applies the window masks and the
+// alpha blending/brightness effects and writes the final scanline.
+//
+// Layer pixels carry the priority in the top byte (0-7 when drawn, 0x80 and
+// up when transparent) and the backdrop carries 0x30, so comparing priority
+// bytes gives the same result as the full 32-bit compares the per-mode loops
+// used for the first layer.
+
+#if defined(__SSE2__)
+#define GFX_MIX_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define GFX_MIX_NEON
+#include <arm_neon.h>
+#endif
+
+enum
+{
+  GFX_MIX_OBJ, // only semi-transparent OBJ effects
+  GFX_MIX_FX, // all effects, no windows
+  GFX_MIX_WINDOW // all effects inside the windows
+};
+
+bool gfxMixVector = true;
+
+struct GfxMix
+{
+  u32 backdrop;
+  u16 BLDMOD;
+  int effect;
+  int ca, cb, cy;
+  u8 outMask, objWinMask, inWin0Mask, inWin1Mask;
+  bool inWindow0, inWindow1;
+};
+
+template<int KIND>
+static void gfxMixLineScalar(MixColorType *lineMix, const GBALCD &lcd, const GfxMix &m,
+                             uint layers, int start, int end)
+{
+  const u32 *line[4] = { lcd.line0, lcd.line1, lcd.line2, lcd.line3 };
+
+  for(int x = start; x < end; x++) {
+    u8 mask = 0x3F;
+
+    if(KIND == GFX_MIX_WINDOW) {
+      mask = m.outMask;
+      if(!(lcd.lineOBJWin[x] & 0x80000000))
+        mask = m.objWinMask;
+      if(m.inWindow1 && lcd.gfxInWin1[x])
+        mask = m.inWin1Mask;
+      if(m.inWindow0 && lcd.gfxInWin0[x])
+        mask = m.inWin0Mask;
+    }
+
+    u32 color = m.backdrop;
+    u8 top = 0x20;
+
+    for(int l = 0; l < 4; l++) {
+      if((layers & mask & (1 << l)) && (u8)(line[l][x]>>24) < (u8)(color >> 24)) {
+        color = line[l][x];
+        top = 1 << l;
+      }
+    }
+
+    if((mask & 16) && (u8)(lcd.lineOBJ[x]>>24) < (u8)(color >> 24)) {
+      color = lcd.lineOBJ[x];
+      top = 0x10;
+    }
+
+    bool semi = (top & 0x10) && (color & 0x00010000);
+    bool fx = KIND == GFX_MIX_FX || (KIND == GFX_MIX_WINDOW && (mask & 32));
+    bool blended = false;
+
+    if(semi || (fx && m.effect == 1 && (top & m.BLDMOD))) {
+      // second target is the next layer down, for a semi-transparent
+      // OBJ that is always a background since the OBJ itself is on top
+      u32 back = m.backdrop;
+      u8 top2 = 0x20;
+
+      for(int l = 0; l < 4; l++) {
+        if((layers & mask & (1 << l)) && top != (1 << l) &&
+           (u8)(line[l][x]>>24) < (u8)(back >> 24)) {
+          back = line[l][x];
+          top2 = 1 << l;
+        }
+      }
+
+      if((mask & 16) && top != 0x10 && (u8)(lcd.lineOBJ[x]>>24) < (u8)(back >> 24)) {
+        back = lcd.lineOBJ[x];
+        top2 = 0x10;
+      }
+
+      if(top2 & (m.BLDMOD>>8)) {
+        color = gfxAlphaBlend(color, back, m.ca, m.cb);
+        blended = true;
+      }
+    }
+
+    if(!blended && (semi || fx) && (m.BLDMOD & top)) {
+      switch(m.effect) {
+      case 2:
+        color = gfxIncreaseBrightness(color, m.cy);
+        break;
+      case 3:
+        color = gfxDecreaseBrightness(color, m.cy);
+        break;
+      }
+    }
+
+    lineMix[x] = convColor(color);
+  }
+}
+
+#if defined(GFX_MIX_SSE2) || defined(GFX_MIX_NEON)
+
+// 8 pixels per vector as 16-bit lanes, the top half of each layer pixel
+// holds the priority byte and the semi-transparent flag
+#ifdef GFX_MIX_SSE2
+struct GfxMixVec
+{
+  typedef __m128i V;
+
+  static V dup(int v) { return _mm_set1_epi16(v); }
+
+  static void load(const u32 *p, V &hi, V &lo)
+  {
+    V a = _mm_loadu_si128((const V *)p);
+    V b = _mm_loadu_si128((const V *)(p + 4));
+    hi = _mm_packs_epi32(_mm_srai_epi32(a, 16), _mm_srai_epi32(b, 16));
+    lo = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16),
+                         _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+  }
+
+  static V loadFlags(const bool *p)
+  {
+    return _mm_unpacklo_epi8(_mm_loadl_epi64((const V *)p), _mm_setzero_si128());
+  }
+
+  static void store(u16 *p, V a) { _mm_storeu_si128((V *)p, a); }
+  static V and_(V a, V b) { return _mm_and_si128(a, b); }
+  static V or_(V a, V b) { return _mm_or_si128(a, b); }
+  static V andNot(V a, V b) { return _mm_andnot_si128(a, b); }
+  static V eq(V a, V b) { return _mm_cmpeq_epi16(a, b); }
+  // operands are always in 0-255
+  static V lt(V a, V b) { return _mm_cmplt_epi16(a, b); }
+  static V sel(V m, V a, V b) { return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b)); }
+  static V add(V a, V b) { return _mm_add_epi16(a, b); }
+  static V sub(V a, V b) { return _mm_sub_epi16(a, b); }
+  static V mul(V a, V b) { return _mm_mullo_epi16(a, b); }
+  static V min(V a, V b) { return _mm_min_epi16(a, b); }
+  template<int S> static V shr(V a) { return _mm_srli_epi16(a, S); }
+  template<int S> static V shl(V a) { return _mm_slli_epi16(a, S); }
+  static bool any(V m) { return _mm_movemask_epi8(m); }
+};
+#else
+struct GfxMixVec
+{
+  typedef uint16x8_t V;
+
+  static V dup(int v) { return vdupq_n_u16(v); }
+
+  static void load(const u32 *p, V &hi, V &lo)
+  {
+    uint32x4_t a = vld1q_u32(p);
+    uint32x4_t b = vld1q_u32(p + 4);
+    hi = vcombine_u16(vshrn_n_u32(a, 16), vshrn_n_u32(b, 16));
+    lo = vcombine_u16(vmovn_u32(a), vmovn_u32(b));
+  }
+
+  static V loadFlags(const bool *p) { return vmovl_u8(vld1_u8((const uint8_t *)p)); }
+  static void store(u16 *p, V a) { vst1q_u16(p, a); }
+  static V and_(V a, V b) { return vandq_u16(a, b); }
+  static V or_(V a, V b) { return vorrq_u16(a, b); }
+  static V andNot(V a, V b) { return vbicq_u16(b, a); }
+  static V eq(V a, V b) { return vceqq_u16(a, b); }
+  static V lt(V a, V b) { return vcltq_u16(a, b); }
+  static V sel(V m, V a, V b) { return vbslq_u16(m, a, b); }
+  static V add(V a, V b) { return vaddq_u16(a, b); }
+  static V sub(V a, V b) { return vsubq_u16(a, b); }
+  static V mul(V a, V b) { return vmulq_u16(a, b); }
+  static V min(V a, V b) { return vminq_u16(a, b); }
+  template<int S> static V shr(V a) { return vshrq_n_u16(a, S); }
+  template<int S> static V shl(V a) { return vshlq_n_u16(a, S); }
+  static bool any(V m) { return vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(m)), 0); }
+};
+#endif
+
+template<uint LAYERS, int KIND>
+static void gfxMixLineVec(MixColorType *lineMix, const GBALCD &lcd, const GfxMix &m)
+{
+  typedef GfxMixVec O;
+  typedef O::V V;
+  const u32 *line[5] = { lcd.line0, lcd.line1, lcd.line2, lcd.line3, lcd.lineOBJ };
+  const V zero = O::dup(0);
+  const V ones = O::eq(zero, zero);
+  const V backColor = O::dup(m.backdrop & 0xFFFF);
+  const V backPrio = O::dup(m.backdrop >> 24);
+  const V target1 = O::dup(m.BLDMOD & 0x3F);
+  const V target2 = O::dup((m.BLDMOD >> 8) & 0x3F);
+  const V ca = O::dup(m.ca), cb = O::dup(m.cb), cy = O::dup(m.cy);
+  const V c31 = O::dup(31);
+
+  for(int x = 0; x < 240; x += 8) {
+    // lanes where the window hides each layer and where effects are on
+    V off[5], fx = KIND == GFX_MIX_FX ? ones : zero;
+    if(KIND == GFX_MIX_WINDOW) {
+      V winHi, winLo;
+      O::load(lcd.lineOBJWin + x, winHi, winLo);
+      V mask = O::sel(O::eq(O::and_(winHi, O::dup(0x8000)), zero),
+                      O::dup(m.objWinMask), O::dup(m.outMask));
+      if(m.inWindow1)
+        mask = O::sel(O::eq(O::loadFlags(lcd.gfxInWin1 + x), zero), mask, O::dup(m.inWin1Mask));
+      if(m.inWindow0)
+        mask = O::sel(O::eq(O::loadFlags(lcd.gfxInWin0 + x), zero), mask, O::dup(m.inWin0Mask));
+      for(int l = 0; l < 5; l++)
+        off[l] = O::eq(O::and_(mask, O::dup(1 << l)), zero);
+      fx = O::andNot(O::eq(O::and_(mask, O::dup(32)), zero), ones);
+    }
+
+    V hi[5], lo[5], prio[5];
+    V color = backColor, cprio = backPrio, top = O::dup(0x20);
+    for(int l = 0; l < 5; l++) {
+      if(!((LAYERS | 0x10) & (1 << l)))
+        continue;
+      O::load(line[l] + x, hi[l], lo[l]);
+      prio[l] = O::shr<8>(hi[l]);
+      V take = O::lt(prio[l], cprio);
+      if(KIND == GFX_MIX_WINDOW)
+        take = O::andNot(off[l], take);
+      color = O::sel(take, lo[l], color);
+      cprio = O::sel(take, prio[l], cprio);
+      top = O::sel(take, O::dup(1 << l), top);
+    }
+
+    V semi = O::andNot(O::eq(O::and_(hi[4], O::dup(1)), zero), O::eq(top, O::dup(0x10)));
+    V topTarget = O::andNot(O::eq(O::and_(top, target1), zero), ones);
+    V alpha = semi;
+    if(m.effect == 1)
+      alpha = O::or_(alpha, O::and_(fx, topTarget));
+    V out = color;
+
+    if(O::any(alpha)) {
+      V back = backColor, bprio = backPrio, top2 = O::dup(0x20);
+      for(int l = 0; l < 5; l++) {
+        if(!((LAYERS | 0x10) & (1 << l)))
+          continue;
+        V take = O::andNot(O::eq(top, O::dup(1 << l)), O::lt(prio[l], bprio));
+        if(KIND == GFX_MIX_WINDOW)
+          take = O::andNot(off[l], take);
+        back = O::sel(take, lo[l], back);
+        bprio = O::sel(take, prio[l], bprio);
+        top2 = O::sel(take, O::dup(1 << l), top2);
+      }
+      alpha = O::andNot(O::eq(O::and_(top2, target2), zero), alpha);
+
+      if(O::any(alpha)) {
+        V r = O::add(O::mul(O::and_(color, c31), ca), O::mul(O::and_(back, c31), cb));
+        V g = O::add(O::mul(O::and_(O::shr<5>(color), c31), ca),
+                     O::mul(O::and_(O::shr<5>(back), c31), cb));
+        V b = O::add(O::mul(O::and_(O::shr<10>(color), c31), ca),
+                     O::mul(O::and_(O::shr<10>(back), c31), cb));
+        r = O::min(O::shr<4>(r), c31);
+        g = O::min(O::shr<4>(g), c31);
+        b = O::min(O::shr<4>(b), c31);
+        out = O::sel(alpha, O::or_(r, O::or_(O::shl<5>(g), O::shl<10>(b))), out);
+      }
+    }
+
+    if(m.effect >= 2) {
+      V bright = O::andNot(alpha, O::and_(topTarget, O::or_(semi, fx)));
+      if(O::any(bright)) {
+        V r = O::and_(color, c31);
+        V g = O::and_(O::shr<5>(color), c31);
+        V b = O::and_(O::shr<10>(color), c31);
+        if(m.effect == 2) {
+          r = O::add(r, O::shr<4>(O::mul(O::sub(c31, r), cy)));
+          g = O::add(g, O::shr<4>(O::mul(O::sub(c31, g), cy)));
+          b = O::add(b, O::shr<4>(O::mul(O::sub(c31, b), cy)));
+        } else {
+          r = O::sub(r, O::shr<4>(O::mul(r, cy)));
+          g = O::sub(g, O::shr<4>(O::mul(g, cy)));
+          b = O::sub(b, O::shr<4>(O::mul(b, cy)));
+        }
+        out = O::sel(bright, O::or_(r, O::or_(O::shl<5>(g), O::shl<10>(b))), out);
+      }
+    }
+
+    O::store(lineMix + x, out);
+  }
+}
+
+#endif
+
+template<int KIND>
+static void gfxMixLine(MixColorType *lineMix, const GBALCD &lcd, const GBAMem::IoMem &ioMem,
+                       u32 backdrop, uint layers, bool inWindow0, bool inWindow1)
+{
+  GfxMix m;
+  m.backdrop = backdrop;
+  m.BLDMOD = ioMem.BLDMOD;
+  m.effect = (ioMem.BLDMOD >> 6) & 3;
+  m.ca = coeff[ioMem.COLEV & 0x1F];
+  m.cb = coeff[(ioMem.COLEV >> 8) & 0x1F];
+  m.cy = coeff[ioMem.COLY & 0x1F];
+  m.outMask = ioMem.WINOUT & 0xFF;
+  m.objWinMask = ioMem.WINOUT >> 8;
+  m.inWin0Mask = ioMem.WININ & 0xFF;
+  m.inWin1Mask = ioMem.WININ >> 8;
+  m.inWindow0 = inWindow0;
+  m.inWindow1 = inWindow1;
+
+#if defined(GFX_MIX_SSE2) || defined(GFX_MIX_NEON)
+  if(!directColorLookup && gfxMixVector) {
+    switch(layers) {
+    case 0xF: gfxMixLineVec<0xF, KIND>(lineMix, lcd, m); break;
+    case 0x7: gfxMixLineVec<0x7, KIND>(lineMix, lcd, m); break;
+    case 0xC: gfxMixLineVec<0xC, KIND>(lineMix, lcd, m); break;
+    case 0x4: gfxMixLineVec<0x4, KIND>(lineMix, lcd, m); break;
+    default: gfxMixLineScalar<KIND>(lineMix, lcd, m, layers, 0, 240); return;
+    }
+    return;
+  }
+#endif
+  gfxMixLineScalar<KIND>(lineMix, lcd, m, layers, 0, 240);
+}
+
+void gfxMixLine(MixColorType *lineMix, const GBALCD &lcd, const GBAMem::IoMem &ioMem,
+                u32 backdrop, uint layers)
+{
+  gfxMixLine<GFX_MIX_OBJ>(lineMix, lcd, ioMem, backdrop, layers, false, false);
+}
+
+void gfxMixLineNoWindow(MixColorType *lineMix, const GBALCD &lcd, const GBAMem::IoMem &ioMem,
+                        u32 backdrop, uint layers)
+{
+  gfxMixLine<GFX_MIX_FX>(lineMix, lcd, ioMem, backdrop, layers, false, false);
+}
+
+void gfxMixLineAll(MixColorType *lineMix, const GBALCD &lcd, const GBAMem::IoMem &ioMem,
+                   u32 backdrop, uint layers, bool inWindow0, bool inWindow1)
+{
+  gfxMixLine<GFX_MIX_WINDOW>(lineMix, lcd, ioMem, backdrop, layers, inWindow0, inWindow1);
+}
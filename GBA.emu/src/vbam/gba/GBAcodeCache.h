@@ -0,0 +1,75 @@
+#ifndef GBACODECACHE_H
+#define GBACODECACHE_H
+
+// Cache of pre-decoded ARM and Thumb instructions used by armExecuteCached()
+// and thumbExecuteCached(). Code is decoded a page at a time from IWRAM,
+// EWRAM and ROM into a direct-mapped set of page slots per instruction set.
+// Pages of IWRAM/EWRAM holding decoded code are flagged so CPU writes to them
+// drop the decoded copy, bulk changes to memory flush the whole cache.
+
+static const u32 CODE_CACHE_PAGE_SHIFT = 8;
+static const u32 CODE_CACHE_PAGE_SIZE = 1 << CODE_CACHE_PAGE_SHIFT;
+static const uint CODE_CACHE_SLOTS = 256;
+static const uint CODE_CACHE_IWRAM_PAGES = 0x8000 >> CODE_CACHE_PAGE_SHIFT;
+static const uint CODE_CACHE_WRAM_PAGES = CODE_CACHE_IWRAM_PAGES + (0x40000 >> CODE_CACHE_PAGE_SHIFT);
+static const u32 CODE_CACHE_NO_PAGE = 0xFFFFFFFF;
+
+extern u8 cpuCodeCacheWRAMPage[CODE_CACHE_WRAM_PAGES];
+
+extern int armExecuteCached(ARM7TDMI &cpu) ATTRS(hot);
+extern int thumbExecuteCached(ARM7TDMI &cpu) ATTRS(hot);
+void armCodeCacheInvalidate(u32 page);
+void thumbCodeCacheInvalidate(u32 page);
+void armCodeCacheFlush();
+void thumbCodeCacheFlush();
+void cpuCodeCacheInvalidatePage(u32 page);
+void cpuCodeCacheFlush();
+
+// IWRAM pages come first, then EWRAM, then ROM (all mirrors read the same data)
+static inline u32 cpuCodeCachePage(u32 address)
+{
+  switch(address >> 24) {
+  case 0x02:
+    return CODE_CACHE_IWRAM_PAGES + ((address & 0x3FFFF) >> CODE_CACHE_PAGE_SHIFT);
+  case 0x03:
+    return (address & 0x7FFF) >> CODE_CACHE_PAGE_SHIFT;
+  case 0x08:
+  case 0x09:
+  case 0x0A:
+  case 0x0C:
+    return CODE_CACHE_WRAM_PAGES + ((address & 0x1FFFFFF) >> CODE_CACHE_PAGE_SHIFT);
+  default:
+    return CODE_CACHE_NO_PAGE;
+  }
+}
+
+static inline uint cpuCodeCacheSlot(u32 page)
+{
+  return (page ^ (page >> 8)) & (CODE_CACHE_SLOTS - 1);
+}
+
+static inline void cpuCodeCacheMarkPage(u32 page)
+{
+  if(page < CODE_CACHE_WRAM_PAGES)
+    cpuCodeCacheWRAMPage[page] = 1;
+}
+
+// called by CPU writes to IWRAM (0x03) and EWRAM (0x02)
+static inline void cpuCodeCacheWriteWRAM(u32 address)
+{
+  u32 page = (address >> 24) == 0x03 ?
+    (address & 0x7FFF) >> CODE_CACHE_PAGE_SHIFT :
+    CODE_CACHE_IWRAM_PAGES + ((address & 0x3FFFF) >> CODE_CACHE_PAGE_SHIFT);
+  if(UNLIKELY(cpuCodeCacheWRAMPage[page]))
+    cpuCodeCacheInvalidatePage(page);
+}
+
+// for writes that bypass the CPU write functions, like cheat ROM patches
+static inline void cpuCodeCacheInvalidate(u32 address)
+{
+  u32 page = cpuCodeCachePage(address);
+  if(page != CODE_CACHE_NO_PAGE)
+    cpuCodeCacheInvalidatePage(page);
+}
+
+#endif // GBACODECACHE_H
@@ -7,6 +7,7 @@
 #include "Sound.h"
 #include "agbprint.h"
 #include "GBAcpu.h"
+#include "GBAcodeCache.h"
 #include "GBALink.h"
 
 static const u32  objTilesAddress [3] = {0x010000, 0x014000, 0x014000};
@@ -593,6 +594,7 @@ static inline void CPUWriteMemory(ARM7TDMI &cpu, u32 address, u32 value)
 
   switch(address >> 24) {
   case 0x02:
+    cpuCodeCacheWriteWRAM(address);
 #ifdef BKPT_SUPPORT
     if(*((u32 *)&freezeWorkRAM[address & 0x3FFFC]))
       cheatsWriteMemory(address & 0x203FFFC,
@@ -602,6 +604,7 @@ static inline void CPUWriteMemory(ARM7TDMI &cpu, u32 address, u32 value)
       WRITE32LE(((u32 *)&cpu.gba->mem.workRAM[address & 0x3FFFC]), value);
     break;
   case 0x03:
+    cpuCodeCacheWriteWRAM(address);
 #ifdef BKPT_SUPPORT
     if(*((u32 *)&freezeInternalRAM[address & 0x7ffc]))
       cheatsWriteMemory(address & 0x3007FFC,
@@ -694,6 +697,7 @@ static inline void CPUWriteHalfWord(ARM7TDMI &cpu, u32 address, u16 value)
 
   switch(address >> 24) {
   case 2:
+    cpuCodeCacheWriteWRAM(address);
 #ifdef BKPT_SUPPORT
     if(*((u16 *)&freezeWorkRAM[address & 0x3FFFE]))
       cheatsWriteHalfWord(address & 0x203FFFE,
@@ -703,6 +707,7 @@ static inline void CPUWriteHalfWord(ARM7TDMI &cpu, u32 address, u16 value)
       WRITE16LE(((u16 *)&cpu.gba->mem.workRAM[address & 0x3FFFE]),value);
     break;
   case 3:
+    cpuCodeCacheWriteWRAM(address);
 #ifdef BKPT_SUPPORT
     if(*((u16 *)&freezeInternalRAM[address & 0x7ffe]))
       cheatsWriteHalfWord(address & 0x3007ffe,
@@ -796,6 +801,7 @@ static inline void CPUWriteByte(ARM7TDMI &cpu, u32 address, u8 b)
 	auto &oam = cpu.gba->lcd.oam;
   switch(address >> 24) {
   case 2:
+    cpuCodeCacheWriteWRAM(address);
 #ifdef BKPT_SUPPORT
     if(freezeWorkRAM[address & 0x3FFFF])
       cheatsWriteByte(address & 0x203FFFF, b);
@@ -804,6 +810,7 @@ static inline void CPUWriteByte(ARM7TDMI &cpu, u32 address, u8 b)
     	cpu.gba->mem.workRAM[address & 0x3FFFF] = b;
     break;
   case 3:
+    cpuCodeCacheWriteWRAM(address);
 #ifdef BKPT_SUPPORT
     if(freezeInternalRAM[address & 0x7fff])
       cheatsWriteByte(address & 0x3007fff, b);
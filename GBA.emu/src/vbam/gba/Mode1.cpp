@@ -14,9 +14,6 @@ void mode1RenderLine(MixColorType *lineMix, GBALCD &lcd, const GBAMem::IoMem &io
 	u32 lcd.lineOBJ[240];
 #endif
   const u16 *palette = (u16 *)lcd.paletteRAM;
-  const auto BLDMOD = ioMem.BLDMOD;
-  const auto COLEV = ioMem.COLEV;
-  const auto COLY = ioMem.COLY;
   const auto VCOUNT = ioMem.VCOUNT;
   const auto MOSAIC = ioMem.MOSAIC;
   const auto DISPCNT = ioMem.DISPCNT;
@@ -47,70 +44,7 @@ void mode1RenderLine(MixColorType *lineMix, GBALCD &lcd, const GBAMem::IoMem &io
     backdrop = ((customBackdropColor & 0x7FFF) | 0x30000000);
   }
 
-  for(int x = 0; x < 240; x++) {
-    u32 color = backdrop;
-    u8 top = 0x20;
-
-    if(lcd.line0[x] < color) {
-      color = lcd.line0[x];
-      top = 0x01;
-    }
-
-    if((u8)(lcd.line1[x]>>24) < (u8)(color >> 24)) {
-      color = lcd.line1[x];
-      top = 0x02;
-    }
-
-    if((u8)(lcd.line2[x]>>24) < (u8)(color >> 24)) {
-      color = lcd.line2[x];
-      top = 0x04;
-    }
-
-    if((u8)(lcd.lineOBJ[x]>>24) < (u8)(color >> 24)) {
-      color = lcd.lineOBJ[x];
-      top = 0x10;
-    }
-
-    if((top & 0x10) && (color & 0x00010000)) {
-      // semi-transparent OBJ
-      u32 back = backdrop;
-      u8 top2 = 0x20;
-
-      if((u8)(lcd.line0[x]>>24) < (u8)(back >> 24)) {
-        back = lcd.line0[x];
-        top2 = 0x01;
-      }
-
-      if((u8)(lcd.line1[x]>>24) < (u8)(back >> 24)) {
-        back = lcd.line1[x];
-        top2 = 0x02;
-      }
-
-      if((u8)(lcd.line2[x]>>24) < (u8)(back >> 24)) {
-        back = lcd.line2[x];
-        top2 = 0x04;
-      }
-
-      if(top2 & (BLDMOD>>8))
-        color = gfxAlphaBlend(color, back,
-                              coeff[COLEV & 0x1F],
-                              coeff[(COLEV >> 8) & 0x1F]);
-      else {
-        switch((BLDMOD >> 6) & 3) {
-        case 2:
-          if(BLDMOD & top)
-            color = gfxIncreaseBrightness(color, coeff[COLY & 0x1F]);
-          break;
-        case 3:
-          if(BLDMOD & top)
-            color = gfxDecreaseBrightness(color, coeff[COLY & 0x1F]);
-          break;
-        }
-      }
-    }
-
-    lineMix[x] = convColor(color);
-  }
+  gfxMixLine(lineMix, lcd, ioMem, backdrop, 0x7);
   lcd.gfxBG2Changed = 0;
   lcd.gfxLastVCOUNT = VCOUNT;
 }
@@ -127,9 +61,6 @@ void mode1RenderLineNoWindow(MixColorType *lineMix, GBALCD &lcd, const GBAMem::I
 	u32 lcd.lineOBJ[240];
 #endif
   const u16 *palette = (u16 *)lcd.paletteRAM;
-  const auto BLDMOD = ioMem.BLDMOD;
-  const auto COLEV = ioMem.COLEV;
-  const auto COLY = ioMem.COLY;
   const auto VCOUNT = ioMem.VCOUNT;
   const auto MOSAIC = ioMem.MOSAIC;
   const auto DISPCNT = ioMem.DISPCNT;
@@ -161,123 +92,7 @@ void mode1RenderLineNoWindow(MixColorType *lineMix, GBALCD &lcd, const GBAMem::I
     backdrop = ((customBackdropColor & 0x7FFF) | 0x30000000);
   }
 
-  for(int x = 0; x < 240; x++) {
-    u32 color = backdrop;
-    u8 top = 0x20;
-
-    if(lcd.line0[x] < color) {
-      color = lcd.line0[x];
-      top = 0x01;
-    }
-
-    if((u8)(lcd.line1[x]>>24) < (u8)(color >> 24)) {
-      color = lcd.line1[x];
-      top = 0x02;
-    }
-
-    if((u8)(lcd.line2[x]>>24) < (u8)(color >> 24)) {
-      color = lcd.line2[x];
-      top = 0x04;
-    }
-
-    if((u8)(lcd.lineOBJ[x]>>24) < (u8)(color >> 24)) {
-      color = lcd.lineOBJ[x];
-      top = 0x10;
-    }
-
-    if(!(color & 0x00010000)) {
-      switch((BLDMOD >> 6) & 3) {
-      case 0:
-        break;
-      case 1:
-        {
-          if(top & BLDMOD) {
-            u32 back = backdrop;
-            u8 top2 = 0x20;
-            if((u8)(lcd.line0[x]>>24) < (u8)(back >> 24)) {
-              if(top != 0x01) {
-                back = lcd.line0[x];
-                top2 = 0x01;
-              }
-            }
-
-            if((u8)(lcd.line1[x]>>24) < (u8)(back >> 24)) {
-              if(top != 0x02) {
-                back = lcd.line1[x];
-                top2 = 0x02;
-              }
-            }
-
-            if((u8)(lcd.line2[x]>>24) < (u8)(back >> 24)) {
-              if(top != 0x04) {
-                back = lcd.line2[x];
-                top2 = 0x04;
-              }
-            }
-
-            if((u8)(lcd.lineOBJ[x]>>24) < (u8)(back >> 24)) {
-              if(top != 0x10) {
-                back = lcd.lineOBJ[x];
-                top2 = 0x10;
-              }
-            }
-
-            if(top2 & (BLDMOD>>8))
-              color = gfxAlphaBlend(color, back,
-                                    coeff[COLEV & 0x1F],
-                                    coeff[(COLEV >> 8) & 0x1F]);
-          }
-        }
-        break;
-      case 2:
-        if(BLDMOD & top)
-          color = gfxIncreaseBrightness(color, coeff[COLY & 0x1F]);
-        break;
-      case 3:
-        if(BLDMOD & top)
-          color = gfxDecreaseBrightness(color, coeff[COLY & 0x1F]);
-        break;
-      }
-    } else {
-      // semi-transparent OBJ
-      u32 back = backdrop;
-      u8 top2 = 0x20;
-
-      if((u8)(lcd.line0[x]>>24) < (u8)(back >> 24)) {
-        back = lcd.line0[x];
-        top2 = 0x01;
-      }
-
-      if((u8)(lcd.line1[x]>>24) < (u8)(back >> 24)) {
-        back = lcd.line1[x];
-        top2 = 0x02;
-      }
-
-      if((u8)(lcd.line2[x]>>24) < (u8)(back >> 24)) {
-        back = lcd.line2[x];
-        top2 = 0x04;
-      }
-
-      if(top2 & (BLDMOD>>8))
-        color = gfxAlphaBlend(color, back,
-                              coeff[COLEV & 0x1F],
-                              coeff[(COLEV >> 8) & 0x1F]);
-      else {
-        switch((BLDMOD >> 6) & 3) {
-        case 2:
-          if(BLDMOD & top)
-            color = gfxIncreaseBrightness(color, coeff[COLY & 0x1F]);
-          break;
-        case 3:
-          if(BLDMOD & top)
-            color = gfxDecreaseBrightness(color, coeff[COLY & 0x1F]);
-          break;
-        }
-      }
-    }
-
-    lineMix[x] = convColor(color);
-  }
+  gfxMixLineNoWindow(lineMix, lcd, ioMem, backdrop, 0x7);
   lcd.gfxBG2Changed = 0;
   lcd.gfxLastVCOUNT = VCOUNT;
 }
@@ -294,13 +109,8 @@ void mode1RenderLineAll(MixColorType *lineMix, GBALCD &lcd, const GBAMem::IoMem
 	u32 lcd.lineOBJ[240];
 #endif
   const u16 *palette = (u16 *)lcd.paletteRAM;
-  const auto BLDMOD = ioMem.BLDMOD;
-  const auto COLEV = ioMem.COLEV;
-  const auto COLY = ioMem.COLY;
   const auto WIN0V = ioMem.WIN0V;
   const auto WIN1V = ioMem.WIN1V;
-  const auto WININ = ioMem.WININ;
-  const auto WINOUT = ioMem.WINOUT;
   const auto VCOUNT = ioMem.VCOUNT;
   const auto MOSAIC = ioMem.MOSAIC;
   const auto DISPCNT = ioMem.DISPCNT;
@@ -354,145 +164,7 @@ void mode1RenderLineAll(MixColorType *lineMix, GBALCD &lcd, const GBAMem::IoMem
     backdrop = ((customBackdropColor & 0x7FFF) | 0x30000000);
   }
 
-  u8 inWin0Mask = WININ & 0xFF;
-  u8 inWin1Mask = WININ >> 8;
-  u8 outMask = WINOUT & 0xFF;
-
-  for(int x = 0; x < 240; x++) {
-    u32 color = backdrop;
-    u8 top = 0x20;
-    u8 mask = outMask;
-
-    if(!(lcd.lineOBJWin[x] & 0x80000000)) {
-      mask = WINOUT >> 8;
-    }
-
-    if(inWindow1) {
-      if(lcd.gfxInWin1[x])
-        mask = inWin1Mask;
-    }
-
-    if(inWindow0) {
-      if(lcd.gfxInWin0[x]) {
-        mask = inWin0Mask;
-      }
-    }
-
-    if(lcd.line0[x] < color && (mask & 1)) {
-      color = lcd.line0[x];
-      top = 0x01;
-    }
-
-    if((u8)(lcd.line1[x]>>24) < (u8)(color >> 24) && (mask & 2)) {
-      color = lcd.line1[x];
-      top = 0x02;
-    }
-
-    if((u8)(lcd.line2[x]>>24) < (u8)(color >> 24) && (mask & 4)) {
-      color = lcd.line2[x];
-      top = 0x04;
-    }
-
-    if((u8)(lcd.lineOBJ[x]>>24) < (u8)(color >> 24) && (mask & 16)) {
-      color = lcd.lineOBJ[x];
-      top = 0x10;
-    }
-
-    if(color & 0x00010000) {
-      // semi-transparent OBJ
-      u32 back = backdrop;
-      u8 top2 = 0x20;
-
-      if((mask & 1) && (u8)(lcd.line0[x]>>24) < (u8)(back >> 24)) {
-        back = lcd.line0[x];
-        top2 = 0x01;
-      }
-
-      if((mask & 2) && (u8)(lcd.line1[x]>>24) < (u8)(back >> 24)) {
-        back = lcd.line1[x];
-        top2 = 0x02;
-      }
-
-      if((mask & 4) && (u8)(lcd.line2[x]>>24) < (u8)(back >> 24)) {
-        back = lcd.line2[x];
-        top2 = 0x04;
-      }
-
-      if(top2 & (BLDMOD>>8))
-        color = gfxAlphaBlend(color, back,
-                              coeff[COLEV & 0x1F],
-                              coeff[(COLEV >> 8) & 0x1F]);
-      else {
-        switch((BLDMOD >> 6) & 3) {
-        case 2:
-          if(BLDMOD & top)
-            color = gfxIncreaseBrightness(color, coeff[COLY & 0x1F]);
-          break;
-        case 3:
-          if(BLDMOD & top)
-            color = gfxDecreaseBrightness(color, coeff[COLY & 0x1F]);
-          break;
-        }
-      }
-    } else if(mask & 32) {
-      // special FX on the window
-      switch((BLDMOD >> 6) & 3) {
-      case 0:
-        break;
-      case 1:
-        {
-          if(top & BLDMOD) {
-            u32 back = backdrop;
-            u8 top2 = 0x20;
-
-            if((mask & 1) && (u8)(lcd.line0[x]>>24) < (u8)(back >> 24)) {
-              if(top != 0x01) {
-                back = lcd.line0[x];
-                top2 = 0x01;
-              }
-            }
-
-            if((mask & 2) && (u8)(lcd.line1[x]>>24) < (u8)(back >> 24)) {
-              if(top != 0x02) {
-                back = lcd.line1[x];
-                top2 = 0x02;
-              }
-            }
-
-            if((mask & 4) && (u8)(lcd.line2[x]>>24) < (u8)(back >> 24)) {
-              if(top != 0x04) {
-                back = lcd.line2[x];
-                top2 = 0x04;
-              }
-            }
-
-            if((mask & 16) && (u8)(lcd.lineOBJ[x]>>24) < (u8)(back >> 24)) {
-              if(top != 0x10) {
-                back = lcd.lineOBJ[x];
-                top2 = 0x10;
-              }
-            }
-
-            if(top2 & (BLDMOD>>8))
-              color = gfxAlphaBlend(color, back,
-                                    coeff[COLEV & 0x1F],
-                                    coeff[(COLEV >> 8) & 0x1F]);
-          }
-        }
-        break;
-      case 2:
-        if(BLDMOD & top)
-          color = gfxIncreaseBrightness(color, coeff[COLY & 0x1F]);
-        break;
-      case 3:
-        if(BLDMOD & top)
-          color = gfxDecreaseBrightness(color, coeff[COLY & 0x1F]);
-        break;
-      }
-    }
-
-    lineMix[x] = convColor(color);
-  }
+  gfxMixLineAll(lineMix, lcd, ioMem, backdrop, 0x7, inWindow0, inWindow1);
   lcd.gfxBG2Changed = 0;
   lcd.gfxLastVCOUNT = VCOUNT;
 }
@@ -882,6 +882,8 @@ void BIOS_RegisterRamReset(ARM7TDMI &cpu, u32 flags)
       // clear internal RAM
       memset(cpu.gba->mem.internalRAM, 0, 0x7e00); // don't clear 0x7e00-0x7fff
     }
+    if(flags & 0x03)
+      cpuCodeCacheFlush();
     cpu.gba->lcd.registerRamReset(flags);
     /*if(flags & 0x04) {
       // clear palette RAM
@@ -1085,6 +1087,7 @@ void BIOS_SoftReset(ARM7TDMI &cpu)
 
   cpu.softReset(cpu.gba->mem.internalRAM[0x7ffa]);
   memset(&cpu.gba->mem.internalRAM[0x7e00], 0, 0x200);
+  cpuCodeCacheFlush();
 
   /*armState = true;
   armMode = 0x1F;
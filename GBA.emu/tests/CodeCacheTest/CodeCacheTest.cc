@@ -0,0 +1,618 @@
+/*  This file is part of GBA.emu.
+
+	GBA.emu is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	GBA.emu is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with GBA.emu.  If not, see <http://www.gnu.org/licenses/> */
+
+// Runs randomly generated ARM and Thumb programs through armExecute()/
+// thumbExecute() and armExecuteCached()/thumbExecuteCached() and checks they
+// end with the same registers, flags, cycle count and RAM. Programs are
+// placed in IWRAM, EWRAM or ROM and mix ALU, multiply and load/store
+// instructions with conditional skips, loops and subroutine calls. RAM
+// programs also rewrite their own code, both instructions already run by a
+// loop and the instruction right after the store, which is already
+// prefetched. Each program then runs a second time after the host rewrites
+// some instructions, through CPUWriteMemory()/CPUWriteHalfWord() like DMA
+// does for RAM, or with cpuCodeCacheInvalidate() like a cheat for ROM.
+// Build & run from GBA.emu:
+// cd src/vbam/gba && c++ -std=gnu++14 -O2 -w -DHAVE_ZLIB_H -DFINAL_VERSION -DC_CORE -DNO_PNG -DNO_LINK \
+//  -DNO_DEBUGGER -I../.. -I.. -I. -I../../../../imagine/include -I../../../../imagine/include/imagine/override \
+//  -DIMAGINE_CONFIG_H=cstddef ../../../tests/CodeCacheTest/CodeCacheTest.cc GBA-arm.cpp GBA-thumb.cpp \
+//  -o /tmp/CodeCacheTest && /tmp/CodeCacheTest [programs]
+
+#include "GBA.h"
+#include "GBAcpu.h"
+#include "GBAinline.h"
+#include "Globals.h"
+#include "EEprom.h"
+#include "RTC.h"
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#define CHECK(cond, ...) \
+	do { if(!(cond)) { fprintf(stderr, "program %u: ", progSeed); fprintf(stderr, __VA_ARGS__); fputc('\n', stderr); return false; } } while(0)
+
+// Parts of the core outside GBA-arm.cpp/GBA-thumb.cpp the test programs never reach
+bool cpuSramEnabled, cpuFlashEnabled, cpuEEPROMEnabled, cpuEEPROMSensorEnabled, eepromInUse;
+int saveType;
+void (*cpuSaveGameFunc)(u32, u8);
+void CPUSoftwareInterrupt(ARM7TDMI &, int) { abort(); }
+void CPUUpdateRegister(ARM7TDMI &, u32, u16) { abort(); }
+int eepromRead(u32) { abort(); }
+void eepromWrite(u32, u8, int) { abort(); }
+u8 flashRead(u32) { abort(); }
+u16 rtcRead(GBASys &, u32) { abort(); }
+bool rtcWrite(u32, u16) { abort(); }
+void soundEvent(GBASys &, u32, u8) { abort(); }
+void soundEvent(GBASys &, u32, u16) { abort(); }
+int systemGetSensorX() { abort(); }
+int systemGetSensorY() { abort(); }
+void systemMessage(int, const char *, ...) { abort(); }
+void mode0RenderLine(MixColorType *, GBALCD &, const GBAMem::IoMem &) { abort(); }
+
+// Same as in GBA.cpp
+u8 cpuCodeCacheWRAMPage[CODE_CACHE_WRAM_PAGES]{};
+
+void cpuCodeCacheInvalidatePage(u32 page)
+{
+	armCodeCacheInvalidate(page);
+	thumbCodeCacheInvalidate(page);
+	if(page < CODE_CACHE_WRAM_PAGES)
+		cpuCodeCacheWRAMPage[page] = 0;
+}
+
+void cpuCodeCacheFlush()
+{
+	armCodeCacheFlush();
+	thumbCodeCacheFlush();
+	memset(cpuCodeCacheWRAMPage, 0, sizeof(cpuCodeCacheWRAMPage));
+}
+
+static const u32 SCRATCH_SIZE = 0x400;
+static const u32 FAR_SCRATCH_ADDR = 0x02030000;
+static const u32 TABLE_ADDR = 0x0203F000; // replacement opcodes, pointed to by SP
+static const uint TABLE_SIZE = 64;
+static const int MAX_TICKS = 10000000;
+
+static unsigned progSeed;
+static u32 rngState;
+
+static u32 rand32()
+{
+	rngState ^= rngState << 13;
+	rngState ^= rngState >> 17;
+	rngState ^= rngState << 5;
+	return rngState;
+}
+
+static uint randRange(uint n) { return rand32() % n; }
+
+struct Program
+{
+	bool thumb = false;
+	u32 base = 0;
+	u32 scratch = 0;
+	std::vector<u32> code; // ARM opcodes, or Thumb opcodes in the low half
+	std::vector<uint> patchable; // straight-line instructions that may be replaced
+	std::vector<u32> table;
+	uint end = 0; // index of the final branch to itself
+
+	uint insnSize() const { return thumb ? 2 : 4; }
+	u32 addr(uint idx) const { return base + idx * insnSize(); }
+	bool inRAM() const { return (base >> 24) != 0x08; }
+};
+
+// ARM generator. Reserved registers: r8 = scratch, r9 = code base,
+// r10 = replacement opcode, r11 = loop counter, r13 = table, r14 = link
+
+static u32 armCond()
+{
+	return randRange(4) ? 0xE : randRange(15);
+}
+
+static u32 armAluOp()
+{
+	uint rd = randRange(8), rn = randRange(8), rm = randRange(8);
+	switch(randRange(8))
+	{
+		case 0: // multiply (accumulate)
+			if(rm == rd)
+				rm = (rm + 1) & 7;
+			return armCond() << 28 | randRange(2) << 21 | randRange(2) << 20 | rd << 16 | rn << 12 | randRange(8) << 8 | 0x90 | rm;
+		case 1: // long multiply
+		{
+			uint hi = rd, lo = (rd + 1 + randRange(7)) & 7;
+			return armCond() << 28 | 0x00800090 | randRange(4) << 21 | randRange(2) << 20 | hi << 16 | lo << 12 | randRange(8) << 8 | rm;
+		}
+		default: // data processing
+		{
+			u32 op = randRange(16);
+			u32 s = (op >= 8 && op <= 11) ? 1 : randRange(2);
+			if(op >= 8 && op <= 11)
+				rd = 0;
+			if(op == 13 || op == 15)
+				rn = 0;
+			u32 operand;
+			switch(randRange(3))
+			{
+				case 0: operand = 1 << 25 | randRange(16) << 8 | randRange(256); break;
+				case 1: operand = randRange(32) << 7 | randRange(4) << 5 | rm; break;
+				default: operand = randRange(8) << 8 | randRange(4) << 5 | 0x10 | rm; break;
+			}
+			return armCond() << 28 | op << 21 | s << 20 | rn << 16 | rd << 12 | operand;
+		}
+	}
+}
+
+static u32 armMemOp()
+{
+	uint rd = randRange(8);
+	switch(randRange(3))
+	{
+		case 0: // LDR/STR(B) [r8, #imm]
+			return armCond() << 28 | 0x05880000 | randRange(2) << 22 | randRange(2) << 20 | rd << 12 | randRange(SCRATCH_SIZE);
+		case 1: // LDRH/STRH/LDRSB/LDRSH [r8, #imm]
+		{
+			u32 load = randRange(2), sh = load ? 1 + randRange(3) : 1, off = randRange(256);
+			return armCond() << 28 | 0x01C80090 | load << 20 | rd << 12 | (off >> 4) << 8 | sh << 5 | (off & 0xF);
+		}
+		default: // LDMIA/STMIA r8, {r0-r7 subset}
+			return armCond() << 28 | 0x08880000 | randRange(2) << 20 | (1 + randRange(255));
+	}
+}
+
+static void armEmitAlu(Program &p, uint count)
+{
+	for(uint i = 0; i < count; i++)
+	{
+		p.patchable.push_back(p.code.size());
+		p.code.push_back(armAluOp());
+	}
+}
+
+struct Fixup
+{
+	uint idx; // instruction to fix
+	uint sub; // subroutine to call, or ~0 for a code patch
+};
+
+static void armGenBlocks(Program &p, std::vector<Fixup> &fixups, uint subs, uint blocks, bool inLoop)
+{
+	for(uint b = 0; b < blocks; b++)
+	{
+		armEmitAlu(p, randRange(6));
+		switch(randRange(inLoop ? 5 : 6))
+		{
+			case 0: // conditional skip
+			{
+				uint skip = 1 + randRange(4);
+				p.code.push_back((u32)randRange(14) << 28 | 0x0A000000 | (skip - 1));
+				armEmitAlu(p, skip);
+				break;
+			}
+			case 1:
+				for(uint i = randRange(4); i > 0; i--)
+					p.code.push_back(armMemOp());
+				break;
+			case 2:
+				if(subs)
+				{
+					fixups.push_back({(uint)p.code.size(), randRange(subs)});
+					p.code.push_back(0xEB000000);
+				}
+				break;
+			case 3:
+			case 4: // self-modifying store, followed by a replaceable instruction it may target
+				if(p.inRAM())
+				{
+					p.code.push_back(0xE59DA000 | randRange(TABLE_SIZE) * 4); // ldr r10, [sp, #k]
+					fixups.push_back({(uint)p.code.size(), ~0u});
+					p.code.push_back(0xE589A000); // str r10, [r9, #off]
+					armEmitAlu(p, 1);
+				}
+				break;
+			case 5: // loop
+			{
+				p.code.push_back(0xE3A0B000 | (1 + randRange(8))); // mov r11, #n
+				uint loop = p.code.size();
+				armGenBlocks(p, fixups, subs, 1 + randRange(3), true);
+				p.code.push_back(0xE25BB001); // subs r11, r11, #1
+				p.code.push_back(0x1A000000 | ((loop - p.code.size() - 2) & 0xFFFFFF)); // bne loop
+				break;
+			}
+		}
+	}
+}
+
+static Program armGenerate(u32 base, uint blocks)
+{
+	Program p;
+	p.base = base;
+	std::vector<Fixup> fixups;
+	const uint subs = randRange(3);
+	armGenBlocks(p, fixups, subs, blocks, false);
+	p.end = p.code.size();
+	p.code.push_back(0xEAFFFFFE); // b .
+	std::vector<uint> subAddr;
+	for(uint s = 0; s < subs; s++)
+	{
+		subAddr.push_back(p.code.size());
+		armEmitAlu(p, 1 + randRange(8));
+		for(uint i = randRange(3); i > 0; i--)
+			p.code.push_back(armMemOp());
+		p.code.push_back(0xE12FFF1E); // bx lr
+	}
+	for(auto &f : fixups)
+	{
+		if(f.sub != ~0u)
+			p.code[f.idx] |= (subAddr[f.sub] - f.idx - 2) & 0xFFFFFF;
+		else
+		{
+			uint target = randRange(2) ? f.idx + 1 : p.patchable[randRange(p.patchable.size())];
+			if(target * 4 > 0xFFF)
+				target = f.idx + 1;
+			p.code[f.idx] |= target * 4;
+		}
+	}
+	for(uint i = 0; i < TABLE_SIZE; i++)
+		p.table.push_back(armAluOp());
+	return p;
+}
+
+// Thumb generator. Reserved registers: r4 = loop counter, r5 = replacement
+// opcode, r6 = patch address, r7 = scratch, r13 = table, r14 = link
+
+static u32 thumbAluOp()
+{
+	uint rd = randRange(4), rs = randRange(8);
+	switch(randRange(4))
+	{
+		case 0: return randRange(3) << 11 | randRange(32) << 6 | rs << 3 | rd;
+		case 1: return 0x1800 | randRange(4) << 9 | randRange(8) << 6 | rs << 3 | rd;
+		case 2: return 0x2000 | randRange(4) << 11 | rd << 8 | randRange(256);
+		default: return 0x4000 | randRange(16) << 6 | rs << 3 | rd;
+	}
+}
+
+static u32 thumbMemOp()
+{
+	uint rd = randRange(4);
+	if(randRange(2))
+		return 0x6000 | randRange(2) << 12 | randRange(2) << 11 | randRange(32) << 6 | 7 << 3 | rd; // LDR/STR(B) [r7, #imm]
+	else
+		return 0x8000 | randRange(2) << 11 | randRange(32) << 6 | 7 << 3 | rd; // LDRH/STRH [r7, #imm]
+}
+
+static void thumbEmitAlu(Program &p, uint count)
+{
+	for(uint i = 0; i < count; i++)
+	{
+		p.patchable.push_back(p.code.size());
+		p.code.push_back(thumbAluOp());
+	}
+}
+
+static void thumbGenBlocks(Program &p, std::vector<Fixup> &fixups, uint subs, uint blocks, bool inLoop)
+{
+	for(uint b = 0; b < blocks; b++)
+	{
+		thumbEmitAlu(p, randRange(6));
+		switch(randRange(inLoop ? 5 : 6))
+		{
+			case 0: // conditional skip
+			{
+				uint skip = 1 + randRange(4);
+				p.code.push_back(0xD000 | randRange(14) << 8 | (skip - 1));
+				thumbEmitAlu(p, skip);
+				break;
+			}
+			case 1:
+				for(uint i = randRange(4); i > 0; i--)
+					p.code.push_back(thumbMemOp());
+				break;
+			case 2:
+				if(subs)
+				{
+					fixups.push_back({(uint)p.code.size(), randRange(subs)});
+					p.code.push_back(0xF000);
+					p.code.push_back(0xF800);
+				}
+				break;
+			case 3:
+			case 4: // self-modifying store, followed by a replaceable instruction it may target
+				if(p.inRAM())
+				{
+					p.code.push_back(0x9D00 | randRange(TABLE_SIZE)); // ldr r5, [sp, #k]
+					fixups.push_back({(uint)p.code.size(), ~0u});
+					p.code.push_back(0xA600); // add r6, pc, #imm
+					p.code.push_back(0x3E00); // sub r6, #d
+					p.code.push_back(0x8035); // strh r5, [r6, #off]
+					thumbEmitAlu(p, 1);
+				}
+				break;
+			case 5: // loop, kept short for the bne range
+			{
+				p.code.push_back(0x2400 | (1 + randRange(8))); // mov r4, #n
+				uint loop = p.code.size();
+				thumbGenBlocks(p, fixups, subs, 1 + randRange(3), true);
+				p.code.push_back(0x3C01); // sub r4, #1
+				int off = (int)loop - (int)p.code.size() - 2;
+				if(off < -128)
+				{
+					// body too long, turn it into a straight run
+					p.code.back() = 0x46C0; // nop
+					p.code.push_back(0x46C0);
+				}
+				else
+					p.code.push_back(0xD100 | (off & 0xFF)); // bne loop
+				break;
+			}
+		}
+	}
+}
+
+// Sets up the add/sub/strh sequence at idx to store to target if it's in range
+static bool thumbPatchTarget(Program &p, uint idx, uint target)
+{
+	u32 addAddr = p.addr(idx), pc = (addAddr + 4) & ~3, t = p.addr(target);
+	u32 imm = 0, d = 0, off = 0;
+	if(t >= pc)
+	{
+		imm = (t - pc) / 4;
+		off = (t - pc) % 4;
+		if(imm > 255)
+			return false;
+	}
+	else
+	{
+		d = pc - t;
+		if(d > 255)
+			return false;
+	}
+	p.code[idx] |= imm;
+	p.code[idx + 1] |= d;
+	p.code[idx + 2] |= (off / 2) << 6;
+	return true;
+}
+
+static Program thumbGenerate(u32 base, uint blocks)
+{
+	Program p;
+	p.thumb = true;
+	p.base = base;
+	std::vector<Fixup> fixups;
+	const uint subs = randRange(3);
+	thumbGenBlocks(p, fixups, subs, blocks, false);
+	p.end = p.code.size();
+	p.code.push_back(0xE7FE); // b .
+	std::vector<uint> subAddr;
+	for(uint s = 0; s < subs; s++)
+	{
+		subAddr.push_back(p.code.size());
+		thumbEmitAlu(p, 1 + randRange(8));
+		for(uint i = randRange(3); i > 0; i--)
+			p.code.push_back(thumbMemOp());
+		p.code.push_back(0x4770); // bx lr
+	}
+	for(auto &f : fixups)
+	{
+		if(f.sub != ~0u)
+		{
+			u32 off = (subAddr[f.sub] - f.idx - 2) * 2;
+			p.code[f.idx] |= (off >> 12) & 0x7FF;
+			p.code[f.idx + 1] |= (off >> 1) & 0x7FF;
+		}
+		else
+		{
+			bool ok = false;
+			if(randRange(2))
+			{
+				for(uint tries = 0; tries < 8 && !ok; tries++)
+					ok = thumbPatchTarget(p, f.idx, p.patchable[randRange(p.patchable.size())]);
+			}
+			if(!ok)
+				thumbPatchTarget(p, f.idx, f.idx + 3);
+		}
+	}
+	for(uint i = 0; i < TABLE_SIZE; i++)
+		p.table.push_back(thumbAluOp());
+	return p;
+}
+
+static Program generate(unsigned seed)
+{
+	rngState = seed * 2654435761u + 1;
+	bool thumb = randRange(2);
+	u32 region;
+	switch(randRange(3))
+	{
+		case 0: region = 0x03000000; break;
+		case 1: region = 0x02000000; break;
+		default: region = 0x08000000; break;
+	}
+	u32 base = region + randRange(0x1000) * 4;
+	Program p = thumb ? thumbGenerate(base, 8 + randRange(24)) : armGenerate(base, 8 + randRange(24));
+	// scratch data either shares a page with the code or is kept away from it
+	u32 codeEnd = p.addr(p.code.size());
+	p.scratch = p.inRAM() && randRange(2) ? (codeEnd + 3) & ~3 : FAR_SCRATCH_ADDR;
+	return p;
+}
+
+static GBASys sys[2];
+
+static void setupMemory(GBASys &gba, const Program &p)
+{
+	auto &cpu = gba.cpu;
+	cpu.map[2] = memoryMap{gba.mem.workRAM, 0x3FFFF, nullptr, nullptr, nullptr};
+	cpu.map[3] = memoryMap{gba.mem.internalRAM, 0x7FFF, nullptr, nullptr, nullptr};
+	for(uint r : {8, 9, 10, 12})
+		cpu.map[r] = memoryMap{gba.mem.rom, 0x1FFFFFF, nullptr, nullptr, nullptr};
+	memset(gba.mem.workRAM, 0, sizeof(gba.mem.workRAM));
+	memset(gba.mem.internalRAM, 0, sizeof(gba.mem.internalRAM));
+	memset(gba.mem.rom, 0, 0x10000);
+	for(uint i = 0; i < p.code.size(); i++)
+	{
+		u8 *mem = &cpu.map[p.addr(i) >> 24].address[p.addr(i) & cpu.map[p.addr(i) >> 24].mask];
+		if(p.thumb)
+			WRITE16LE((u16 *)mem, p.code[i]);
+		else
+			WRITE32LE((u32 *)mem, p.code[i]);
+	}
+	for(uint i = 0; i < p.table.size(); i++)
+		WRITE32LE((u32 *)&gba.mem.workRAM[(TABLE_ADDR & 0x3FFFF) + i * 4], p.table[i]);
+	rngState = progSeed;
+	for(u32 a = p.scratch; a < p.scratch + SCRATCH_SIZE + 4; a += 4)
+		WRITE32LE((u32 *)&cpu.map[a >> 24].address[a & cpu.map[a >> 24].mask], rand32());
+}
+
+static void setupRegs(ARM7TDMI &cpu, const Program &p, bool firstPass)
+{
+	if(firstPass)
+	{
+		for(auto &r : cpu.reg)
+			r.I = 0;
+		rngState = progSeed ^ 0x5A5A5A5A;
+		for(uint r = 0; r < 8; r++)
+			cpu.reg[r].I = rand32();
+		cpu.reg[12].I = rand32();
+		cpu.resetFlags();
+		cpu.C_FLAG = cpu.V_FLAG = false;
+	}
+	cpu.armMode = 0x1F;
+	cpu.armState = !p.thumb;
+	cpu.reg[16].I = 0x1F | (p.thumb ? 0x20 : 0);
+	cpu.reg[p.thumb ? 7 : 8].I = p.scratch;
+	cpu.reg[9].I = p.base;
+	cpu.reg[13].I = TABLE_ADDR;
+	cpu.reg[14].I = 0;
+	cpu.armNextPC = p.base;
+	cpu.reg[15].I = p.base + p.insnSize();
+	if(p.thumb)
+		cpu.THUMB_PREFETCH();
+	else
+		cpu.ARM_PREFETCH();
+	cpu.busPrefetchCount = 0;
+}
+
+// Runs the program to its final branch in random time slices, like CPULoop()
+// between events
+static int run(ARM7TDMI &cpu, const Program &p, bool cached, unsigned sliceSeed)
+{
+	int ticks = 0;
+	rngState = sliceSeed;
+	while(cpu.armNextPC != p.addr(p.end) && ticks < MAX_TICKS)
+	{
+		cpu.cpuTotalTicks = 0;
+		cpu.cpuNextEvent = 1 + randRange(400);
+		if(cpu.armState)
+			cached ? armExecuteCached(cpu) : armExecute(cpu);
+		else
+			cached ? thumbExecuteCached(cpu) : thumbExecute(cpu);
+		ticks += cpu.cpuTotalTicks;
+	}
+	return ticks;
+}
+
+// Rewrites some instructions from the host side
+static void hostPatch(ARM7TDMI &cpu, const Program &p)
+{
+	rngState = progSeed ^ 0xC0DE;
+	for(uint i = 1 + randRange(4); i > 0; i--)
+	{
+		uint idx = p.patchable[randRange(p.patchable.size())];
+		u32 opcode = p.thumb ? thumbAluOp() : armAluOp(), addr = p.addr(idx);
+		if(p.inRAM())
+		{
+			if(p.thumb)
+				CPUWriteHalfWord(cpu, addr, opcode);
+			else
+				CPUWriteMemory(cpu, addr, opcode);
+		}
+		else
+		{
+			if(p.thumb)
+				WRITE16LE((u16 *)&cpu.gba->mem.rom[addr & 0x1FFFFFF], opcode);
+			else
+				WRITE32LE((u32 *)&cpu.gba->mem.rom[addr & 0x1FFFFFF], opcode);
+			cpuCodeCacheInvalidate(addr);
+		}
+	}
+}
+
+static bool runPasses(GBASys &gba, const Program &p, bool cached, int ticks[2])
+{
+	setupMemory(gba, p);
+	for(int pass = 0; pass < 2; pass++)
+	{
+		if(pass)
+			hostPatch(gba.cpu, p);
+		setupRegs(gba.cpu, p, !pass);
+		ticks[pass] = run(gba.cpu, p, cached, progSeed * 31 + pass);
+		CHECK(ticks[pass] < MAX_TICKS, "%s run %d didn't reach the end, stopped at %08X",
+			cached ? "cached" : "uncached", pass + 1, (unsigned)gba.cpu.armNextPC);
+	}
+	return true;
+}
+
+static bool checkProgram(unsigned seed)
+{
+	progSeed = seed;
+	Program p = generate(seed);
+	int ticks[2][2];
+	cpuCodeCacheFlush();
+	if(!runPasses(sys[0], p, false, ticks[0]))
+		return false;
+	cpuCodeCacheFlush();
+	if(!runPasses(sys[1], p, true, ticks[1]))
+		return false;
+	const char *desc = p.thumb ? "Thumb" : "ARM";
+	auto &ref = sys[0].cpu, &cpu = sys[1].cpu;
+	for(uint r = 0; r <= 16; r++)
+	{
+		CHECK(ref.reg[r].I == cpu.reg[r].I, "%s code at %08X: r%u is %08X, expected %08X",
+			desc, (unsigned)p.base, r, (unsigned)cpu.reg[r].I, (unsigned)ref.reg[r].I);
+	}
+	CHECK(ref.nFlag() == cpu.nFlag() && ref.zFlag() == cpu.zFlag() && ref.cFlag() == cpu.cFlag() && ref.vFlag() == cpu.vFlag(),
+		"%s code at %08X: flags differ", desc, (unsigned)p.base);
+	for(int pass = 0; pass < 2; pass++)
+	{
+		CHECK(ticks[0][pass] == ticks[1][pass], "%s code at %08X: run %d took %d ticks, expected %d",
+			desc, (unsigned)p.base, pass + 1, ticks[1][pass], ticks[0][pass]);
+	}
+	for(uint i = 0; i < sizeof(sys[0].mem.workRAM); i++)
+	{
+		CHECK(sys[0].mem.workRAM[i] == sys[1].mem.workRAM[i], "%s code at %08X: EWRAM %08X is %02X, expected %02X",
+			desc, (unsigned)p.base, 0x02000000 + i, sys[1].mem.workRAM[i], sys[0].mem.workRAM[i]);
+	}
+	for(uint i = 0; i < sizeof(sys[0].mem.internalRAM); i++)
+	{
+		CHECK(sys[0].mem.internalRAM[i] == sys[1].mem.internalRAM[i], "%s code at %08X: IWRAM %08X is %02X, expected %02X",
+			desc, (unsigned)p.base, 0x03000000 + i, sys[1].mem.internalRAM[i], sys[0].mem.internalRAM[i]);
+	}
+	return true;
+}
+
+int main(int argc, char **argv)
+{
+	const unsigned programs = argc > 1 ? atoi(argv[1]) : 500;
+	unsigned matched = 0;
+	for(unsigned seed = 1; seed <= programs; seed++)
+	{
+		if(checkProgram(seed))
+			matched++;
+	}
+	printf("%u of %u programs matched\n", matched, programs);
+	return matched != programs;
+}
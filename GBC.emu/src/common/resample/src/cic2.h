@@ -19,6 +19,7 @@
 #ifndef CIC2_H
 #define CIC2_H
 
+#include "cicfir.h"
 #include "rshift16_round.h"
 #include "subresampler.h"
 
@@ -30,6 +31,9 @@ public:
 	std::size_t filter(short *out, short const *in, std::size_t inlen);
 	void reset(unsigned div);
 
+	// trouble if div is too large, may be better to only support power of 2 div
+	static long mulForDiv(unsigned div) { return 0x10000 / (div * div); }
+
 	static double gain(unsigned div) {
 		return rshift16_round(-32768l * (div * div) * mulForDiv(div)) / -32768.0;
 	}
@@ -40,9 +44,6 @@ private:
 	unsigned long prev1_;
 	unsigned div_;
 	unsigned nextdivn_;
-
-	// trouble if div is too large, may be better to only support power of 2 div
-	static long mulForDiv(unsigned div) { return 0x10000 / (div * div); }
 };
 
 template<unsigned channels>
@@ -149,17 +150,23 @@ public:
 	static double gain(unsigned div) { return Cic2Core<channels>::gain(div); }
 
 private:
+	CicFir<channels> fir_;
 	Cic2Core<channels> cics_[channels];
 };
 
 template<unsigned channels>
-Cic2<channels>::Cic2(unsigned div) {
+Cic2<channels>::Cic2(unsigned div)
+: fir_(2, div, Cic2Core<channels>::mulForDiv(div))
+{
 	for (unsigned i = 0; i < channels; ++i)
 		cics_[i].reset(div);
 }
 
 template<unsigned channels>
 std::size_t Cic2<channels>::resample(short *out, short const *in, std::size_t inlen) {
+	if (fir_)
+		return fir_.filter(out, in, inlen);
+
 	std::size_t samplesOut;
 	for (unsigned i = 0; i < channels; ++i)
 		samplesOut = cics_[i].filter(out + i, in + i, inlen);
@@ -19,6 +19,7 @@
 #ifndef CIC3_H
 #define CIC3_H
 
+#include "cicfir.h"
 #include "rshift16_round.h"
 #include "subresampler.h"
 
@@ -30,6 +31,9 @@ public:
 	std::size_t filter(short *out, short const *in, std::size_t inlen);
 	void reset(unsigned div);
 
+	// trouble if div is too large, may be better to only support power of 2 div
+	static long mulForDiv(unsigned div) { return 0x10000 / (div * div * div); }
+
 	static double gain(unsigned div) {
 		return rshift16_round(-32768l * (div * div * div) * mulForDiv(div)) / -32768.0;
 	}
@@ -42,9 +46,6 @@ private:
 	unsigned long prev2_;
 	unsigned div_;
 	unsigned nextdivn_;
-
-	// trouble if div is too large, may be better to only support power of 2 div
-	static long mulForDiv(unsigned div) { return 0x10000 / (div * div * div); }
 };
 
 template<unsigned channels>
@@ -118,17 +119,23 @@ public:
 	static double gain(unsigned div) { return Cic3Core<channels>::gain(div); }
 
 private:
+	CicFir<channels> fir_;
 	Cic3Core<channels> cics_[channels];
 };
 
 template<unsigned channels>
-Cic3<channels>::Cic3(unsigned div) {
+Cic3<channels>::Cic3(unsigned div)
+: fir_(3, div, Cic3Core<channels>::mulForDiv(div))
+{
 	for (unsigned i = 0; i < channels; ++i)
 		cics_[i].reset(div);
 }
 
 template<unsigned channels>
 std::size_t Cic3<channels>::resample(short *out, short const *in, std::size_t inlen) {
+	if (fir_)
+		return fir_.filter(out, in, inlen);
+
 	std::size_t samplesOut;
 	for (unsigned i = 0; i < channels; ++i)
 		samplesOut = cics_[i].filter(out + i, in + i, inlen);
@@ -19,6 +19,7 @@
 #ifndef CIC4_H
 #define CIC4_H
 
+#include "cicfir.h"
 #include "rshift16_round.h"
 #include "subresampler.h"
 
@@ -30,6 +31,9 @@ public:
 	std::size_t filter(short *out, short const *in, std::size_t inlen);
 	void reset(unsigned div);
 
+	// trouble if div is too large, may be better to only support power of 2 div
+	static long mulForDiv(unsigned div) { return 0x10000 / (div * div * div * div); }
+
 	static double gain(unsigned div) {
 		return rshift16_round(-32768l * (div * div * div * div) * mulForDiv(div)) / -32768.0;
 	}
@@ -47,9 +51,6 @@ private:
 	unsigned long prev4_;
 	unsigned div_;
 	unsigned bufpos_;
-
-	// trouble if div is too large, may be better to only support power of 2 div
-	static long mulForDiv(unsigned div) { return 0x10000 / (div * div * div * div); }
 };
 
 template<unsigned channels>
@@ -173,17 +174,23 @@ public:
 	static double gain(unsigned div) { return Cic4Core<channels>::gain(div); }
 
 private:
+	CicFir<channels> fir_;
 	Cic4Core<channels> cics_[channels];
 };
 
 template<unsigned channels>
-Cic4<channels>::Cic4(unsigned div) {
+Cic4<channels>::Cic4(unsigned div)
+: fir_(4, div, Cic4Core<channels>::mulForDiv(div))
+{
 	for (unsigned i = 0; i < channels; ++i)
 		cics_[i].reset(div);
 }
 
 template<unsigned channels>
 std::size_t Cic4<channels>::resample(short *out, short const *in, std::size_t inlen) {
+	if (fir_)
+		return fir_.filter(out, in, inlen);
+
 	std::size_t samplesOut;
 	for (unsigned i = 0; i < channels; ++i)
 		samplesOut = cics_[i].filter(out + i, in + i, inlen);
@@ -0,0 +1,90 @@
+/***************************************************************************
+ *   Copyright (C) 2008 by Sindre Aamås                                    *
+ *   sinamas@users.sourceforge.net                                         *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License version 2 as     *
+ *   published by the Free Software Foundation.                            *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License version 2 for more details.                *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   version 2 along with this program; if not, write to the               *
+ *   Free Software Foundation, Inc.,                                       *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.             *
+ ***************************************************************************/
+#ifndef CICFIR_H
+#define CICFIR_H
+
+#include "array.h"
+#include "polyphasefir.h"
+#include <algorithm>
+#include <cstddef>
+
+/**
+  * The decimating CIC filters of the given order computed in their equivalent FIR
+  * form, which lets them share the vectorized PolyphaseFir inner loop. The kernel
+  * is the scaled, order-fold convolution of a div-long boxcar. Integer arithmetic
+  * is exact in both forms, so the output is identical to the CicNCore recursion.
+  * The kernel is padded with leading zeros to a whole number of vector steps.
+  * The scalar FIR loop is slower than the recursion, so this is only usable
+  * (operator bool returns true) when the CPU has a polyphaseFirDot2 variant for
+  * PolyphaseFir's stereo loop and every scaled tap fits in a short.
+  */
+template<unsigned channels>
+class CicFir {
+public:
+	CicFir(unsigned order, unsigned div, long mul);
+	std::size_t filter(short *out, short const *in, std::size_t inlen) {
+		return fir_.filter(out, in, inlen);
+	}
+
+	operator bool() const { return usable_; }
+
+private:
+	Array<short> const kernel_;
+	PolyphaseFir<channels, 1> fir_;
+	bool usable_;
+
+	static std::size_t taps(unsigned order, unsigned div) {
+		return channels == 2 && polyphaseFirDot2() ? (order * (div - 1) + 8) & ~7u : 0;
+	}
+};
+
+template<unsigned channels>
+CicFir<channels>::CicFir(unsigned const order, unsigned const div, long const mul)
+: kernel_(taps(order, div))
+, fir_(kernel_, taps(order, div), div, div - 1)
+, usable_(kernel_.size() != 0)
+{
+	std::size_t const len = order * (div - 1) + 1;
+	if (!kernel_.size())
+		return;
+
+	Array<long> const h(len);
+	Array<long> const prev(len);
+	std::fill(h.get(), h.get() + len, 0);
+	h[0] = 1;
+	for (unsigned o = 0; o < order; ++o) {
+		std::copy(h.get(), h.get() + len, prev.get());
+		for (std::size_t i = 0; i < len; ++i) {
+			h[i] = 0;
+			for (std::size_t j = i < div ? 0 : i - (div - 1); j <= i; ++j)
+				h[i] += prev[j];
+		}
+	}
+
+	short *const k = kernel_ + (kernel_.size() - len);
+	std::fill(kernel_.get(), k, 0);
+	for (std::size_t i = 0; i < len; ++i) {
+		if (h[i] * mul > 0x7fff)
+			usable_ = false;
+
+		k[i] = h[i] * mul;
+	}
+}
+
+#endif
@@ -24,10 +24,126 @@
 #include <algorithm>
 #include <cstring>
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define POLYPHASEFIR_X86
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define POLYPHASEFIR_NEON
+#include <arm_neon.h>
+#endif
+
+// Adds the dot products of the first n (a multiple of 8) taps in k with the left
+// and right samples of the interleaved stereo frames in s to accl and accr.
+// The sums are 32-bit and wrap, but rshift16_round of the full sum is stored to
+// a short, which only depends on the low 32 bits, so the output is unchanged.
+typedef void PolyphaseFirDot2(long &accl, long &accr,
+                              short const *k, short const *s, std::size_t n);
+
+#ifdef POLYPHASEFIR_X86
+// 8 taps of polyphaseFirDot2SSE2, shared with the AVX2 tail
+__attribute__((target("sse2")))
+inline __m128i polyphaseFirDot2Step(__m128i acc, short const *k, short const *s) {
+	__m128i const kv = _mm_loadu_si128(reinterpret_cast<__m128i const *>(k));
+	__m128i s0 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(s));
+	__m128i s1 = _mm_loadu_si128(reinterpret_cast<__m128i const *>(s + 8));
+	// l0 r0 l1 r1 -> l0 l1 r0 r1, against k0 k1 k0 k1
+	s0 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s0, 0xd8), 0xd8);
+	s1 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s1, 0xd8), 0xd8);
+	acc = _mm_add_epi32(acc, _mm_madd_epi16(s0, _mm_unpacklo_epi32(kv, kv)));
+	return _mm_add_epi32(acc, _mm_madd_epi16(s1, _mm_unpackhi_epi32(kv, kv)));
+}
+
+__attribute__((target("sse2")))
+inline void polyphaseFirDot2Sum(long &accl, long &accr, __m128i acc) {
+	acc = _mm_add_epi32(acc, _mm_srli_si128(acc, 8));
+	accl += static_cast<int>(_mm_cvtsi128_si32(acc));
+	accr += static_cast<int>(_mm_cvtsi128_si32(_mm_srli_si128(acc, 4)));
+}
+
+__attribute__((target("sse2")))
+inline void polyphaseFirDot2SSE2(long &accl, long &accr,
+                                 short const *k, short const *s, std::size_t n) {
+	__m128i acc = _mm_setzero_si128();
+	for (; n; n -= 8, k += 8, s += 16)
+		acc = polyphaseFirDot2Step(acc, k, s);
+
+	polyphaseFirDot2Sum(accl, accr, acc);
+}
+
+// Same as the SSE2 version with 16 taps per step
+__attribute__((target("avx2")))
+inline void polyphaseFirDot2AVX2(long &accl, long &accr,
+                                 short const *k, short const *s, std::size_t n) {
+	__m256i acc = _mm256_setzero_si256();
+	for (; n >= 16; n -= 16, k += 16, s += 32) {
+		// k0-3 k8-11 | k4-7 k12-15, so each 128-bit lane lines up with its frames
+		__m256i const kv = _mm256_permute4x64_epi64(
+			_mm256_loadu_si256(reinterpret_cast<__m256i const *>(k)), 0xd8);
+		__m256i s0 = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(s));
+		__m256i s1 = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(s + 16));
+		s0 = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s0, 0xd8), 0xd8);
+		s1 = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s1, 0xd8), 0xd8);
+		acc = _mm256_add_epi32(acc, _mm256_madd_epi16(s0, _mm256_unpacklo_epi32(kv, kv)));
+		acc = _mm256_add_epi32(acc, _mm256_madd_epi16(s1, _mm256_unpackhi_epi32(kv, kv)));
+	}
+
+	__m128i acc128 = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+	if (n)
+		acc128 = polyphaseFirDot2Step(acc128, k, s);
+
+	polyphaseFirDot2Sum(accl, accr, acc128);
+}
+#endif
+
+#ifdef POLYPHASEFIR_NEON
+inline void polyphaseFirDot2NEON(long &accl, long &accr,
+                                 short const *k, short const *s, std::size_t n) {
+	int32x4_t suml = vdupq_n_s32(0);
+	int32x4_t sumr = vdupq_n_s32(0);
+	for (; n; n -= 8, k += 8, s += 16) {
+		int16x8_t const kv = vld1q_s16(k);
+		int16x8x2_t const sv = vld2q_s16(s);
+		suml = vmlal_s16(suml, vget_low_s16(sv.val[0]), vget_low_s16(kv));
+		suml = vmlal_s16(suml, vget_high_s16(sv.val[0]), vget_high_s16(kv));
+		sumr = vmlal_s16(sumr, vget_low_s16(sv.val[1]), vget_low_s16(kv));
+		sumr = vmlal_s16(sumr, vget_high_s16(sv.val[1]), vget_high_s16(kv));
+	}
+
+	int32x2_t const sum = vpadd_s32(vadd_s32(vget_low_s32(suml), vget_high_s32(suml)),
+	                                vadd_s32(vget_low_s32(sumr), vget_high_s32(sumr)));
+	accl += vget_lane_s32(sum, 0);
+	accr += vget_lane_s32(sum, 1);
+}
+#endif
+
+// Returns the widest polyphaseFirDot2 variant the CPU supports, checked once,
+// or null if there's none and the scalar loop has to be used
+inline PolyphaseFirDot2 * polyphaseFirDot2() {
+#if defined(POLYPHASEFIR_X86)
+	static PolyphaseFirDot2 *const dot2 = []() -> PolyphaseFirDot2 * {
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2"))
+			return polyphaseFirDot2AVX2;
+		if (__builtin_cpu_supports("sse2"))
+			return polyphaseFirDot2SSE2;
+		return 0;
+	}();
+	return dot2;
+#elif defined(POLYPHASEFIR_NEON)
+	return polyphaseFirDot2NEON;
+#else
+	return 0;
+#endif
+}
+
 template<int channels, unsigned phases>
 class PolyphaseFir {
 public:
-	PolyphaseFir(short const *kernel, std::size_t phaseLen, unsigned div);
+	/**
+	  * @param x0 Position of the first output sample in the input upsampled by phases.
+	  *           The default puts it on the first input sample.
+	  */
+	PolyphaseFir(short const *kernel, std::size_t phaseLen, unsigned div, std::size_t x0 = 0);
 	std::size_t filter(short *out, short const *in, std::size_t inlen);
 	void adjustDiv(unsigned div) { div_ = div; }
 	unsigned div() const { return div_; }
@@ -37,16 +153,19 @@ private:
 	Array<short> const prevbuf_;
 	unsigned div_;
 	std::size_t x_;
+	PolyphaseFirDot2 *const dot2_;
 };
 
 template<int channels, unsigned phases>
 PolyphaseFir<channels, phases>::PolyphaseFir(short const *kernel,
                                              std::size_t phaseLen,
-                                             unsigned div)
+                                             unsigned div,
+                                             std::size_t x0)
 : kernel_(kernel)
 , prevbuf_(phaseLen * channels)
 , div_(div)
-, x_(0)
+, x_(x0)
+, dot2_(channels == 2 ? polyphaseFirDot2() : 0)
 {
 	std::fill(prevbuf_.get(), prevbuf_.get() + prevbuf_.size(), 0);
 }
@@ -126,11 +245,17 @@ std::size_t PolyphaseFir<channels, phases>::filter(short *out,
 			short const *const s = in + (x / phases + 1) * channels + c;
 			long accl = 0, accr = 0;
 			std::ptrdiff_t i = -static_cast<std::ptrdiff_t>(phaseLen * channels);
-			do {
+			if (dot2_) {
+				std::size_t const n = phaseLen & ~std::size_t(7);
+				dot2_(accl, accr, k, s + i, n);
+				k += n;
+				i += n * channels;
+			}
+			for (; i; i += channels) {
 				accl += *k * s[i  ];
 				accr += *k * s[i+1];
 				++k;
-			} while (i += channels);
+			}
 
 			out[0] = rshift16_round(accl);
 			out[1] = rshift16_round(accr);
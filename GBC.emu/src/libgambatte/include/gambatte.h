@@ -24,6 +24,7 @@
 #include "loadres.h"
 #include "file/file.h"
 #include <cstddef>
+#include <iosfwd>
 #include <string>
 
 namespace gambatte {
@@ -76,7 +77,9 @@ public:
 	  * @param videoBuf 160x144 RGB32 (native endian) video frame buffer or 0
 	  * @param pitch distance in number of pixels (not bytes) from the start of one line
 	  *              to the next in videoBuf.
-	  * @param audioBuf buffer with space >= samples + 2064
+	  * @param audioBuf buffer with space >= samples + 2064, or 0 to skip sound synthesis.
+	  *                 Sound state is still advanced exactly, so output resumes seamlessly
+	  *                 once a buffer is passed again, and samples is set as usual.
 	  * @param samples  in: number of stereo samples to produce,
 	  *                out: actual number of samples produced
 	  * @return sample offset in audioBuf at which the video frame was completed, or -1
@@ -154,6 +157,25 @@ public:
 	  */
 	bool loadState(std::string const &filepath);
 
+	/**
+	  * Saves emulator state to an output stream, in the same format as a state file.
+	  *
+	  * @param  videoBuf 160x144 RGB32 (native endian) video frame buffer or 0. Used for
+	  *                  saving a thumbnail.
+	  * @param  pitch distance in number of pixels (not bytes) from the start of one line
+	  *               to the next in videoBuf.
+	  * @return success
+	  */
+	bool saveState(gambatte::PixelType const *videoBuf, std::ptrdiff_t pitch,
+	               std::ostream &stream);
+
+	/**
+	  * Loads emulator state from an input stream, in the same format as a state file.
+	  * Unlike loadState(filepath), save data isn't written out first.
+	  * @return success
+	  */
+	bool loadState(std::istream &stream);
+
 	/**
 	  * Selects which state slot to save state to or load state from.
 	  * There are 10 such slots, numbered from 0 to 9 (periodically extended for all n).
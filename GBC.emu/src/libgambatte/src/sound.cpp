@@ -91,8 +91,11 @@ void PSG::loadState(SaveState const &state) {
 }
 
 void PSG::accumulateChannels(unsigned long const cycles) {
-	uint_least32_t *const buf = buffer_ + bufferPos_;
-	std::memset(buf, 0, cycles * sizeof *buf);
+	// without a buffer the channels only advance their state
+	uint_least32_t *const buf = buffer_ ? buffer_ + bufferPos_ : 0;
+	if (buf)
+		std::memset(buf, 0, cycles * sizeof *buf);
+
 	ch1_.update(buf, soVol_, cycles);
 	ch2_.update(buf, soVol_, cycles);
 	ch3_.update(buf, soVol_, cycles);
@@ -115,6 +118,11 @@ void PSG::resetCounter(unsigned long newCc, unsigned long oldCc, bool doubleSpee
 }
 
 std::size_t PSG::fillBuffer() {
+	// rsum_ stays the sum of every channel's last output while skipping,
+	// so the first delta written after resuming brings it up to date
+	if (!buffer_)
+		return bufferPos_;
+
 	uint_least32_t sum = rsum_;
 	uint_least32_t *b = buffer_;
 	std::size_t n = bufferPos_;
@@ -38,6 +38,7 @@ public:
 	void generateSamples(unsigned long cycleCounter, bool doubleSpeed);
 	void resetCounter(unsigned long newCc, unsigned long oldCc, bool doubleSpeed);
 	std::size_t fillBuffer();
+	// a null buffer only advances channel state, without synthesizing samples
 	void setBuffer(uint_least32_t *buf) { buffer_ = buf; bufferPos_ = 0; }
 
 	bool isEnabled() const { return enabled_; }
@@ -215,6 +215,11 @@ void Channel1::loadState(SaveState const &state) {
 }
 
 void Channel1::update(uint_least32_t *buf, unsigned long const soBaseVol, unsigned long cycles) {
+	if (!buf) {
+		skip(cycles);
+		return;
+	}
+
 	unsigned long const outBase = envelopeUnit_.dacIsOn() ? soBaseVol & soMask_ : 0;
 	unsigned long const outLow = outBase * (0 - 15ul);
 	unsigned long const endCycles = cycleCounter_ + cycles;
@@ -250,6 +255,33 @@ void Channel1::update(uint_least32_t *buf, unsigned long const soBaseVol, unsign
 			break;
 	}
 
+	wrapCounters();
+}
+
+void Channel1::skip(unsigned long const cycles) {
+	unsigned long const endCycles = cycleCounter_ + cycles;
+
+	for (;;) {
+		unsigned long const nextMajorEvent = std::min(nextEventUnit_->counter(), endCycles);
+
+		// reviving a running counter fast-forwards the duty unit to the given time,
+		// landing in the same state the event loop in update() would
+		if (dutyUnit_.counter() <= nextMajorEvent)
+			dutyUnit_.reviveCounter(nextMajorEvent);
+
+		cycleCounter_ = nextMajorEvent;
+
+		if (nextEventUnit_->counter() == nextMajorEvent) {
+			nextEventUnit_->event();
+			setEvent();
+		} else
+			break;
+	}
+
+	wrapCounters();
+}
+
+void Channel1::wrapCounters() {
 	if (cycleCounter_ >= SoundUnit::counter_max) {
 		dutyUnit_.resetCounters(cycleCounter_);
 		lengthCounter_.resetCounters(cycleCounter_);
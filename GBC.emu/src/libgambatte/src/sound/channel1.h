@@ -85,6 +85,8 @@ private:
 	bool master_;
 
 	void setEvent();
+	void skip(unsigned long cycles);
+	void wrapCounters();
 };
 
 }
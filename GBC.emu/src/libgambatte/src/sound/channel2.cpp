@@ -114,6 +114,11 @@ void Channel2::loadState(SaveState const &state) {
 }
 
 void Channel2::update(uint_least32_t *buf, unsigned long const soBaseVol, unsigned long cycles) {
+	if (!buf) {
+		skip(cycles);
+		return;
+	}
+
 	unsigned long const outBase = envelopeUnit_.dacIsOn() ? soBaseVol & soMask_ : 0;
 	unsigned long const outLow = outBase * (0 - 15ul);
 	unsigned long const endCycles = cycleCounter_ + cycles;
@@ -149,6 +154,33 @@ void Channel2::update(uint_least32_t *buf, unsigned long const soBaseVol, unsign
 			break;
 	}
 
+	wrapCounters();
+}
+
+void Channel2::skip(unsigned long const cycles) {
+	unsigned long const endCycles = cycleCounter_ + cycles;
+
+	for (;;) {
+		unsigned long const nextMajorEvent = std::min(nextEventUnit->counter(), endCycles);
+
+		// reviving a running counter fast-forwards the duty unit to the given time,
+		// landing in the same state the event loop in update() would
+		if (dutyUnit_.counter() <= nextMajorEvent)
+			dutyUnit_.reviveCounter(nextMajorEvent);
+
+		cycleCounter_ = nextMajorEvent;
+
+		if (nextEventUnit->counter() == nextMajorEvent) {
+			nextEventUnit->event();
+			setEvent();
+		} else
+			break;
+	}
+
+	wrapCounters();
+}
+
+void Channel2::wrapCounters() {
 	if (cycleCounter_ >= SoundUnit::counter_max) {
 		dutyUnit_.resetCounters(cycleCounter_);
 		lengthCounter_.resetCounters(cycleCounter_);
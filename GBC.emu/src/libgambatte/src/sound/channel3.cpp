@@ -145,7 +145,7 @@ void Channel3::updateWaveCounter(unsigned long const cc) {
 void Channel3::update(uint_least32_t *buf, unsigned long const soBaseVol, unsigned long cycles) {
 	unsigned long const outBase = nr0_/* & 0x80*/ ? soBaseVol & soMask_ : 0;
 
-	if (outBase && rshift_ != 4) {
+	if (buf && outBase && rshift_ != 4) {
 		unsigned long const endCycles = cycleCounter_ + cycles;
 
 		for (;;) {
@@ -184,9 +184,13 @@ void Channel3::update(uint_least32_t *buf, unsigned long const soBaseVol, unsign
 				break;
 		}
 	} else {
-		unsigned long const out = outBase * (0 - 15ul);
-		*buf += out - prevOut_;
-		prevOut_ = out;
+		// static output or no buffer, the wave position can be updated lazily
+		if (buf) {
+			unsigned long const out = outBase * (0 - 15ul);
+			*buf += out - prevOut_;
+			prevOut_ = out;
+		}
+
 		cycleCounter_ += cycles;
 
 		while (lengthCounter_.counter() <= cycleCounter_) {
@@ -59,9 +59,10 @@ void Channel4::Lfsr::updateBackupCounter(unsigned long const cc) {
 				unsigned const xored = ((reg_ ^ reg_ >> 1) << (7 - periods)) & 0x7F;
 				reg_ = (reg_ >> periods & ~(0x80 - (0x80 >> periods))) | xored | xored << 8;
 			} else {
-				while (periods > 15) {
-					reg_ = reg_ ^ reg_ >> 1;
-					periods -= 15;
+				// at most 14 at a time, the 15th shift would feed back the first new bit
+				while (periods > 14) {
+					reg_ = reg_ >> 14 | (((reg_ ^ reg_ >> 1) << 1) & 0x7FFF);
+					periods -= 14;
 				}
 
 				reg_ = reg_ >> periods | (((reg_ ^ reg_ >> 1) << (15 - periods)) & 0x7FFF);
@@ -216,6 +217,11 @@ void Channel4::loadState(SaveState const &state) {
 }
 
 void Channel4::update(uint_least32_t *buf, unsigned long const soBaseVol, unsigned long cycles) {
+	if (!buf) {
+		skip(cycles);
+		return;
+	}
+
 	unsigned long const outBase = envelopeUnit_.dacIsOn() ? soBaseVol & soMask_ : 0;
 	unsigned long const outLow = outBase * (0 - 15ul);
 	unsigned long const endCycles = cycleCounter_ + cycles;
@@ -249,6 +255,33 @@ void Channel4::update(uint_least32_t *buf, unsigned long const soBaseVol, unsign
 			break;
 	}
 
+	wrapCounters();
+}
+
+void Channel4::skip(unsigned long const cycles) {
+	unsigned long const endCycles = cycleCounter_ + cycles;
+
+	for (;;) {
+		unsigned long const nextMajorEvent = std::min(nextEventUnit_->counter(), endCycles);
+
+		// reviving a running counter fast-forwards the LFSR to the given time,
+		// landing in the same state the event loop in update() would
+		if (lfsr_.counter() <= nextMajorEvent)
+			lfsr_.reviveCounter(nextMajorEvent);
+
+		cycleCounter_ = nextMajorEvent;
+
+		if (nextEventUnit_->counter() == nextMajorEvent) {
+			nextEventUnit_->event();
+			setEvent();
+		} else
+			break;
+	}
+
+	wrapCounters();
+}
+
+void Channel4::wrapCounters() {
 	if (cycleCounter_ >= SoundUnit::counter_max) {
 		lengthCounter_.resetCounters(cycleCounter_);
 		lfsr_.resetCounters(cycleCounter_);
@@ -92,6 +92,8 @@ private:
 	bool master_;
 
 	void setEvent();
+	void skip(unsigned long cycles);
+	void wrapCounters();
 };
 
 }
@@ -23,6 +23,8 @@
 #include <main/Cheats.hh>
 #include <main/Palette.hh>
 #include "internal.hh"
+#include <istream>
+#include <ostream>
 
 const char *EmuSystem::creditsViewStr = CREDITS_INFO_STRING "(c) 2011-2014\nRobert Broglia\nwww.explusalpha.com\n\n(c) 2011\nthe Gambatte Team\ngambatte.sourceforge.net";
 gambatte::GB gbEmu;
@@ -264,29 +266,65 @@ FS::PathString EmuSystem::sprintStateFilename(int slot, const char *statePath, c
 	return FS::makePathStringPrintf("%s/%s.0%c.gqs", statePath, gameName, saveSlotChar(slot));
 }
 
-std::error_code EmuSystem::saveState()
+// minimal stream buffers so gambatte can serialize state directly to/from memory
+class StateOutBuf : public std::streambuf
 {
-	auto saveStr = sprintStateFilename(saveStateSlot);
-	fixFilePermissions(saveStr);
-	logMsg("saving state %s", saveStr.data());
-	if(!gbEmu.saveState(/*screenBuff*/0, 160, saveStr.data()))
+public:
+	StateOutBuf(std::vector<uint8_t> &buff): buff{buff} {}
+
+protected:
+	int_type overflow(int_type c) override
+	{
+		if(!traits_type::eq_int_type(c, traits_type::eof()))
+			buff.push_back(c);
+		return traits_type::not_eof(c);
+	}
+
+	std::streamsize xsputn(const char *s, std::streamsize n) override
+	{
+		buff.insert(buff.end(), s, s + n);
+		return n;
+	}
+
+private:
+	std::vector<uint8_t> &buff;
+};
+
+class StateInBuf : public std::streambuf
+{
+public:
+	StateInBuf(const uint8_t *data, size_t size)
+	{
+		auto start = (char*)data;
+		setg(start, start, start + size);
+	}
+};
+
+std::error_code EmuSystem::saveStateToBuffer(std::vector<uint8_t> &buff)
+{
+	buff.clear();
+	StateOutBuf outBuf{buff};
+	std::ostream stream{&outBuf};
+	if(!gbEmu.saveState(/*screenBuff*/0, 160, stream))
 		return {EIO, std::system_category()};
 	else
 		return {};
 }
 
-std::system_error EmuSystem::loadState(int saveStateSlot)
+std::system_error EmuSystem::loadStateFromBuffer(const uint8_t *data, size_t size)
 {
-	auto saveStr = sprintStateFilename(saveStateSlot);
-	if(FS::exists(saveStr.data()))
-	{
-		logMsg("loading state %s", saveStr.data());
-		if(!gbEmu.loadState(saveStr.data()))
-			return {{EIO, std::system_category()}};
-		else
-			return {{}};
-	}
-	return {{ENOENT, std::system_category()}};
+	StateInBuf inBuf{data, size};
+	std::istream stream{&inBuf};
+	if(!gbEmu.loadState(stream))
+		return {{EIO, std::system_category()}};
+	else
+		return {{}};
+}
+
+void EmuSystem::willLoadStateFromFile()
+{
+	// write out battery RAM before the state overwrites it, like gambatte's own loadState()
+	gbEmu.saveSavedata();
 }
 
 void EmuSystem::saveBackupMem()
@@ -303,17 +341,6 @@ void EmuSystem::savePathChanged()
 		gbEmu.setSaveDir(savePath());
 }
 
-void EmuSystem::saveAutoState()
-{
-	if(gameIsRunning() && optionAutoSaveState)
-	{
-		logMsg("saving auto-state");
-		auto saveStr = sprintStateFilename(-1);
-		fixFilePermissions(saveStr);
-		gbEmu.saveState(/*screenBuff*/0, 160, saveStr.data());
-	}
-}
-
 void EmuSystem::closeSystem()
 {
 	saveBackupMem();
@@ -411,7 +438,7 @@ void EmuSystem::runFrame(bool renderGfx, bool processGfx, bool renderAudio)
 {
 	alignas(std::max_align_t) uint8 snd[(35112+2064)*4];
 	size_t samples = 35112;
-	int frameSample = gbEmu.runFor(processGfx ? screenBuff : nullptr, 160, (uint_least32_t*)snd, samples,
+	int frameSample = gbEmu.runFor(processGfx ? screenBuff : nullptr, 160, renderAudio ? (uint_least32_t*)snd : nullptr, samples,
 		renderGfx ? commitVideoFrame : nullptr);
 	if(renderAudio)
 	{
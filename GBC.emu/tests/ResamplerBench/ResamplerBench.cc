@@ -0,0 +1,175 @@
+/*  This file is part of GBC.emu.
+
+	GBC.emu is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	GBC.emu is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with GBC.emu.  If not, see <http://www.gnu.org/licenses/> */
+
+// Checks every polyphaseFirDot2 variant the CPU supports against a scalar
+// loop on random and full-scale taps, timing each per tap, then times every
+// ResamplerInfo entry per input sample on a frame of square waves with the
+// variant polyphaseFirDot2() picks at runtime.
+// Build & run from GBC.emu:
+// c++ -std=gnu++14 -O2 -Isrc/common -Isrc/common/resample/src tests/ResamplerBench/ResamplerBench.cc \
+//  src/common/resample/src/{resamplerinfo,makesinckernel,chainresampler,u48div,i0,kaiser50sinc,kaiser70sinc}.cpp \
+//  -o ResamplerBench && ./ResamplerBench
+
+#include "../resampler.h"
+#include "../resamplerinfo.h"
+#include "polyphasefir.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+struct Dot2Variant
+{
+	const char *name;
+	PolyphaseFirDot2 *dot2;
+};
+
+static std::vector<Dot2Variant> supportedVariants()
+{
+	std::vector<Dot2Variant> variants;
+	#ifdef POLYPHASEFIR_X86
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("sse2"))
+		variants.push_back({"SSE2", polyphaseFirDot2SSE2});
+	if(__builtin_cpu_supports("avx2"))
+		variants.push_back({"AVX2", polyphaseFirDot2AVX2});
+	#endif
+	#ifdef POLYPHASEFIR_NEON
+	variants.push_back({"NEON", polyphaseFirDot2NEON});
+	#endif
+	return variants;
+}
+
+static void dot2Scalar(long &accl, long &accr, short const *k, short const *s, std::size_t n)
+{
+	for(std::size_t i = 0; i < n; i++)
+	{
+		accl += k[i] * s[i * 2];
+		accr += k[i] * s[i * 2 + 1];
+	}
+}
+
+static std::mt19937 rng;
+
+// Half the inputs use only the extreme values so the 32-bit sums wrap
+static void randomFill(std::vector<short> &v, bool fullScale)
+{
+	for(auto &x : v)
+		x = fullScale ? (rng() & 1 ? 32767 : -32768) : (short)rng();
+}
+
+static bool checkDot2(const Dot2Variant &variant, std::size_t n, bool fullScale)
+{
+	std::vector<short> k(n), s(n * 2);
+	randomFill(k, fullScale);
+	randomFill(s, fullScale);
+	long refl = 0, refr = 0, accl = 0, accr = 0;
+	dot2Scalar(refl, refr, k.data(), s.data(), n);
+	variant.dot2(accl, accr, k.data(), s.data(), n);
+	// only the low 32 bits reach rshift16_round's short output
+	if((uint32_t)accl != (uint32_t)refl || (uint32_t)accr != (uint32_t)refr)
+	{
+		fprintf(stderr, "%s: %zu taps%s: got %08X %08X, expected %08X %08X\n", variant.name, n,
+			fullScale ? " full scale" : "", (unsigned)accl, (unsigned)accr, (unsigned)refl, (unsigned)refr);
+		return false;
+	}
+	return true;
+}
+
+template<class Func>
+static double timeDot2(Func &&dot2, std::size_t n)
+{
+	static constexpr unsigned reps = 200000;
+	std::vector<short> k(n), s(n * 2);
+	randomFill(k, false);
+	randomFill(s, false);
+	long accl = 0, accr = 0;
+	auto start = std::chrono::steady_clock::now();
+	for(unsigned i = 0; i < reps; i++)
+	{
+		dot2(accl, accr, k.data(), s.data(), n);
+		// keep the calls from being folded together
+		asm volatile("" : "+r"(accl), "+r"(accr));
+	}
+	std::chrono::duration<double, std::nano> time = std::chrono::steady_clock::now() - start;
+	return time.count() / (reps * n);
+}
+
+static void benchResamplers(long inputRate, long outputRate)
+{
+	static constexpr unsigned frameSamples = 35112, frames = 120;
+	std::vector<short> in(frameSamples * 2);
+	// pulse channel-like square waves plus a little noise
+	for(unsigned i = 0; i < frameSamples; i++)
+	{
+		short noise = rng() & 0xff;
+		in[i * 2] = ((i / 1193) & 1 ? 6000 : -6000) + noise;
+		in[i * 2 + 1] = ((i / 887) & 1 ? 4000 : -4000) - noise;
+	}
+	for(std::size_t r = 0; r < ResamplerInfo::num(); r++)
+	{
+		std::unique_ptr<Resampler> rs{ResamplerInfo::get(r).create(inputRate, outputRate, frameSamples)};
+		std::vector<short> out(rs->maxOut(frameSamples) * 2);
+		auto start = std::chrono::steady_clock::now();
+		for(unsigned f = 0; f < frames; f++)
+		{
+			rs->resample(out.data(), in.data(), frameSamples);
+		}
+		std::chrono::duration<double, std::nano> time = std::chrono::steady_clock::now() - start;
+		printf("%ld -> %ld Hz, %s: %.3f ns/sample\n", inputRate, outputRate, ResamplerInfo::get(r).desc,
+			time.count() / (frameSamples * frames));
+	}
+}
+
+int main()
+{
+	static const std::size_t tapCounts[] = { 8, 16, 24, 40, 64, 136, 264, 1000 };
+	int failed = 0;
+	auto variants = supportedVariants();
+	for(auto &variant : variants)
+	{
+		int checked = 0;
+		for(unsigned i = 0; i < 2000; i++)
+		{
+			if(!checkDot2(variant, 8 * (1 + i % 64), i & 1))
+			{
+				failed = 1;
+				break;
+			}
+			checked++;
+		}
+		printf("%s: %d of 2000 dot products matched\n", variant.name, checked);
+	}
+	for(auto n : tapCounts)
+	{
+		printf("%4zu taps: scalar %.3f ns/tap", n, timeDot2(dot2Scalar, n));
+		for(auto &variant : variants)
+			printf(", %s %.3f", variant.name, timeDot2(variant.dot2, n));
+		printf("\n");
+	}
+	const char *selected = "none, scalar loop";
+	for(auto &variant : variants)
+	{
+		if(variant.dot2 == polyphaseFirDot2())
+			selected = variant.name;
+	}
+	printf("polyphaseFirDot2() selects %s\n", selected);
+	// output rates for 48, 44.1 and 22.05 kHz at 59.73 fps
+	for(long outputRate : { 48000L, 44100L, 22050L })
+		benchResamplers(2097152, outputRate);
+	return failed;
+}
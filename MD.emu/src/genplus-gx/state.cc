@@ -98,18 +98,26 @@ static uint oldStateSizeAfterVDP(int exVersion, bool is64Bit)
 
 std::system_error state_load(const unsigned char *buffer)
 {
-	auto state = std::make_unique<unsigned char[]>(STATE_SIZE);
+	// not value-initialized, only the bytes read from the buffer are used
+	std::unique_ptr<unsigned char[]> state{new unsigned char[STATE_SIZE]};
 
   /* buffer size */
   uint bufferptr = 0;
 
-  /* uncompress savestate */
   uint32 inbytes32;
   memcpy(&inbytes32, buffer, 4);
-  unsigned long inbytes = inbytes32;
+  unsigned long inbytes = inbytes32 & ~STATE_UNCOMPRESSED_FLAG;
   unsigned long outbytes = STATE_SIZE;
-  logMsg("uncompressing %d bytes to buffer of %d size", (int)inbytes, (int)outbytes);
+  if(inbytes32 & STATE_UNCOMPRESSED_FLAG)
   {
+  	if(inbytes > STATE_SIZE)
+  		return {{ECANCELED, std::system_category()}, "State data is too large"};
+  	memcpy(state.get(), buffer + 4, inbytes);
+  	outbytes = inbytes;
+  }
+  else
+  {
+  	/* uncompress savestate */
   	int result = uncompress((Bytef *)state.get(), &outbytes, (Bytef *)(buffer + 4), inbytes);
 		if(result != Z_OK)
 		{
@@ -295,9 +303,11 @@ std::system_error state_load(const unsigned char *buffer)
   return {{}};
 }
 
-int state_save(unsigned char *buffer)
+int state_save(unsigned char *buffer, bool compress)
 {
-	auto state = std::make_unique<unsigned char[]>(STATE_SIZE);
+	// uncompressed states are written straight after the size header
+	std::unique_ptr<unsigned char[]> stateBuff{compress ? new unsigned char[STATE_SIZE] : nullptr};
+	unsigned char *state = compress ? stateBuff.get() : buffer + 4;
 
   /* buffer size */
   int bufferptr = 0;
@@ -393,12 +403,17 @@ int state_save(unsigned char *buffer)
 	}
 	#endif
 
+  if(!compress)
+  {
+    uint32 header = bufferptr | STATE_UNCOMPRESSED_FLAG;
+    memcpy(buffer, &header, 4);
+    return bufferptr + 4;
+  }
+
   /* compress state file */
   unsigned long inbytes   = bufferptr;
-  unsigned long outbytes  = STATE_SIZE;
-  logMsg("compressing %d bytes to buffer of %d size", (int)inbytes, (int)outbytes);
-  int ret = compress2 ((Bytef *)(buffer + 4), &outbytes, (Bytef *)state.get(), inbytes, 9);
-  logMsg("compress2 returned %d, reduced to %d bytes", ret, (int)outbytes);
+  unsigned long outbytes  = compressBound(inbytes);
+  compress2 ((Bytef *)(buffer + 4), &outbytes, (Bytef *)state, inbytes, 9);
   uint32 outbytes32 = outbytes; // assumes no save states will ever be over 4GB
   memcpy(buffer, &outbytes32, 4);
 
@@ -32,6 +32,8 @@
 #define STATE_SIZE    0x48100
 #endif
 #define STATE_VERSION "GENPLUS-GX 1.5.3"
+// set in the 4-byte size header when the state data follows uncompressed
+#define STATE_UNCOMPRESSED_FLAG 0x80000000
 
 #define load_param(param, size) \
   memcpy(param, &state[bufferptr], size); \
@@ -43,6 +45,6 @@
 
 /* Function prototypes */
 std::system_error state_load(const unsigned char *buffer);
-int state_save(unsigned char *buffer);
+int state_save(unsigned char *buffer, bool compress = true);
 
 #endif
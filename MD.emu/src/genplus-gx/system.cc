@@ -31,6 +31,7 @@
 #include <scd/scd.h>
 #include <scd/pcm.h>
 #endif
+#include <scd/profile.h>
 
 /* Global variables */
 //t_bitmap bitmap;
@@ -133,6 +134,7 @@ void audio_shutdown(void)
 template <bool hasSegaCD>
 int audioUpdateAll(int16 *sb)
 {
+  SCD_PROFILE_SCOPE(SCD_PROF_SOUND);
   int32 i, l, r;
   int32 ll = llp;
   int32 rr = rrp;
@@ -158,6 +160,7 @@ int audioUpdateAll(int16 *sb)
 	bool doPCM = hasSegaCD && (sCD.pcm.control & 0x80) && sCD.pcm.enabled;
 	if(doPCM)
 	{
+		SCD_PROFILE_SCOPE(SCD_PROF_PCM);
 		scd_pcm_update(cdPCMBuff, size, 1);
 	}
 	auto cddaRatio = snd.cddaRatio;
@@ -166,9 +169,14 @@ int audioUpdateAll(int16 *sb)
 	int16 *cdda = cddaBuff;
 	int16 cddaRemsampledBuff[size*2];
 	extern int readCDDA(void *dest, uint size);
-	bool doCDDA = hasSegaCD && readCDDA(cddaBuff, cddaFrames);
+	bool doCDDA;
+	{
+		SCD_PROFILE_SCOPE(SCD_PROF_CDDA);
+		doCDDA = hasSegaCD && readCDDA(cddaBuff, cddaFrames);
+	}
 	if(doCDDA && snd.sample_rate != 44100)
 	{
+		SCD_PROFILE_SCOPE(SCD_PROF_CDDA);
 		auto cddaPtr = (int32*)cddaBuff;
 		auto cddaResampledPtr = (int32*)cddaRemsampledBuff;
 		iterateTimes(size, i)
@@ -340,7 +348,10 @@ void system_shutdown (void)
 template <bool hasSegaCD>
 static void runM68k(uint cycles)
 {
-	m68k_run(mm68k, cycles);
+	{
+		SCD_PROFILE_SCOPE(SCD_PROF_MAIN_CPU);
+		m68k_run(mm68k, cycles);
+	}
 	#ifndef NO_SCD
 		if(hasSegaCD)
 		{
@@ -356,6 +367,9 @@ template <bool hasSegaCD>
 static void system_frame_md(int do_skip, uint renderGfx)
 {
 	//logMsg("start frame");
+	scd_profileFrame();
+	SCD_PROFILE_SCOPE(SCD_PROF_FRAME);
+
   /* line counter */
   int line = 0;
 
@@ -521,7 +535,8 @@ static void system_frame_md(int do_skip, uint renderGfx)
     /* render scanline */
     if (!do_skip)
     {
-      render_line(line);
+      SCD_PROFILE_SCOPE(SCD_PROF_VDP);
+      render_line_deferred(line);
     }
 
     /* run 68k & Z80 */
@@ -553,6 +568,12 @@ static void system_frame_md(int do_skip, uint renderGfx)
   }
   while (++line < bitmap.viewport.h);
 
+  /* finish lines still being rendered */
+  {
+    SCD_PROFILE_SCOPE(SCD_PROF_VDP);
+    render_sync();
+  }
+
   void commitVideoFrame();
   if(renderGfx) commitVideoFrame();
 
@@ -888,7 +909,7 @@ static void system_frame_sms(int do_skip, uint renderGfx)
       /* render scanline */
       if (!do_skip)
       {
-        render_line(line);
+        render_line_deferred(line);
       }
     }
 
@@ -926,6 +947,9 @@ static void system_frame_sms(int do_skip, uint renderGfx)
   }
   while (++line < bitmap.viewport.h);
 
+  /* finish lines still being rendered */
+  render_sync();
+
   void commitVideoFrame();
   if(renderGfx) commitVideoFrame();
 
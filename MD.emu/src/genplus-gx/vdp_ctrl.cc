@@ -198,6 +198,9 @@ void vdp_init(void)
 
 void vdp_reset(void)
 {
+  /* Finish deferred lines before changing VDP state */
+  render_sync();
+
   memset ((char *) sat.b, 0, sizeof (sat));
   memset ((char *) vram.b, 0, sizeof (vram));
   memset ((char *) cram.b, 0, sizeof (cram));
@@ -336,6 +339,9 @@ int vdp_context_load(uint8 *state)
   int i, bufferptr = 0;
   uint8 temp_reg[0x20];
 
+  /* Finish deferred lines before changing VDP state */
+  render_sync();
+
   load_param(sat.b, sizeof(sat));
   load_param(vram.b, sizeof(vram));
   load_param(cram.b, sizeof(cram));
@@ -410,6 +416,9 @@ int vdp_context_load(uint8 *state)
 
 void vdp_dma_update(unsigned int cycles)
 {
+  /* Finish deferred lines before changing VDP state */
+  render_sync();
+
   int dma_cycles;
 
   /* DMA transfer rate (bytes per line)
@@ -548,6 +557,9 @@ void vdp_dma_update(unsigned int cycles)
 
 void vdp_68k_ctrl_w(unsigned int data)
 {
+  /* Finish deferred lines before changing VDP state */
+  render_sync();
+
   /* Check pending flag */
   if (pending == 0)
   {
@@ -690,6 +702,9 @@ void vdp_68k_ctrl_w(unsigned int data)
 
 void vdp_z80_ctrl_w(unsigned int data)
 {
+  /* Finish deferred lines before changing VDP state */
+  render_sync();
+
   switch (pending)
   {
     case 0:
@@ -821,6 +836,9 @@ void vdp_z80_ctrl_w(unsigned int data)
  */
 unsigned int vdp_68k_ctrl_r(unsigned int cycles)
 {
+  /* Finish deferred lines, they can set status flags */
+  render_sync();
+
   /* Update FIFO flags */
   vdp_fifo_update(cycles);
 
@@ -879,6 +897,9 @@ unsigned int vdp_68k_ctrl_r(unsigned int cycles)
 
 unsigned int vdp_z80_ctrl_r(unsigned int cycles)
 {
+  /* Finish deferred lines, they can set status flags */
+  render_sync();
+
   /* Update DMA Busy flag (Mega Drive VDP specific) */
   if (/*(system_hw & SYSTEM_MD) &&*/ (status & 2) && !dma_length && (cycles >= dma_endCycles))
   {
@@ -1062,6 +1083,7 @@ int vdp_68k_irq_ack(M68KCPU &m68ki_cpu, int int_level)
 
     /* Clear VINT pending flag */
     vint_pending = 0;
+    render_sync(); /* deferred lines can still set status flags */
     status &= ~0x80;
 
     /* Update IRQ status */
@@ -1834,6 +1856,9 @@ static void vdp_bus_w(unsigned int data)
 
 static void vdp_68k_data_w_m4(unsigned int data)
 {
+  /* Finish deferred lines before changing VDP state */
+  render_sync();
+
   /* Clear pending flag */
   pending = 0;
 
@@ -1923,6 +1948,9 @@ static void vdp_68k_data_w_m4(unsigned int data)
 
 static void vdp_68k_data_w_m5(unsigned int data)
 {
+  /* Finish deferred lines before changing VDP state */
+  render_sync();
+
   /* Clear pending flag */
   pending = 0;
 
@@ -2058,6 +2086,9 @@ static unsigned int vdp_68k_data_r_m5(void)
 
 static void vdp_z80_data_w_m4(unsigned int data)
 {
+  /* Finish deferred lines before changing VDP state */
+  render_sync();
+
   /* Clear pending flag */
   pending = 0;
 
@@ -2109,6 +2140,9 @@ static void vdp_z80_data_w_m4(unsigned int data)
 
 static void vdp_z80_data_w_m5(unsigned int data)
 {
+  /* Finish deferred lines before changing VDP state */
+  render_sync();
+
   /* Clear pending flag */
   pending = 0;
 
@@ -2288,6 +2322,9 @@ static unsigned int vdp_z80_data_r_m5(void)
 #if 0
 static void vdp_z80_data_w_ms(unsigned int data)
 {
+  /* Finish deferred lines before changing VDP state */
+  render_sync();
+
   /* Clear pending flag */
   pending = 0;
 
@@ -2353,6 +2390,9 @@ static void vdp_z80_data_w_ms(unsigned int data)
 
 static void vdp_z80_data_w_gg(unsigned int data)
 {
+  /* Finish deferred lines before changing VDP state */
+  render_sync();
+
   /* Clear pending flag */
   pending = 0;
 
@@ -2426,6 +2466,9 @@ static void vdp_z80_data_w_gg(unsigned int data)
 
 static void vdp_z80_data_w_sg(unsigned int data)
 {
+  /* Finish deferred lines before changing VDP state */
+  render_sync();
+
   /* Clear pending flag */
   pending = 0;
 
@@ -22,6 +22,8 @@
  ****************************************************************************************/
 
 #include "shared.h"
+#include <imagine/thread/Thread.hh>
+#include <imagine/thread/Semaphore.hh>
 
 #ifdef NGC
 #include "md_ntsc.h"
@@ -415,7 +417,7 @@ static __inline__ void WRITE_LONG(void *address, uint32 data)
       lb[i] = TABLE[temp | ATTR]; \
       if ((temp & 0x8000) && !(status & 0x20)) \
       { \
-        spr_col = (v_counter << 8) | ((xpos + i + 13) >> 1); \
+        spr_col = (render_vc << 8) | ((xpos + i + 13) >> 1); \
         status |= 0x20; \
       } \
     } \
@@ -431,7 +433,7 @@ static __inline__ void WRITE_LONG(void *address, uint32 data)
       lb[i] = TABLE[temp | ATTR]; \
       if ((temp & 0x8000) && !(status & 0x20)) \
       { \
-        spr_col = (v_counter << 8) | ((xpos + i + 13) >> 1); \
+        spr_col = (render_vc << 8) | ((xpos + i + 13) >> 1); \
         status |= 0x20; \
       } \
       temp &= 0x00FF; \
@@ -439,7 +441,7 @@ static __inline__ void WRITE_LONG(void *address, uint32 data)
       lb[i+1] = TABLE[temp | ATTR]; \
       if ((temp & 0x8000) && !(status & 0x20)) \
       { \
-        spr_col = (v_counter << 8) | ((xpos + i + 1 + 13) >> 1); \
+        spr_col = (render_vc << 8) | ((xpos + i + 1 + 13) >> 1); \
         status |= 0x20; \
       } \
     } \
@@ -539,6 +541,9 @@ uint8 object_count;
 /* Sprite Collision Info */
 uint16 spr_col;
 
+/* V Counter of the line being drawn (used for sprite collision info) */
+static uint16 render_vc;
+
 /* Function pointers */
 void (*render_bg)(int line, int width);
 void (*render_obj)(int max_width);
@@ -3725,7 +3730,7 @@ void render_reset(void)
 /* Line rendering functions                                                 */
 /*--------------------------------------------------------------------------*/
 
-void render_line(int line)
+static void draw_line(int line)
 {
   int width = bitmap.viewport.w;
 
@@ -3775,6 +3780,12 @@ void render_line(int line)
   remap_line(line);
 }
 
+void render_line(int line)
+{
+  render_vc = v_counter;
+  draw_line(line);
+}
+
 void blank_line(int line, int offset, int width)
 {
   memset(&linebuf[0][0x20 + offset], 0x40, width);
@@ -3812,3 +3823,85 @@ void remap_line(int line)
 	}
 	while (--width);
 }
+
+/*--------------------------------------------------------------------------*/
+/* Deferred line rendering                                                  */
+/*--------------------------------------------------------------------------*/
+
+/* When threaded rendering is enabled, active display lines are queued by     */
+/* render_line_deferred() and drawn by a worker thread while the CPUs run the */
+/* next line. VDP accesses that could change a queued line, or that read back */
+/* renderer results (status flags, sprite collision), call render_sync()      */
+/* first, so the output is the same as drawing each line in place.            */
+
+#define RENDER_QUEUE_SIZE 256
+
+static struct
+{
+  int line;
+  uint16 v_counter;
+} render_queue[RENDER_QUEUE_SIZE];
+
+static unsigned int render_queue_head;  /* next free entry (emulation thread) */
+static unsigned int render_queue_tail;  /* next line to draw (worker thread)  */
+static uint8 render_threaded;
+static uint8 render_thread_started;
+static IG::Semaphore render_start_sem{0};
+static IG::Semaphore render_done_sem{0};
+
+/* Lines queued and not yet waited on */
+int render_queued;
+
+static void render_thread(void)
+{
+  for (;;)
+  {
+    render_start_sem.wait();
+    unsigned int index = render_queue_tail++ % RENDER_QUEUE_SIZE;
+    render_vc = render_queue[index].v_counter;
+    draw_line(render_queue[index].line);
+    render_done_sem.notify();
+  }
+}
+
+void render_set_threaded(int enable)
+{
+  render_sync();
+
+  if (enable && !render_thread_started)
+  {
+    render_thread_started = 1;
+    IG::makeDetachedThread([](){ render_thread(); });
+  }
+
+  render_threaded = enable;
+}
+
+void render_line_deferred(int line)
+{
+  if (!render_threaded)
+  {
+    render_line(line);
+    return;
+  }
+
+  if (render_queued == RENDER_QUEUE_SIZE)
+  {
+    render_wait();
+  }
+
+  unsigned int index = render_queue_head++ % RENDER_QUEUE_SIZE;
+  render_queue[index].line = line;
+  render_queue[index].v_counter = v_counter;
+  render_queued++;
+  render_start_sem.notify();
+}
+
+void render_wait(void)
+{
+  while (render_queued)
+  {
+    render_done_sem.wait();
+    render_queued--;
+  }
+}
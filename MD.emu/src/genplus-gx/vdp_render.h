@@ -34,6 +34,9 @@ extern void render_reset(void);
 extern void render_line(int line);
 extern void blank_line(int line, int offset, int width);
 extern void remap_line(int line);
+extern void render_set_threaded(int enable);
+extern void render_line_deferred(int line);
+extern void render_wait(void);
 extern void window_clip(unsigned int data, unsigned int sw);
 extern void render_bg_m4(int line, int width);
 extern void render_bg_m5(int line, int width);
@@ -58,5 +61,15 @@ extern void (*render_obj)(int max_width);
 extern void (*parse_satb)(int line);
 extern void (*update_bg_pattern_cache)(int index);
 
+/* Wait for lines queued by render_line_deferred() to be drawn */
+extern int render_queued;
+static inline void render_sync(void)
+{
+  if (render_queued)
+  {
+    render_wait();
+  }
+}
+
 #endif /* _RENDER_H_ */
 
@@ -21,11 +21,23 @@ class EmuVideoOptionView : public VideoOptionView
 		videoSystemItem
 	};
 
+	BoolMenuItem threadedRender
+	{
+		"Threaded VDP Rendering",
+		(bool)optionThreadedRender,
+		[this](BoolMenuItem &item, View &, Input::Event e)
+		{
+			optionThreadedRender = item.flipBoolValue(*this);
+			applyThreadedRenderOption();
+		}
+	};
+
 public:
 	EmuVideoOptionView(Base::Window &win): VideoOptionView{win, true}
 	{
 		loadStockItems();
 		item.emplace_back(&videoSystem);
+		item.emplace_back(&threadedRender);
 	}
 };
 
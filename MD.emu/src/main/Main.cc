@@ -14,6 +14,7 @@
 	along with MD.emu.  If not, see <http://www.gnu.org/licenses/> */
 
 #define LOGTAG "main"
+#include <thread>
 #include <emuframework/EmuApp.hh>
 #include <emuframework/EmuInput.hh>
 #include <emuframework/EmuAppInlines.hh>
@@ -27,6 +28,7 @@
 #include "state.h"
 #include "sound.h"
 #include "vdp_ctrl.h"
+#include "vdp_render.h"
 #include "genesis.h"
 #include "genplus-config.h"
 #include "EmuConfig.hh"
@@ -35,6 +37,7 @@
 #endif
 #include <fileio/fileio.h>
 #include "Cheats.hh"
+#include <zlib.h>
 
 const char *EmuSystem::creditsViewStr = CREDITS_INFO_STRING "(c) 2011-2014\nRobert Broglia\nwww.explusalpha.com\n\nPortions (c) the\nGenesis Plus Team\ncgfm2.emuviews.com";
 t_config config{};
@@ -93,6 +96,7 @@ enum {
 	CFGKEY_6_BTN_PAD = 280, CFGKEY_MD_CD_BIOS_USA_PATH = 281,
 	CFGKEY_MD_CD_BIOS_JPN_PATH = 282, CFGKEY_MD_CD_BIOS_EUR_PATH = 283,
 	CFGKEY_MD_REGION = 284, CFGKEY_VIDEO_SYSTEM = 285,
+	CFGKEY_THREADED_RENDER = 286,
 };
 
 bool usingMultiTap = false;
@@ -107,6 +111,7 @@ PathOption optionCDBiosJpnPath{CFGKEY_MD_CD_BIOS_JPN_PATH, cdBiosJpnPath, ""};
 PathOption optionCDBiosEurPath{CFGKEY_MD_CD_BIOS_EUR_PATH, cdBiosEurPath, ""};
 #endif
 Byte1Option optionVideoSystem{CFGKEY_VIDEO_SYSTEM, 0};
+Byte1Option optionThreadedRender{CFGKEY_THREADED_RENDER, 0};
 static uint autoDetectedVidSysPAL = 0;
 
 const char *EmuSystem::inputFaceBtnName = "A/B/C";
@@ -150,6 +155,15 @@ void EmuSystem::onOptionsLoaded()
 	vController.gp.activeFaceBtns = option6BtnPad ? 6 : 3;
 	#endif
 	config_ym2413_enabled = optionSmsFM;
+	applyThreadedRenderOption();
+}
+
+void applyThreadedRenderOption()
+{
+	// the worker only helps when it gets a core of its own
+	bool threaded = optionThreadedRender && std::thread::hardware_concurrency() > 1;
+	logMsg("threaded VDP rendering %s", threaded ? "on" : "off");
+	render_set_threaded(threaded);
 }
 
 bool EmuSystem::readConfig(IO &io, uint key, uint readSize)
@@ -175,6 +189,7 @@ bool EmuSystem::readConfig(IO &io, uint key, uint readSize)
 				optionRegion = 0;
 		}
 		bcase CFGKEY_VIDEO_SYSTEM: optionVideoSystem.readFromIO(io, readSize);
+		bcase CFGKEY_THREADED_RENDER: optionThreadedRender.readFromIO(io, readSize);
 		bdefault: return 0;
 	}
 	return 1;
@@ -186,6 +201,7 @@ void EmuSystem::writeConfig(IO &io)
 	optionSmsFM.writeWithKeyIfNotDefault(io);
 	option6BtnPad.writeWithKeyIfNotDefault(io);
 	optionVideoSystem.writeWithKeyIfNotDefault(io);
+	optionThreadedRender.writeWithKeyIfNotDefault(io);
 	#ifndef NO_SCD
 	optionCDBiosUsaPath.writeToIO(io);
 	optionCDBiosJpnPath.writeToIO(io);
@@ -345,38 +361,34 @@ static FS::PathString sprintBRAMSaveFilename()
 
 static const uint maxSaveStateSize = STATE_SIZE+4;
 
-static std::error_code saveMDState(const char *path)
+std::error_code EmuSystem::saveStateToBuffer(std::vector<uint8_t> &buff)
 {
-	auto stateData = std::make_unique<uchar[]>(maxSaveStateSize);
-	if(!stateData)
-		return {ENOMEM, std::system_category()};
-	logMsg("saving state data");
-	int size = state_save(stateData.get());
-	logMsg("writing to file");
-	auto ec = writeToNewFile(path, stateData.get(), size);
-	if(ec)
-	{
-		logMsg("error writing state file");
-		return ec;
-	}
-	logMsg("wrote %d byte state", size);
+	buff.resize(maxSaveStateSize);
+	// stored uncompressed so run-ahead and rewind can snapshot every few frames
+	int size = state_save(buff.data(), false);
+	buff.resize(size);
 	return {};
 }
 
-static std::system_error loadMDState(const char *path)
+std::error_code EmuSystem::saveStateToFileBuffer(std::vector<uint8_t> &buff)
 {
-	FileIO f;
-	auto ec = f.open(path);
-	if(ec)
-	{
-		return {ec};
-	}
-	auto stateData = (const uchar *)f.mmapConst();
-	if(!stateData)
+	// state files keep the zlib format older versions read
+	buff.resize(compressBound(STATE_SIZE) + 4);
+	int size = state_save(buff.data());
+	buff.resize(size);
+	return {};
+}
+
+std::system_error EmuSystem::loadStateFromBuffer(const uint8_t *data, size_t size)
+{
+	uint32_t dataSize = 0;
+	if(size >= 4)
+		memcpy(&dataSize, data, 4);
+	if(size < 4 || (dataSize & ~STATE_UNCOMPRESSED_FLAG) > size - 4)
 	{
-		return {{EIO, std::system_category()}};
+		return {{EIO, std::system_category()}, "State data is truncated"};
 	}
-	auto err = state_load(stateData);
+	auto err = state_load(data);
 	if(err.code())
 	{
 		return err;
@@ -385,21 +397,6 @@ static std::system_error loadMDState(const char *path)
 	return {{}};
 }
 
-std::error_code EmuSystem::saveState()
-{
-	auto saveStr = sprintStateFilename(saveStateSlot);
-	fixFilePermissions(saveStr);
-	logMsg("saving state %s", saveStr.data());
-	return saveMDState(saveStr.data());
-}
-
-std::system_error EmuSystem::loadState(int saveStateSlot)
-{
-	auto saveStr = sprintStateFilename(saveStateSlot);
-	logMsg("loading state %s", saveStr.data());
-	return loadMDState(saveStr.data());
-}
-
 void EmuSystem::saveBackupMem() // for manually saving when not closing game
 {
 	if(!gameIsRunning())
@@ -452,16 +449,6 @@ void EmuSystem::saveBackupMem() // for manually saving when not closing game
 	writeCheatFile();
 }
 
-void EmuSystem::saveAutoState()
-{
-	if(gameIsRunning() && optionAutoSaveState)
-	{
-		auto saveStr = sprintStateFilename(-1);
-		fixFilePermissions(saveStr);
-		saveMDState(saveStr.data());
-	}
-}
-
 void EmuSystem::closeSystem()
 {
 	saveBackupMem();
@@ -17,6 +17,8 @@ extern PathOption optionCDBiosJpnPath;
 extern PathOption optionCDBiosEurPath;
 #endif
 extern Byte1Option optionVideoSystem;
+extern Byte1Option optionThreadedRender;
 
 void setupMDInput();
+void applyThreadedRenderOption();
 bool hasMDExtension(const char *name);
@@ -6,9 +6,18 @@
 
 
 #include "scd.h"
+#include "profile.h"
 #include <imagine/logger/logger.h>
 #include <string.h>
 
+#if defined(__SSE2__)
+#define GFX_CD_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define GFX_CD_NEON
+#include <arm_neon.h>
+#endif
+
 static const int Table_Rot_Time[] =
 {
 	0x00054000, 0x00048000, 0x00040000, 0x00036000,          //; 008-032               ; briefing - sprite
@@ -83,15 +92,177 @@ static void gfx_completed(Rot_Comp &rot_comp)
 }
 
 
-static void gfx_do(Rot_Comp &rot_comp, unsigned int func, unsigned short *stamp_base, unsigned int H_Dot)
+// Writes the dots collected for one 8 dot group of the image buffer with a
+// single 32-bit read-modify-write. Dot n of a group is the high (even n) or
+// low (odd n) nibble of byte (n>>1)^1, so with word RAM stored little-endian
+// each dot has a fixed nibble in the group's word.
+template <unsigned int func>
+static void gfx_flush_dots(unsigned int Buffer_Adr, uint32 dots, uint32 dot_mask)
+{
+	uint32a &word = *(uint32a*)(sCD.word.ram2M + Buffer_Adr);
+	uint32 old = word;
+	if ((func & 0x18) == 0x08) // underwrite, only fill dots that are 0
+	{
+		uint32 used = (old | (old >> 1) | (old >> 2) | (old >> 3)) & 0x11111111;
+		dot_mask &= (used ^ 0x11111111) * 0xf;
+	}
+	word = (old & ~dot_mask) | (dots & dot_mask);
+}
+
+static inline unsigned int gfx_dot_shift(unsigned int XD)
+{
+	return (((XD >> 1) ^ 1) << 3) | ((~XD & 1) << 2);
+}
+
+#if defined(GFX_CD_SSE2) || defined(GFX_CD_NEON)
+#define GFX_CD_SIMD
+
+// 4 x 32-bit lanes
+struct StampVec
+{
+#ifdef GFX_CD_SSE2
+	__m128i v;
+	static StampVec dup(uint32 x) { return {_mm_set1_epi32(x)}; }
+	static StampVec load(const uint32 *p) { return {_mm_loadu_si128((const __m128i*)p)}; }
+	void store(uint32 *p) const { _mm_storeu_si128((__m128i*)p, v); }
+	StampVec operator+(StampVec o) const { return {_mm_add_epi32(v, o.v)}; }
+	StampVec operator&(StampVec o) const { return {_mm_and_si128(v, o.v)}; }
+	StampVec operator|(StampVec o) const { return {_mm_or_si128(v, o.v)}; }
+	StampVec operator^(StampVec o) const { return {_mm_xor_si128(v, o.v)}; }
+	template <int S> StampVec shr() const { return {_mm_srli_epi32(v, S)}; }
+	template <int S> StampVec shl() const { return {_mm_slli_epi32(v, S)}; }
+	StampVec eqZero() const { return {_mm_cmpeq_epi32(v, _mm_setzero_si128())}; }
+	// lanes of this mask select a, others b
+	StampVec sel(StampVec a, StampVec b) const { return {_mm_or_si128(_mm_and_si128(v, a.v), _mm_andnot_si128(v, b.v))}; }
+	bool any() const { return _mm_movemask_epi8(v); }
+#else
+	uint32x4_t v;
+	static StampVec dup(uint32 x) { return {vdupq_n_u32(x)}; }
+	static StampVec load(const uint32 *p) { return {vld1q_u32(p)}; }
+	void store(uint32 *p) const { vst1q_u32(p, v); }
+	StampVec operator+(StampVec o) const { return {vaddq_u32(v, o.v)}; }
+	StampVec operator&(StampVec o) const { return {vandq_u32(v, o.v)}; }
+	StampVec operator|(StampVec o) const { return {vorrq_u32(v, o.v)}; }
+	StampVec operator^(StampVec o) const { return {veorq_u32(v, o.v)}; }
+	template <int S> StampVec shr() const { return {vshrq_n_u32(v, S)}; }
+	template <int S> StampVec shl() const { return {vshlq_n_u32(v, S)}; }
+	StampVec eqZero() const { return {vceqq_u32(v, vdupq_n_u32(0))}; }
+	StampVec sel(StampVec a, StampVec b) const { return {vbslq_u32(v, a.v, b.v)}; }
+	bool any() const
+	{
+		uint32x2_t t = vorr_u32(vget_low_u32(v), vget_high_u32(v));
+		return vget_lane_u32(vpmax_u32(t, t), 0);
+	}
+#endif
+	StampVec nonZero() const { return eqZero() ^ dup(0xffffffff); }
+};
+
+// Computes the 8 dots of a whole image buffer group at once, same as 8
+// passes of the scalar loop in gfx_do(). The stamp map and the stamp
+// pixels are still read one lane at a time. Returns false without drawing
+// if any of those reads hits the group's own word, since the scalar loop
+// would see the dots it already wrote there.
+template <unsigned int func>
+static bool gfx_do_group(const unsigned short *stamp_base, unsigned int Stamp_Map_Adr,
+	unsigned int ecx, unsigned int edx, int DXS, int DYS, unsigned int Buffer_Adr, uint32 &dots)
+{
+	static const uint8 dot_shift[8] = { 12, 8, 4, 0, 28, 24, 20, 16 }; // gfx_dot_shift()
+	uint32 xs[8], ys[8], idx[8], stamp[8], addr[8], shift[8], valid_mask[8];
+	for (int i = 0; i < 8; i++)
+	{
+		xs[i] = ecx;
+		ys[i] = edx;
+		ecx += DXS;
+		edx += DYS;
+	}
+
+	const StampVec buffer_word = StampVec::dup(Buffer_Adr), word_mask = StampVec::dup(~3u);
+	StampVec conflict = StampVec::dup(0);
+	for (int h = 0; h < 8; h += 4)
+	{
+		StampVec x = StampVec::load(&xs[h]), y = StampVec::load(&ys[h]);
+		StampVec valid = StampVec::dup(0xffffffff);
+		if (!(func & 1))	// NOT TILED
+			valid = ((x | y) & StampVec::dup((func & 4) ? 0x00800000 : 0x00f80000)).eqZero();
+
+		StampVec ebx;
+		if (func & 2)		// mode 32x32 dot
+		{
+			if (func & 4)	// 16x16 screen
+				ebx = (x.shr<11+5>() & StampVec::dup(0x007f)) | (y.shr<11-2>() & StampVec::dup(0x3f80));
+			else		// 1x1 screen
+				ebx = (x.shr<11+5>() & StampVec::dup(0x07)) | (y.shr<11+2>() & StampVec::dup(0x38));
+		}
+		else			// mode 16x16 dot
+		{
+			if (func & 4)	// 16x16 screen
+				ebx = (x.shr<11+4>() & StampVec::dup(0x00ff)) | (y.shr<11-4>() & StampVec::dup(0xff00));
+			else		// 1x1 screen
+				ebx = (x.shr<11+4>() & StampVec::dup(0x0f)) | (y.shr<11+0>() & StampVec::dup(0xf0));
+		}
+		ebx.store(&idx[h]);
+		StampVec map_addr = StampVec::dup(Stamp_Map_Adr) + ebx + ebx;
+		conflict = conflict | (((map_addr ^ buffer_word) & word_mask).eqZero() & valid);
+		for (int i = h; i < h + 4; i++)
+			stamp[i] = stamp_base[idx[i]];
+
+		StampVec s = StampVec::load(&stamp[h]);
+		StampVec esi = (s & StampVec::dup(0x7ff)).shl<7>();
+		valid = valid & esi.nonZero();
+
+		// flip and rotation from stamp bits 13-15, as in the scalar switch:
+		// rotations 90 and 270 swap x & y, then the row and column within
+		// the stamp are optionally mirrored
+		StampVec b0 = (s & StampVec::dup(0x2000)).nonZero();
+		StampVec b1 = (s & StampVec::dup(0x4000)).nonZero();
+		StampVec flip = (s & StampVec::dup(0x8000)).nonZero();
+		StampVec row_flip = b1 ^ (flip & b0);
+		StampVec col_flip = b1 ^ (b0 | flip);
+		StampVec r = b0.sel(x, y), c = b0.sel(y, x);
+		StampVec row, col;
+		if (func & 2)
+		{
+			row = (r.shr<9>() & StampVec::dup(0x7c)) ^ (row_flip & StampVec::dup(0x7c));
+			col = (c.shr<7>() & StampVec::dup(0x180)) ^ (col_flip & StampVec::dup(0x180));
+		}
+		else
+		{
+			row = (r.shr<9>() & StampVec::dup(0x3c)) ^ (row_flip & StampVec::dup(0x3c));
+			col = (c.shr<8>() & StampVec::dup(0x40)) ^ (col_flip & StampVec::dup(0x40));
+		}
+		StampVec byte = (c.shr<12>() & StampVec::dup(3)) ^ StampVec::dup(1) ^ (col_flip & StampVec::dup(3));
+		StampVec a = esi + row + col + byte;
+		conflict = conflict | (((a ^ buffer_word) & word_mask).eqZero() & valid);
+		a.store(&addr[h]);
+		// high nibble unless bit 11 of the column picks the low one
+		((c.shr<9>() ^ col_flip ^ StampVec::dup(4)) & StampVec::dup(4)).store(&shift[h]);
+		(valid & StampVec::dup(0xf)).store(&valid_mask[h]);
+	}
+	if (conflict.any())
+		return false;
+
+	uint32 d = 0;
+	for (int i = 0; i < 8; i++)
+		d |= ((sCD.word.ram2M[addr[i]] >> shift[i]) & valid_mask[i]) << dot_shift[i];
+	dots = d;
+	return true;
+}
+#endif
+
+// func is the (stamp size | priority mode) value from gfx_cd_start(),
+// each combination gets its own copy of the loop with the mode tests folded
+template <unsigned int func>
+static void gfx_do(Rot_Comp &rot_comp, unsigned short *stamp_base, unsigned int H_Dot)
 {
 	//logMsg("func 0x%X", func);
 	unsigned int eax, ebx, ecx, edx, esi, edi, pixel;
-	unsigned int XD, Buffer_Adr;
+	unsigned int XD, Buffer_Adr, Buffer_Step;
 	int DYXS;
+	uint32 dots = 0, dot_mask = 0;
 
 	XD = rot_comp.imgBuffOffset & 7;
 	Buffer_Adr = ((rot_comp.imgBuffStartAddr & 0xfff8) + rot_comp.YD) << 2;
+	Buffer_Step = ((rot_comp.imgBuffVCallSize & 0x1f) + 1) << 5;
 	//if(rot_comp.imgBuffVDotSize == 40)
 		//logMsg("gfx buff 0x%X", Buffer_Adr);
 	ecx = *(uint32a*)(sCD.word.ram2M + rot_comp.Vector_Adr);
@@ -106,19 +277,34 @@ static void gfx_do(Rot_Comp &rot_comp, unsigned int func, unsigned short *stamp_
 	// MAKE_IMAGE_LINE
 	while (H_Dot)
 	{
-		// MAKE_IMAGE_PIXEL
-		if (!(func & 1))	// NOT TILED
+		#ifdef GFX_CD_SIMD
+		if (XD == 0 && H_Dot >= 8)
 		{
-			//logMsg("not tiled");
-			int mask = (func & 4) ? 0x00800000 : 0x00f80000;
-			if ((ecx | edx) & mask)
+			int DXS = (DYXS << 16) >> 16, DYS = DYXS >> 16;
+			uint32 group;
+			if (gfx_do_group<func>(stamp_base, rot_comp.Stamp_Map_Adr, ecx, edx, DXS, DYS, Buffer_Adr, group))
 			{
-				//logMsg("dxs 0x%X dys 0x%X", ecx, edx);
-				if (func & 0x18) goto Next_Pixel;
-				pixel = 0;
-				goto Pixel_Out;
+				uint32 group_mask = 0xffffffff;
+				if (func & 0x18) // priority modes only draw non-0 dots
+					group_mask = ((group | (group >> 1) | (group >> 2) | (group >> 3)) & 0x11111111) * 0xf;
+				gfx_flush_dots<func>(Buffer_Adr, group, group_mask);
+				ecx += DXS * 8;
+				edx += DYS * 8;
+				Buffer_Adr += Buffer_Step;
+				H_Dot -= 8;
+				continue;
 			}
 		}
+		#endif
+
+		// MAKE_IMAGE_PIXEL
+		if (!(func & 1) &&	// NOT TILED
+			((ecx | edx) & ((func & 4) ? 0x00800000 : 0x00f80000)))
+		{
+			//logMsg("dxs 0x%X dys 0x%X", ecx, edx);
+			pixel = 0;
+			goto Pixel_Out;
+		}
 
 		if (func & 2)		// mode 32x32 dot
 		{
@@ -137,7 +323,6 @@ static void gfx_do(Rot_Comp &rot_comp, unsigned int func, unsigned short *stamp_
 		{
 			if (func & 4)	// 16x16 screen
 			{
-				//logMsg("16x16 screen");
 				ebx = ((ecx >> (11+4)) & 0x00ff) |
 				      ((edx >> (11-4)) & 0xff00);
 			}
@@ -148,6 +333,13 @@ static void gfx_do(Rot_Comp &rot_comp, unsigned int func, unsigned short *stamp_
 			}
 		}
 
+		// stamps and the image buffer share word RAM, so pending dots must
+		// be written before reading from the word they belong to
+		if (dot_mask && ((((rot_comp.Stamp_Map_Adr + (ebx << 1)) ^ Buffer_Adr) & ~3) == 0))
+		{
+			gfx_flush_dots<func>(Buffer_Adr, dots, dot_mask);
+			dots = dot_mask = 0;
+		}
 		edi = stamp_base[ebx];
 		//logMsg("stamp base 0x%X", edi);
 		esi = (edi & 0x7ff) << 7;
@@ -257,46 +449,62 @@ static void gfx_do(Rot_Comp &rot_comp, unsigned int func, unsigned short *stamp_
 				break;
 		}
 
-		pixel = *(sCD.word.ram2M + (edi >> 12) + eax);
+		esi = (edi >> 12) + eax;
+		if (dot_mask && (((esi ^ Buffer_Adr) & ~3) == 0))
+		{
+			gfx_flush_dots<func>(Buffer_Adr, dots, dot_mask);
+			dots = dot_mask = 0;
+		}
+		pixel = *(sCD.word.ram2M + esi);
 		if (!(edi & 0x800)) pixel >>= 4;
 		else pixel &= 0x0f;
 
 Pixel_Out:
-		if (!pixel && (func & 0x18)) goto Next_Pixel;
-		esi = Buffer_Adr + ((XD>>1)^1);				// pixel addr
-		eax = *(sCD.word.ram2M + esi);			// old pixel
-		if (XD & 1)
-		{
-			if ((eax & 0x0f) && (func & 0x18) == 0x08) goto Next_Pixel; // underwrite
-			*(sCD.word.ram2M + esi) = pixel | (eax & 0xf0);
-		}
-		else
+		// with priority modes 0 dots leave the buffer as is
+		if (pixel || !(func & 0x18))
 		{
-			if ((eax & 0xf0) && (func & 0x18) == 0x08) goto Next_Pixel; // underwrite
-			*(sCD.word.ram2M + esi) = (pixel << 4) | (eax & 0xf);
+			unsigned int shift = gfx_dot_shift(XD);
+			dots |= pixel << shift;
+			dot_mask |= 0xf << shift;
 		}
 
-Next_Pixel:
 		ecx += (DYXS << 16) >> 16;	// rot_comp.DXS;
 		edx +=  DYXS >> 16;		// rot_comp.DYS;
 		XD++;
 		if (XD >= 8)
 		{
-			Buffer_Adr += ((rot_comp.imgBuffVCallSize & 0x1f) + 1) << 5;
+			if (dot_mask)
+			{
+				gfx_flush_dots<func>(Buffer_Adr, dots, dot_mask);
+				dots = dot_mask = 0;
+			}
+			Buffer_Adr += Buffer_Step;
 			XD = 0;
 		}
 		H_Dot--;
 	}
 	// end while
 
+	if (dot_mask)
+		gfx_flush_dots<func>(Buffer_Adr, dots, dot_mask);
+
 // nothing_to_draw:
 	rot_comp.YD++;
 	// rot_comp.V_Dot--; // will be done by caller
 }
 
+#define GFX_DO_4(func) gfx_do<func>, gfx_do<func+1>, gfx_do<func+2>, gfx_do<func+3>
+static void (* const gfx_do_func[0x20])(Rot_Comp &rot_comp, unsigned short *stamp_base, unsigned int H_Dot) =
+{
+	GFX_DO_4(0x00), GFX_DO_4(0x04), GFX_DO_4(0x08), GFX_DO_4(0x0c),
+	GFX_DO_4(0x10), GFX_DO_4(0x14), GFX_DO_4(0x18), GFX_DO_4(0x1c),
+};
+#undef GFX_DO_4
+
 
 void gfx_cd_update(Rot_Comp &rot_comp)
 {
+	SCD_PROFILE_SCOPE(SCD_PROF_GFX);
 	int V_Dot = rot_comp.imgBuffVDotSize & 0xff;
 	int jobs;
 
@@ -322,14 +530,14 @@ void gfx_cd_update(Rot_Comp &rot_comp)
 	const bool gfxSupported = 1;
 	if (gfxSupported)
 	{
-		unsigned int func = rot_comp.Function;
+		auto gfx_do_line = gfx_do_func[rot_comp.Function & 0x1f];
 		unsigned int H_Dot = rot_comp.imgBuffHDotSize & 0x1ff;
 		unsigned short *stamp_base = (unsigned short *) (sCD.word.ram2M + rot_comp.Stamp_Map_Adr);
 
 		//logMsg("%d gfx jobs", jobs);
 		while (jobs--)
 		{
-			gfx_do(rot_comp, func, stamp_base, H_Dot);	// jmp [Jmp_Adr]:
+			gfx_do_line(rot_comp, stamp_base, H_Dot);	// jmp [Jmp_Adr]:
 
 			V_Dot--;				// dec byte [V_Dot]
 			if (V_Dot == 0)
@@ -5,6 +5,16 @@
 #include "scd.h"
 #include "pcm.h"
 #include <imagine/logger/logger.h>
+#include <string.h>
+#include <algorithm>
+
+#if defined(__SSE2__)
+#define PCM_SIMD_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define PCM_SIMD_NEON
+#include <arm_neon.h>
+#endif
 
 static unsigned int g_rate = 0; // 18.14 fixed point
 
@@ -65,88 +75,142 @@ void scd_pcm_setRate(int rate)
 }
 
 
-void scd_pcm_update(PCMSampleType *buffer, int length, int stereo)
+// Steps a channel through wave RAM for up to length output samples,
+// storing them as signed values. Returns fewer than length samples only
+// if the channel is stopped by a loop address that holds a loop marker.
+static int pcm_fetch(SegaCD::PCM::Channel &ch, int16 *smp, int length, unsigned int step)
 {
-	SegaCD::PCM::Channel *ch;
-	unsigned int step, addr;
-	int mul_l, mul_r, smp;
-	int i, j, k;
-	PCMSampleType *out;
-
-
-	// PCM disabled or all channels off (to be checked by caller)
-	//if (!(sCD.pcm.control & 0x80) || !sCD.pcm.enabled) return;
-
-	uint activeCH = 0;
+	const uchar *mem = sCD.pcmMem.b;
+	unsigned int addr = ch.addr; // >> PCM_STEP_SHIFT;
+	unsigned int loop_addr = *(uint16a*)&ch.regs[4];
+	int j = 0, k;
 
-	for (i = 0; i < 8; i++)
+	while (j < length)
 	{
-		if (!(sCD.pcm.enabled & (1 << i))) continue; // channel disabled
-		activeCH++;
-		//logMsg("pcm ch %d", i);
+		// find how many samples can be read before reaching a loop marker
+		// (0xff) and read them without checking each one
+		int run = length - j;
+		if (step)
+			run = std::min(run, int((0x7FFFFFF - addr) / step));
+		unsigned int first = addr >> PCM_STEP_SHIFT;
+		unsigned int last = (addr + run * step) >> PCM_STEP_SHIFT;
+		auto marker = (const uchar*)memchr(&mem[first], 0xff, last - first + 1);
+		if (marker)
+		{
+			unsigned int marker_addr = (unsigned int)(marker - mem) << PCM_STEP_SHIFT;
+			run = (step && addr < marker_addr) ? std::min(run, int((marker_addr - 1 - addr) / step)) : 0;
+		}
+		for (int i = 0; i < run; i++)
+		{
+			int s = mem[addr >> PCM_STEP_SHIFT];
+			if (s & 0x80) s = -(s & 0x7f);
+			smp[j++] = s;
+			addr += step;
+		}
+		if (j == length)
+			break;
 
-		out = buffer;
-		ch = &sCD.pcm.ch[i];
+		// next sample may loop, step it like the hardware does
+//		logMsg("addr=%08x", addr);
+		int s = mem[addr >> PCM_STEP_SHIFT];
 
-		addr = ch->addr; // >> PCM_STEP_SHIFT;
-		mul_l = ((int)ch->regs[0] * (ch->regs[1] & 0xf)) >> (5+1); // (env * pan) >> 5
-		mul_r = ((int)ch->regs[0] * (ch->regs[1] >>  4)) >> (5+1);
-		step  = ((unsigned int)(*(uint16a*)&ch->regs[2]) * g_rate) >> 14; // freq step
-//		logMsg("step=%i, cstep=%i, mul_l=%i, mul_r=%i, ch=%i, addr=%x, en=%02x",
-//			*(unsigned short *)&ch->regs[2], step, mul_l, mul_r, i, addr, sCD.pcm.enabled);
+		// test for loop signal
+		if (s == 0xff)
+		{
+			addr = loop_addr;
+			s = mem[addr];
+			addr <<= PCM_STEP_SHIFT;
+			if (s == 0xff) break;
+		}
 
-		if (!stereo && mul_l < mul_r) mul_l = mul_r;
+		if (s & 0x80) s = -(s & 0x7f);
+		smp[j++] = s;
 
-		for (j = 0; j < length; j++)
-		{
-//			logMsg("addr=%08x", addr);
-			smp = sCD.pcmMem.b[addr >> PCM_STEP_SHIFT];
+		// update address register
+		k = (addr >> PCM_STEP_SHIFT) + 1;
+		addr = (addr + step) & 0x7FFFFFF;
 
-			// test for loop signal
-			if (smp == 0xff)
+		for(; k < int(addr >> PCM_STEP_SHIFT); k++)
+		{
+			if (mem[k] == 0xff)
 			{
-				addr = *(uint16a*)&ch->regs[4]; // loop_addr
-				smp = sCD.pcmMem.b[addr];
-				addr <<= PCM_STEP_SHIFT;
-				if (smp == 0xff) break;
+				addr = loop_addr << PCM_STEP_SHIFT;
+				break;
 			}
+		}
+	}
 
-			if (smp & 0x80) smp = -(smp & 0x7f);
+	if (mem[addr >> PCM_STEP_SHIFT] == 0xff)
+		addr = loop_addr << PCM_STEP_SHIFT;
 
-			//if(j == 0)
-				//logMsg("pcm out %d", smp * mul_l);
-			if(activeCH == 1)
-				*out++ = smp * mul_l; // max 128 * 119 = 15232
-			else
-				*out++ += smp * mul_l; // max 128 * 119 = 15232
+	ch.addr = addr;
+	return j;
+}
 
-			if(stereo)
-			{
-				if(activeCH == 1)
-					*out++ = smp * mul_r;
-				else
-					*out++ += smp * mul_r;
-			}
+// Adds a channel's samples scaled by its volume into the output, which
+// wraps at 16 bits like the sums written through PCMSampleType did before
+static void pcm_mix(PCMSampleType *out, const int16 *smp, int length, int mul_l, int mul_r, int stereo)
+{
+	int j = 0;
+	if (!stereo)
+	{
+		for (; j < length; j++)
+			out[j] += smp[j] * mul_l; // max 128 * 119 = 15232
+		return;
+	}
 
-			// update address register
-			k = (addr >> PCM_STEP_SHIFT) + 1;
-			addr = (addr + step) & 0x7FFFFFF;
+#if defined(PCM_SIMD_SSE2)
+	const __m128i vmul_l = _mm_set1_epi16(mul_l), vmul_r = _mm_set1_epi16(mul_r);
+	for (; j + 8 <= length; j += 8)
+	{
+		__m128i s = _mm_loadu_si128((const __m128i*)&smp[j]);
+		__m128i l = _mm_mullo_epi16(s, vmul_l), r = _mm_mullo_epi16(s, vmul_r);
+		__m128i *o = (__m128i*)&out[j * 2];
+		_mm_storeu_si128(o, _mm_add_epi16(_mm_loadu_si128(o), _mm_unpacklo_epi16(l, r)));
+		_mm_storeu_si128(o + 1, _mm_add_epi16(_mm_loadu_si128(o + 1), _mm_unpackhi_epi16(l, r)));
+	}
+#elif defined(PCM_SIMD_NEON)
+	for (; j + 8 <= length; j += 8)
+	{
+		int16x8_t s = vld1q_s16(&smp[j]);
+		int16x8x2_t o = vld2q_s16(&out[j * 2]);
+		o.val[0] = vmlaq_n_s16(o.val[0], s, mul_l);
+		o.val[1] = vmlaq_n_s16(o.val[1], s, mul_r);
+		vst2q_s16(&out[j * 2], o);
+	}
+#endif
+	for (; j < length; j++)
+	{
+		out[j * 2] += smp[j] * mul_l;
+		out[j * 2 + 1] += smp[j] * mul_r;
+	}
+}
 
-			for(; k < int(addr >> PCM_STEP_SHIFT); k++)
-			{
-				if (sCD.pcmMem.b[k] == 0xff)
-				{
-					addr = (unsigned int)(*(uint16a*)&ch->regs[4]) << PCM_STEP_SHIFT; // loop_addr
-					break;
-				}
-			}
-		}
+// Each enabled channel is first stepped through wave RAM for the whole
+// frame, then mixed into the output in one pass
+void scd_pcm_update(PCMSampleType *buffer, int length, int stereo)
+{
+	// PCM disabled or all channels off (to be checked by caller)
+	//if (!(sCD.pcm.control & 0x80) || !sCD.pcm.enabled) return;
+
+	memset(buffer, 0, length * (stereo ? 2 : 1) * sizeof(PCMSampleType));
+	int16 smp[length];
+
+	for (int i = 0; i < 8; i++)
+	{
+		if (!(sCD.pcm.enabled & (1 << i))) continue; // channel disabled
+		//logMsg("pcm ch %d", i);
+
+		auto &ch = sCD.pcm.ch[i];
+		int mul_l = ((int)ch.regs[0] * (ch.regs[1] & 0xf)) >> (5+1); // (env * pan) >> 5
+		int mul_r = ((int)ch.regs[0] * (ch.regs[1] >>  4)) >> (5+1);
+		unsigned int step = ((unsigned int)(*(uint16a*)&ch.regs[2]) * g_rate) >> 14; // freq step
+//		logMsg("step=%i, cstep=%i, mul_l=%i, mul_r=%i, ch=%i, addr=%x, en=%02x",
+//			*(unsigned short *)&ch.regs[2], step, mul_l, mul_r, i, ch.addr, sCD.pcm.enabled);
 
-		if (sCD.pcmMem.b[addr >> PCM_STEP_SHIFT] == 0xff)
-			addr = (unsigned int)(*(uint16a*)&ch->regs[4]) << PCM_STEP_SHIFT; // loop_addr
+		if (!stereo && mul_l < mul_r) mul_l = mul_r;
 
-		ch->addr = addr;
+		int samples = pcm_fetch(ch, smp, length, step);
+		pcm_mix(buffer, smp, samples, mul_l, mul_r, stereo);
 	}
-	//logMsg("%d active channels", activeCH);
 }
-
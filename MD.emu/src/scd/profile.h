@@ -0,0 +1,46 @@
+#pragma once
+
+// Breakdown of where emulation time goes in a frame, built in with
+// -DSCD_PROFILE. Each block is timed exclusively, so time spent in a block
+// entered from another (like the ASIC started by a sub-CPU register write)
+// only counts towards the inner one. Averages are logged every 60 frames.
+
+enum SCDProfileBlock
+{
+	SCD_PROF_NONE,
+	SCD_PROF_FRAME, // rest of system_frame(), Z80, VDP control, input
+	SCD_PROF_MAIN_CPU,
+	SCD_PROF_SUB_CPU,
+	SCD_PROF_VDP, // line rendering
+	SCD_PROF_GFX, // ASIC rotation/scaling
+	SCD_PROF_CDC, // CD controller & drive updates, DMA
+	SCD_PROF_SOUND, // FM/PSG mixing
+	SCD_PROF_PCM,
+	SCD_PROF_CDDA,
+	SCD_PROF_BLOCKS
+};
+
+#if defined(SCD_PROFILE) && !defined(NO_SCD)
+
+SCDProfileBlock scd_profileEnter(SCDProfileBlock block);
+void scd_profileLeave(SCDProfileBlock parent);
+void scd_profileFrame();
+
+class SCDProfileScope
+{
+public:
+	SCDProfileScope(SCDProfileBlock block): parent{scd_profileEnter(block)} {}
+	~SCDProfileScope() { scd_profileLeave(parent); }
+
+private:
+	SCDProfileBlock parent;
+};
+
+#define SCD_PROFILE_SCOPE(block) SCDProfileScope scdProfileScope{block}
+
+#else
+
+#define SCD_PROFILE_SCOPE(block)
+static inline void scd_profileFrame() {}
+
+#endif
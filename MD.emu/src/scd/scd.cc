@@ -4,10 +4,14 @@
 #include "LC89510.h"
 #include "misc.h"
 #include "mem.hh"
+#include "profile.h"
 
 #include <imagine/logger/logger.h>
 #include <imagine/util/algorithm.h>
 #include <imagine/io/FileIO.hh>
+#ifdef SCD_PROFILE
+#include <chrono>
+#endif
 
 SegaCD sCD;
 
@@ -70,6 +74,7 @@ void scd_runSubCpu(uint cycles)
 	if((sCD.busreq&3) == 1)
 	{
 		//logMsg("running sub-cpu from cycle %d to %d", sCD.cpu.cycleCount, cycles);
+		SCD_PROFILE_SCOPE(SCD_PROF_SUB_CPU);
 		m68k_run(sCD.cpu, cycles);
 	}
 	else
@@ -269,6 +274,7 @@ void scd_checkDma(void)
 	{
 		return;
 	}
+	SCD_PROFILE_SCOPE(SCD_PROF_CDC);
 
 	//logMsg("CDC data transfer in progress");
 
@@ -298,6 +304,57 @@ void scd_shutdown(void)
 	sCD.isActive = 0;
 }
 
+#ifdef SCD_PROFILE
+static const char *profileBlockName[SCD_PROF_BLOCKS]
+{
+	"", "frame", "main 68K", "sub 68K", "VDP render", "ASIC", "CDC", "sound", "PCM", "CDDA"
+};
+static std::chrono::steady_clock::duration profileTime[SCD_PROF_BLOCKS]{};
+static std::chrono::steady_clock::time_point profileMark;
+static SCDProfileBlock profileBlock = SCD_PROF_NONE;
+static uint profileFrames = 0;
+
+static void profileCharge()
+{
+	auto now = std::chrono::steady_clock::now();
+	profileTime[profileBlock] += now - profileMark;
+	profileMark = now;
+}
+
+SCDProfileBlock scd_profileEnter(SCDProfileBlock block)
+{
+	profileCharge();
+	auto parent = profileBlock;
+	profileBlock = block;
+	return parent;
+}
+
+void scd_profileLeave(SCDProfileBlock parent)
+{
+	profileCharge();
+	profileBlock = parent;
+}
+
+void scd_profileFrame()
+{
+	if(++profileFrames <= 60)
+		return;
+	// time outside any block (the frontend) isn't part of the breakdown
+	profileTime[SCD_PROF_NONE] = {};
+	double total = 0;
+	for(auto t : profileTime)
+		total += std::chrono::duration<double>(t).count();
+	logMsg("average of %u frames: %.3fms", profileFrames - 1, total * 1000. / (profileFrames - 1));
+	for(uint i = SCD_PROF_FRAME; i < SCD_PROF_BLOCKS; i++)
+	{
+		double t = std::chrono::duration<double>(profileTime[i]).count();
+		logMsg("%s: %.3fms (%.1f%%)", profileBlockName[i], t * 1000. / (profileFrames - 1), total ? t * 100. / total : 0.);
+		profileTime[i] = {};
+	}
+	profileFrames = 1;
+}
+#endif
+
 void scd_update()
 {
 	//logMsg("scd scanline update");
@@ -308,6 +365,7 @@ void scd_update()
 	{
 		//logMsg("CDC 75hz update");
 		sCD.counter75hz -= counter75hz_lim;
+		SCD_PROFILE_SCOPE(SCD_PROF_CDC);
 		Check_CD_Command();
 	}
 
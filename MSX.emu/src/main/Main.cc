@@ -16,6 +16,7 @@
 #define LOGTAG "main"
 #include <imagine/fs/ArchiveFS.hh>
 #include <imagine/gui/AlertView.hh>
+#include <imagine/util/ScopeGuard.hh>
 #include <emuframework/EmuApp.hh>
 #include <emuframework/EmuInput.hh>
 #include "../../../EmuFramework/include/emuframework/EmuAppInlines.hh"
@@ -207,6 +208,7 @@ const AspectRatioInfo EmuSystem::aspectRatioInfo[] =
 };
 const uint EmuSystem::aspectRatioInfos = IG::size(EmuSystem::aspectRatioInfo);
 bool EmuSystem::handlesGenericIO = false; // TODO: need to re-factor BlueMSX file loading code
+bool EmuSystem::hasRunAhead = false; // state loads re-insert media and reset the machine name
 
 const char *EmuSystem::shortSystemName()
 {
@@ -712,14 +714,17 @@ FS::PathString EmuSystem::sprintStateFilename(int slot, const char *statePath, c
 }
 
 static const char saveStateVersion[] = "blueMSX - state  v 8";
+// name passed to the blueMSX state functions when the zip is kept in memory
+static const char memStateZipName[] = "memstate.zip";
 extern int pendingInt;
 
-static std::error_code saveBlueMSXState(const char *filename)
+std::error_code EmuSystem::saveStateToBuffer(std::vector<uint8_t> &buff)
 {
-	CallResult res = zipStartWrite(filename);
+	const char *filename = memStateZipName;
+	CallResult res = zipStartWrite(buff);
 	if(res != OK)
 	{
-		logErr("error creating zip:%s", filename);
+		logErr("error creating zip in memory");
 		return {EIO, std::system_category()};
 	}
 	saveStateCreateForWrite(filename);
@@ -762,12 +767,6 @@ static std::error_code saveBlueMSXState(const char *filename)
 	return {};
 }
 
-std::error_code EmuSystem::saveState()
-{
-	auto saveStr = sprintStateFilename(saveStateSlot);
-	return saveBlueMSXState(saveStr.data());
-}
-
 static void closeGameByFailedStateLoad()
 {
 	EmuSystem::closeGame(0);
@@ -791,9 +790,11 @@ static void saveStateGetFileString(SaveState* state, const char* tagName, T &des
 	}
 }
 
-static std::system_error loadBlueMSXState(const char *filename)
+std::system_error EmuSystem::loadStateFromBuffer(const uint8_t *data, size_t size)
 {
-	logMsg("loading state %s", filename);
+	const char *filename = memStateZipName;
+	zipSetMemoryZip(filename, data, size);
+	auto clearMemoryZip = IG::scopeGuard([](){ zipSetMemoryZip(nullptr, nullptr, 0); });
 
 	assert(machine);
 	ejectMedia();
@@ -855,16 +856,6 @@ static std::system_error loadBlueMSXState(const char *filename)
 	return {{}};
 }
 
-std::system_error EmuSystem::loadState(int saveStateSlot)
-{
-	auto saveStr = sprintStateFilename(saveStateSlot);
-	if(FS::exists(saveStr.data()))
-	{
-		return loadBlueMSXState(saveStr.data());
-	}
-	return {{ENOENT, std::system_category()}};
-}
-
 void EmuSystem::saveBackupMem()
 {
 	if(gameIsRunning())
@@ -873,15 +864,6 @@ void EmuSystem::saveBackupMem()
 	}
 }
 
-void EmuSystem::saveAutoState()
-{
-	if(gameIsRunning() && optionAutoSaveState)
-	{
-		auto saveStr = sprintStateFilename(-1);
-		saveBlueMSXState(saveStr.data());
-	}
-}
-
 bool EmuSystem::vidSysIsPAL() { return 0; }
 uint EmuSystem::multiresVideoBaseX() { return 0; }
 uint EmuSystem::multiresVideoBaseY() { return 0; }
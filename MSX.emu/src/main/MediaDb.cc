@@ -38,6 +38,8 @@ extern "C" {
 }
 
 #include <string.h>
+#include <algorithm>
+#include <iterator>
 #include <imagine/util/builtins.h>
 #include <imagine/util/algorithm.h>
 #include <imagine/logger/logger.h>
@@ -53,11 +55,18 @@ struct RomDBInfo
 	uint romType;
 };
 
+// Compiled from the blueMSX XML databases by tools/genRomDB.py and sorted
+// by digest, so lookups are a binary search over read-only data
 static const RomDBInfo romDB[] =
 {
 #include "EmbeddedRomDBData.h"
 };
 
+static bool digestLess(const RomDBInfo &e, const uint *digest)
+{
+	return std::lexicographical_compare(e.digest, e.digest + 5, digest, digest + 5);
+}
+
 struct MediaType {
     constexpr MediaType(RomType rt) : romType(rt) {}
 
@@ -556,21 +565,12 @@ extern "C" MediaType* mediaDbLookupRom(const void *buffer, int size)
 		sha1.get_digest(digest);
 		logMsg("rom sha1 0x%X 0x%X 0x%X 0x%X 0x%X", digest[0], digest[1], digest[2], digest[3], digest[4]);
 
-		for(auto e : romDB)
+		auto e = std::lower_bound(std::begin(romDB), std::end(romDB), digest, digestLess);
+		if(e != std::end(romDB) && std::equal(digest, digest + 5, e->digest))
 		{
-			int match = 0;
-			iterateTimes(5, i)
-			{
-					if(digest[i] != e.digest[i])
-						break;
-					else match++;
-			}
-			if(match == 5)
-			{
-				logMsg("found match with type %s", romTypeToString(e.romType));
-				staticMediaType = e.romType;
-				return &staticMediaType;
-			}
+			logMsg("found match with type %s", romTypeToString(e->romType));
+			staticMediaType = e->romType;
+			return &staticMediaType;
 		}
 
 		logMsg("rom not in DB");
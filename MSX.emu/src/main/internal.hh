@@ -1,6 +1,7 @@
 #pragma once
 
 #include <emuframework/Option.hh>
+#include <vector>
 
 extern "C"
 {
@@ -41,5 +42,7 @@ bool hasMSXROMExtension(const char *name);
 bool insertROM(const char *name, uint slot = 0);
 bool insertDisk(const char *name, uint slot = 0);
 CallResult zipStartWrite(const char *fileName);
+CallResult zipStartWrite(std::vector<uint8_t> &buff);
+void zipSetMemoryZip(const char *zipName, const void *data, size_t size);
 CallResult zipEndWrite();
 const char *machineBasePathStr();
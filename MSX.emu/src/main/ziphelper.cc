@@ -17,23 +17,46 @@
 #include <archive.h>
 #include <archive_entry.h>
 #include <imagine/fs/ArchiveFS.hh>
+#include <imagine/io/BufferMapIO.hh>
 #include <imagine/logger/logger.h>
 #include <imagine/util/string.h>
 #include <imagine/util/ScopeGuard.hh>
 #include "ziphelper.h"
+#include <vector>
 
 static struct archive *writeArch{};
+static const char *memZipName{};
+static const void *memZipData{};
+static size_t memZipSize{};
 
 void zipCacheReadOnlyZip(const char* zipName)
 {
 	// TODO
 }
 
+void zipSetMemoryZip(const char *zipName, const void *data, size_t size)
+{
+	memZipName = zipName;
+	memZipData = data;
+	memZipSize = size;
+}
+
+static FS::ArchiveIterator makeArchiveIterator(const char *zipName, std::error_code &ec)
+{
+	if(memZipName && string_equal(zipName, memZipName))
+	{
+		BufferMapIO io{};
+		io.open(memZipData, memZipSize);
+		return {io, ec};
+	}
+	return {zipName, ec};
+}
+
 void* zipLoadFile(const char* zipName, const char* fileName, int* size)
 {
 	ArchiveIO io{};
 	std::error_code ec{};
-	for(auto &entry : FS::ArchiveIterator{zipName, ec})
+	for(auto &entry : makeArchiveIterator(zipName, ec))
 	{
 		if(entry.type() == FS::file_type::directory)
 		{
@@ -63,6 +86,30 @@ void* zipLoadFile(const char* zipName, const char* fileName, int* size)
 	}
 }
 
+static la_ssize_t writeToVector(struct archive *, void *userData, const void *buff, size_t size)
+{
+	auto &vec = *((std::vector<uint8_t>*)userData);
+	auto bytes = (const uint8_t*)buff;
+	vec.insert(vec.end(), bytes, bytes + size);
+	return size;
+}
+
+CallResult zipStartWrite(std::vector<uint8_t> &buff)
+{
+	assert(!writeArch);
+	buff.clear();
+	writeArch = archive_write_new();
+	archive_write_set_format_zip(writeArch);
+	archive_write_set_bytes_in_last_block(writeArch, 1);
+	if(archive_write_open(writeArch, &buff, nullptr, writeToVector, nullptr) != ARCHIVE_OK)
+	{
+		archive_write_free(writeArch);
+		writeArch = {};
+		return IO_ERROR;
+	}
+	return OK;
+}
+
 CallResult zipStartWrite(const char *fileName)
 {
 	assert(!writeArch);
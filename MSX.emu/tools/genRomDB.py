@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+
+# Compiles blueMSX ROM databases (msxromdb.xml, msxsysromdb.xml) into the
+# table included by src/main/MediaDb.cc. Entries are sorted by SHA1 digest so
+# mediaDbLookupRom() can binary search them, duplicates are merged.
+# An existing EmbeddedRomDBData.h can also be given as input to re-sort it
+# or to add new XML entries to it:
+#   tools/genRomDB.py src/main/EmbeddedRomDBData.h msxromdb.xml > out.h
+
+import re
+import sys
+import xml.etree.ElementTree as ET
+from os import path
+
+mediaDbHeader = path.join(path.dirname(path.abspath(__file__)), '../src/blueMSX/Media/MediaDb.h')
+
+# blueMSX type names that don't match a RomType enum name
+typeAliases = {
+	'NORMAL': 'STANDARD',
+	'MIRRORED': 'PLAIN',
+	'KONAMI': 'KONAMI4',
+	'KONAMISCC': 'KONAMI5',
+	'ASCII8SRAM2': 'ASCII8SRAM',
+	'ASCII8SRAM8': 'ASCII8SRAM',
+	'ASCII16SRAM2': 'ASCII16SRAM',
+	'ASCII16SRAM8': 'ASCII16SRAM',
+	'KOEISRAM8': 'KOEI',
+	'KOEISRAM32': 'KOEI',
+	'KOREAN80IN1': 'KOREAN80',
+	'KOREAN90IN1': 'KOREAN90',
+	'KOREAN126IN1': 'KOREAN126',
+}
+
+def normalizeName(name):
+	return re.sub(r'[^0-9A-Z]', '', name.upper())
+
+def readRomTypes():
+	with open(mediaDbHeader) as f:
+		types = {normalizeName(name): int(val) for name, val in re.findall(r'\bROM_(\w+)\s*=\s*(\d+)', f.read())}
+	types.pop('MAXROMID', None)
+	return types
+
+def typeFromString(types, name):
+	key = normalizeName(name)
+	return types.get(typeAliases.get(key, key))
+
+def parseDigest(hexStr):
+	hexStr = hexStr.strip().lower()
+	if not re.fullmatch(r'[0-9a-f]{40}', hexStr):
+		return None
+	return tuple(int(hexStr[i:i+8], 16) for i in range(0, 40, 8))
+
+def addEntry(db, digest, romType, source):
+	prevType = db.setdefault(digest, romType)
+	if prevType != romType:
+		print('%s: conflicting types %d & %d for sha1 %s, keeping first' %
+			(source, prevType, romType, ''.join('%08x' % d for d in digest)), file=sys.stderr)
+
+def readHeader(db, filename):
+	with open(filename) as f:
+		for digest, romType in re.findall(r'\{\s*\{([^}]*)\}\s*,\s*(\d+)\s*\}', f.read()):
+			addEntry(db, tuple(int(d, 16) for d in digest.split(',')), int(romType), filename)
+
+def readXml(db, types, filename):
+	skipped = 0
+	for dump in ET.parse(filename).getroot().iter('dump'):
+		for rom in dump:
+			if rom.tag not in ('rom', 'megarom', 'systemrom', 'sccpluscart'):
+				continue
+			typeName = rom.findtext('type')
+			if typeName:
+				romType = typeFromString(types, typeName)
+			else:
+				# plain ROMs may leave out the type, let the guesser handle anything else
+				romType = types['PLAIN'] if rom.tag == 'rom' else None
+			if not romType:
+				skipped += 1
+				print('%s: unknown rom type %s' % (filename, typeName), file=sys.stderr)
+				continue
+			for hashElem in rom.iter('hash'):
+				if hashElem.get('algo', 'sha1') != 'sha1':
+					continue
+				digest = parseDigest(hashElem.text or '')
+				if digest:
+					addEntry(db, digest, romType, filename)
+	if skipped:
+		print('%s: skipped %d entries' % (filename, skipped), file=sys.stderr)
+
+def main(args):
+	if not args:
+		print('usage: %s [EmbeddedRomDBData.h | romdb.xml]... > EmbeddedRomDBData.h' % sys.argv[0], file=sys.stderr)
+		return 1
+	types = readRomTypes()
+	db = {}
+	for filename in args:
+		if filename.endswith('.h'):
+			readHeader(db, filename)
+		else:
+			readXml(db, types, filename)
+	out = sys.stdout
+	out.write('// Generated by tools/genRomDB.py, must stay sorted by digest\n')
+	for digest in sorted(db):
+		out.write('\t{ {%s }, %d },\n' % (', '.join('0x%08x' % d for d in digest), db[digest]))
+	print('%d entries' % len(db), file=sys.stderr)
+	return 0
+
+if __name__ == '__main__':
+	sys.exit(main(sys.argv[1:]))
@@ -30,6 +30,7 @@ $(GEO)/mame_layer.c \
 $(GEO)/memory.c \
 $(GEO)/neoboot.c \
 $(GEO)/neocrypt.c \
+$(GEO)/parallel.c \
 $(GEO)/pd4990a.c \
 $(GEO)/roms.c \
 $(GEO)/state.c \
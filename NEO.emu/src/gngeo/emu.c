@@ -325,6 +325,9 @@ void main_frame(void) {
 	Uint32 cpu_z80_timeslice_interlace = cpu_z80_timeslice
 			/ (float) nb_interlace;
 
+	if (memory.vid.spr_cache.data && !skip_this_frame)
+		sprite_cache_frame();
+
 	// run one frame
 	{
 		#ifndef ENABLE_940T
@@ -51,6 +51,7 @@
 #include "resfile.h"
 #include "mame_layer.h"
 #include "menu.h"
+#include "parallel.h"
 
 /***************************************************************************
 
@@ -533,35 +534,40 @@ static void decrypt(UINT8 *r0, UINT8 *r1,
 #include <stdio.h>
 
 
-static void neogeo_gfx_decrypt(running_machine *machine, int extra_xor)
+struct gfx_decrypt_job
 {
-	UINT8 *buf;
 	UINT8 *rom;
-	uint rpos;
-	const uint rom_size = memory_region_length(machine, "sprites");
+	UINT8 *buf;
+	uint rom_size;
+	int extra_xor;
+};
 
-	buf = alloc_array_or_die(UINT8, rom_size);
+static void gfx_decrypt_data(void *arg, Uint32 start, Uint32 end)
+{
+	struct gfx_decrypt_job *job = arg;
+	UINT8 *rom = job->rom;
+	UINT8 *buf = job->buf;
+	uint rpos;
 
-	rom = memory_region(machine, "sprites");
-	const uint pbarUpdateCount = 20;
-	const uint pbarSteps = (rom_size/4)/pbarUpdateCount;
-	gn_init_pbar(PBAR_ACTION_DECRYPT, rom_size/2);
-	// Data xor
-	for (rpos = 0;rpos < rom_size/4;rpos++)
+	for (rpos = start;rpos < end;rpos++)
 	{
 		decrypt(buf+4*rpos+0, buf+4*rpos+3, rom[4*rpos+0], rom[4*rpos+3], type0_t03, type0_t12, type1_t03, rpos, (rpos>>8) & 1);
 		decrypt(buf+4*rpos+1, buf+4*rpos+2, rom[4*rpos+1], rom[4*rpos+2], type0_t12, type0_t03, type1_t12, rpos, ((rpos>>16) ^ address_16_23_xor2[(rpos>>8) & 0xff]) & 1);
-		if (rpos % pbarSteps == 0) {
-			gn_update_pbar(rpos);
-		}
 	}
-	// Address xor
-	for (rpos = 0;rpos < rom_size/4;rpos++)
+}
+
+static void gfx_decrypt_address(void *arg, Uint32 start, Uint32 end)
+{
+	struct gfx_decrypt_job *job = arg;
+	UINT8 *rom = job->rom;
+	UINT8 *buf = job->buf;
+	const uint rom_size = job->rom_size;
+	const int extra_xor = job->extra_xor;
+	uint rpos;
+
+	for (rpos = start;rpos < end;rpos++)
 	{
 		int baser;
-		if (rpos % pbarSteps == 0) {
-			gn_update_pbar(rpos + (rom_size >> 2));
-		}
 		baser = rpos;
 
 		baser ^= extra_xor;
@@ -590,13 +596,42 @@ static void neogeo_gfx_decrypt(running_machine *machine, int extra_xor)
 		else /* Clamp to the real rom size */
 			baser &= (rom_size/4)-1;
 
-		rom[4*rpos+0] = buf[4*baser+0];
-		rom[4*rpos+1] = buf[4*baser+1];
-		rom[4*rpos+2] = buf[4*baser+2];
-		rom[4*rpos+3] = buf[4*baser+3];
+		memcpy(&rom[4*rpos], &buf[4*baser], 4);
+	}
+}
+
+/* Both passes work on independent words, so they're split over all CPUs,
+ * a progress bar step at a time */
+static void neogeo_gfx_decrypt(running_machine *machine, int extra_xor)
+{
+	struct gfx_decrypt_job job;
+	uint rpos;
+	const uint rom_size = memory_region_length(machine, "sprites");
+	const uint words = rom_size/4;
+	Uint32 start_time = gn_time_ms();
+
+	job.buf = alloc_array_or_die(UINT8, rom_size);
+	job.rom = memory_region(machine, "sprites");
+	job.rom_size = rom_size;
+	job.extra_xor = extra_xor;
+	const uint pbarUpdateCount = 20;
+	const uint pbarSteps = words/pbarUpdateCount;
+	gn_init_pbar(PBAR_ACTION_DECRYPT, rom_size/2);
+	// Data xor
+	for (rpos = 0;rpos < words;rpos += pbarSteps)
+	{
+		gn_update_pbar(rpos);
+		gn_parallel_for(rpos, rpos + pbarSteps < words ? rpos + pbarSteps : words, 0x100, gfx_decrypt_data, &job);
+	}
+	// Address xor, reads from anywhere in buf so it must wait for the whole data pass
+	for (rpos = 0;rpos < words;rpos += pbarSteps)
+	{
+		gn_update_pbar(rpos + words);
+		gn_parallel_for(rpos, rpos + pbarSteps < words ? rpos + pbarSteps : words, 0x100, gfx_decrypt_address, &job);
 	}
 	gn_terminate_pbar();
-	free(buf);
+	free(job.buf);
+	logMsg("C ROM decrypt took %u ms\n", gn_time_ms() - start_time);
 }
 
 
@@ -736,37 +771,59 @@ void cmc50_neogeo_gfx_decrypt(running_machine *machine, int extra_xor)
 
 
 /* ms5pcb and svcpcb have an additional scramble on top of the standard CMC scrambling */
-void svcpcb_gfx_decrypt(running_machine *machine)
+static const UINT8 pcb_gfx_xorval[ 4 ] = { 0x34, 0x21, 0xc4, 0xe9 };
+
+static void svcpcb_gfx_swap(void *arg, Uint32 start, Uint32 end)
 {
-	static const UINT8 xorval[ 4 ] = { 0x34, 0x21, 0xc4, 0xe9 };
+	UINT8 *rom = arg;
 	int i;
-	int ofst;
-	int rom_size = memory_region_length( machine, "sprites" );
-	UINT8 *rom = memory_region( machine, "sprites" );
-	UINT8 *buf = alloc_array_or_die(UINT8,  rom_size );
 
-	for( i = 0; i < rom_size; i++ )
+	for( i = start * 4; i < end * 4; i += 4 )
 	{
-		rom[ i ] ^= xorval[ (i % 4) ];
-	}
-	for( i = 0; i < rom_size; i += 4 )
-	{
-		UINT32 rom32 = rom[i] | rom[i+1]<<8 | rom[i+2]<<16 | rom[i+3]<<24;
+		UINT32 rom32 = (rom[i] ^ pcb_gfx_xorval[0]) | (rom[i+1] ^ pcb_gfx_xorval[1])<<8 | (rom[i+2] ^ pcb_gfx_xorval[2])<<16 | (rom[i+3] ^ pcb_gfx_xorval[3])<<24;
 		rom32 = BITSWAP32( rom32, 0x09, 0x0d, 0x13, 0x00, 0x17, 0x0f, 0x03, 0x05, 0x04, 0x0c, 0x11, 0x1e, 0x12, 0x15, 0x0b, 0x06, 0x1b, 0x0a, 0x1a, 0x1c, 0x14, 0x02, 0x0e, 0x1d, 0x18, 0x08, 0x01, 0x10, 0x19, 0x1f, 0x07, 0x16 );
 		rom[i] = rom32&0xff;
 		rom[i+1] = (rom32>>8)&0xff;
 		rom[i+2] = (rom32>>16)&0xff;
 		rom[i+3] = (rom32>>24)&0xff;
 	}
-	memcpy( buf, rom, rom_size );
-	for( i = 0; i < rom_size / 4; i++ )
+}
+
+struct pcb_gfx_job
+{
+	UINT8 *rom;
+	UINT8 *buf;
+};
+
+static void svcpcb_gfx_scramble(void *arg, Uint32 start, Uint32 end)
+{
+	struct pcb_gfx_job *job = arg;
+	UINT8 *rom = job->rom;
+	UINT8 *buf = job->buf;
+	int i;
+	int ofst;
+
+	/* same loop as the serial version, over this chunk's words */
+	for( i = start; i < (int)end; i++ )
 	{
 		ofst =  BITSWAP24( (i & 0x1fffff), 0x17, 0x16, 0x15, 0x04, 0x0b, 0x0e, 0x08, 0x0c, 0x10, 0x00, 0x0a, 0x13, 0x03, 0x06, 0x02, 0x07, 0x0d, 0x01, 0x11, 0x09, 0x14, 0x0f, 0x12, 0x05 );
 		ofst ^= 0x0c8923;
 		ofst += (i & 0xffe00000);
 		memcpy( &rom[ i * 4 ], &buf[ ofst * 4 ], 0x04 );
 	}
-	free( buf );
+}
+
+void svcpcb_gfx_decrypt(running_machine *machine)
+{
+	int rom_size = memory_region_length( machine, "sprites" );
+	struct pcb_gfx_job job;
+
+	job.rom = memory_region( machine, "sprites" );
+	job.buf = alloc_array_or_die(UINT8,  rom_size );
+	gn_parallel_for( 0, rom_size / 4, 0x100, svcpcb_gfx_swap, job.rom );
+	memcpy( job.buf, job.rom, rom_size );
+	gn_parallel_for( 0, rom_size / 4, 0x100, svcpcb_gfx_scramble, &job );
+	free( job.buf );
 }
 
 
@@ -784,35 +841,54 @@ void svcpcb_s1data_decrypt(running_machine *machine)
 }
 
 
-/* kf2k3pcb has an additional scramble on top of the standard CMC scrambling */
-/* Thanks to Razoola & Halrin for the info */
-void kf2k3pcb_gfx_decrypt(running_machine *machine)
+static void kf2k3pcb_gfx_swap(void *arg, Uint32 start, Uint32 end)
 {
-	static const UINT8 xorval[ 4 ] = { 0x34, 0x21, 0xc4, 0xe9 };
+	UINT8 *rom = arg;
+	UINT32 xor32;
 	int i;
-	int ofst;
-	int rom_size = memory_region_length( machine, "sprites" );
-	UINT8 *rom = memory_region( machine, "sprites" );
-	UINT8 *buf = alloc_array_or_die(UINT8,  rom_size );
 
-	for ( i = 0; i < rom_size; i++ )
-	{
-		rom[ i ] ^= xorval[ (i % 4) ];
-	}
-	for ( i = 0; i < rom_size; i+=4 )
+	memcpy( &xor32, pcb_gfx_xorval, 4 );
+	for ( i = start * 4; i < end * 4; i+=4 )
 	{
-		UINT32 *rom32 = (UINT32*)&rom[ i ];
-		*rom32 = BITSWAP32( *rom32, 0x09, 0x0d, 0x13, 0x00, 0x17, 0x0f, 0x03, 0x05, 0x04, 0x0c, 0x11, 0x1e, 0x12, 0x15, 0x0b, 0x06, 0x1b, 0x0a, 0x1a, 0x1c, 0x14, 0x02, 0x0e, 0x1d, 0x18, 0x08, 0x01, 0x10, 0x19, 0x1f, 0x07, 0x16 );
+		UINT32 rom32;
+		memcpy( &rom32, &rom[ i ], 4 );
+		rom32 ^= xor32;
+		rom32 = BITSWAP32( rom32, 0x09, 0x0d, 0x13, 0x00, 0x17, 0x0f, 0x03, 0x05, 0x04, 0x0c, 0x11, 0x1e, 0x12, 0x15, 0x0b, 0x06, 0x1b, 0x0a, 0x1a, 0x1c, 0x14, 0x02, 0x0e, 0x1d, 0x18, 0x08, 0x01, 0x10, 0x19, 0x1f, 0x07, 0x16 );
+		memcpy( &rom[ i ], &rom32, 4 );
 	}
-	memcpy( buf, rom, rom_size );
-	for ( i = 0; i < rom_size; i+=4 )
+}
+
+/* ofst is a permutation of i, so no two words are written twice */
+static void kf2k3pcb_gfx_scramble(void *arg, Uint32 start, Uint32 end)
+{
+	struct pcb_gfx_job *job = arg;
+	UINT8 *rom = job->rom;
+	UINT8 *buf = job->buf;
+	int i;
+	int ofst;
+
+	for ( i = start * 4; i < end * 4; i+=4 )
 	{
 		ofst = BITSWAP24( (i & 0x7fffff), 0x17, 0x15, 0x0a, 0x14, 0x13, 0x16, 0x12, 0x11, 0x10, 0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00 );
 		ofst ^= 0x000000;
 		ofst += (i & 0xff800000);
 		memcpy( &rom[ ofst ], &buf[ i ], 0x04 );
 	}
-	free( buf );
+}
+
+/* kf2k3pcb has an additional scramble on top of the standard CMC scrambling */
+/* Thanks to Razoola & Halrin for the info */
+void kf2k3pcb_gfx_decrypt(running_machine *machine)
+{
+	int rom_size = memory_region_length( machine, "sprites" );
+	struct pcb_gfx_job job;
+
+	job.rom = memory_region( machine, "sprites" );
+	job.buf = alloc_array_or_die(UINT8,  rom_size );
+	gn_parallel_for( 0, rom_size / 4, 0x100, kf2k3pcb_gfx_swap, job.rom );
+	memcpy( job.buf, job.rom, rom_size );
+	gn_parallel_for( 0, rom_size / 4, 0x100, kf2k3pcb_gfx_scramble, &job );
+	free( job.buf );
 }
 
 
@@ -1021,6 +1097,109 @@ NeoGeo 'P' ROM encryption
 ***************************************************************************/
 
 
+/* The data line and address line swaps of the later P ROMs work on
+ * independent words or blocks, so they're split over all CPUs like the
+ * C ROM passes. The bit swaps go through tables built once per ROM. */
+
+/* Swaps the data lines of each word with a BITSWAP16 table */
+struct p_rom_data_job
+{
+	UINT16 *rom;
+	UINT16 *table;
+};
+
+static void p_rom_swap_data(void *arg, Uint32 start, Uint32 end)
+{
+	struct p_rom_data_job *job = arg;
+	UINT16 *rom = job->rom;
+	const UINT16 *table = job->table;
+	Uint32 i;
+
+	for (i = start;i < end;i++)
+	{
+		rom[i] = table[rom[i]];
+	}
+}
+
+/* Swaps the address lines inside each bank of bank_words words, word j of
+ * a bank comes from word perm[j] */
+struct p_rom_bank_job
+{
+	UINT16 *rom;
+	UINT32 *perm;
+	Uint32 bank_words;
+};
+
+static void p_rom_swap_banks(void *arg, Uint32 start, Uint32 end)
+{
+	struct p_rom_bank_job *job = arg;
+	const Uint32 bank_words = job->bank_words;
+	UINT16 buffer[0x10000/2];
+	Uint32 i, j;
+
+	for (i = start;i < end;i++)
+	{
+		UINT16 *bank = job->rom + i * bank_words;
+		memcpy(buffer,bank,bank_words*2);
+		for (j = 0;j < bank_words;j++)
+		{
+			bank[j] = buffer[job->perm[j]];
+		}
+	}
+}
+
+/* The xor and data line swap of the svc/kof2003/mslug5 family. Both only
+ * touch bytes of their own 4 byte group, so they're done together. */
+struct p_rom_xor_job
+{
+	UINT8 *rom;
+	const UINT8 *xor_bytes;
+	UINT16 *table;
+};
+
+static void p_rom_xor_swap(void *arg, Uint32 start, Uint32 end)
+{
+	struct p_rom_xor_job *job = arg;
+	UINT8 *rom = job->rom;
+	int i, k;
+
+	for( i = start * 4; i < end * 4; i += 4 )
+	{
+		UINT16 rom16;
+		for( k = 0; k < 4; k++ )
+		{
+			rom[ i + k ] ^= job->xor_bytes[ (BYTE_XOR_LE(i + k) % 0x20) ];
+		}
+		rom16 = rom[BYTE_XOR_LE(i+1)] | rom[BYTE_XOR_LE(i+2)]<<8;
+		rom16 = job->table[ rom16 ];
+		rom[BYTE_XOR_LE(i+1)] = rom16&0xff;
+		rom[BYTE_XOR_LE(i+2)] = rom16>>8;
+	}
+}
+
+/* Moves the 0x100 byte blocks of the same family, bank is the BITSWAP8 of
+ * address bits 12-19 and bits 8-11 are xored with xor_8_11 */
+struct p_rom_block_job
+{
+	UINT8 *dst;
+	UINT8 *src;
+	int xor_8_11;
+	UINT8 bank[0x100];
+};
+
+static void p_rom_move_blocks(void *arg, Uint32 start, Uint32 end)
+{
+	struct p_rom_block_job *job = arg;
+	int i;
+	int ofst;
+
+	for( i = start * 0x100; i < end * 0x100; i += 0x100 )
+	{
+		ofst = (i & 0xf000ff) + ((i & 0x000f00) ^ job->xor_8_11) + (job->bank[ (i & 0x0ff000) >> 12 ] << 12);
+		memcpy( &job->dst[ i ], &job->src[ ofst ], 0x100 );
+	}
+}
+
 /* Kof98 uses an early encryption, quite different from the others */
 void kof98_decrypt_68k(running_machine *machine)
 {
@@ -1073,24 +1252,30 @@ void kof99_decrypt_68k(running_machine *machine)
 {
 	UINT16 *rom;
 	int i,j;
+	struct p_rom_data_job data;
+	struct p_rom_bank_job banks;
 
 	rom = (UINT16 *)(memory_region(machine, "maincpu") + 0x100000);
 	/* swap data lines on the whole ROMs */
-	for (i = 0;i < 0x800000/2;i++)
+	data.rom = rom;
+	data.table = alloc_array_or_die(UINT16, 0x10000);
+	for (i = 0;i < 0x10000;i++)
 	{
-		rom[i] = BITSWAP16(rom[i],13,7,3,0,9,4,5,6,1,12,8,14,10,11,2,15);
+		data.table[i] = BITSWAP16(i,13,7,3,0,9,4,5,6,1,12,8,14,10,11,2,15);
 	}
+	gn_parallel_for(0, 0x800000/2, 0x400, p_rom_swap_data, &data);
+	free(data.table);
 
 	/* swap address lines for the banked part */
-	for (i = 0;i < 0x600000/2;i+=0x800/2)
+	banks.rom = rom;
+	banks.bank_words = 0x800/2;
+	banks.perm = alloc_array_or_die(UINT32, 0x800/2);
+	for (j = 0;j < 0x800/2;j++)
 	{
-		UINT16 buffer[0x800/2];
-		memcpy(buffer,&rom[i],0x800);
-		for (j = 0;j < 0x800/2;j++)
-		{
-			rom[i+j] = buffer[BITSWAP24(j,23,22,21,20,19,18,17,16,15,14,13,12,11,10,6,2,4,9,8,3,1,7,0,5)];
-		}
+		banks.perm[j] = BITSWAP24(j,23,22,21,20,19,18,17,16,15,14,13,12,11,10,6,2,4,9,8,3,1,7,0,5);
 	}
+	gn_parallel_for(0, 0x600000/0x800, 1, p_rom_swap_banks, &banks);
+	free(banks.perm);
 
 	/* swap address lines & relocate fixed part */
 	rom = (UINT16 *)memory_region(machine, "maincpu");
@@ -1105,14 +1290,20 @@ void garou_decrypt_68k(running_machine *machine)
 {
 	UINT16 *rom;
 	int i,j;
+	struct p_rom_data_job data;
+	struct p_rom_bank_job banks;
 
 	/* thanks to Razoola and Mr K for the info */
 	rom = (UINT16 *)(memory_region(machine, "maincpu") + 0x100000);
 	/* swap data lines on the whole ROMs */
-	for (i = 0;i < 0x800000/2;i++)
+	data.rom = rom;
+	data.table = alloc_array_or_die(UINT16, 0x10000);
+	for (i = 0;i < 0x10000;i++)
 	{
-		rom[i] = BITSWAP16(rom[i],13,12,14,10,8,2,3,1,5,9,11,4,15,0,6,7);
+		data.table[i] = BITSWAP16(i,13,12,14,10,8,2,3,1,5,9,11,4,15,0,6,7);
 	}
+	gn_parallel_for(0, 0x800000/2, 0x400, p_rom_swap_data, &data);
+	free(data.table);
 
 	/* swap address lines & relocate fixed part */
 	rom = (UINT16 *)memory_region(machine, "maincpu");
@@ -1123,15 +1314,15 @@ void garou_decrypt_68k(running_machine *machine)
 
 	/* swap address lines for the banked part */
 	rom = (UINT16 *)(memory_region(machine, "maincpu") + 0x100000);
-	for (i = 0;i < 0x800000/2;i+=0x8000/2)
+	banks.rom = rom;
+	banks.bank_words = 0x8000/2;
+	banks.perm = alloc_array_or_die(UINT32, 0x8000/2);
+	for (j = 0;j < 0x8000/2;j++)
 	{
-		UINT16 buffer[0x8000/2];
-		memcpy(buffer,&rom[i],0x8000);
-		for (j = 0;j < 0x8000/2;j++)
-		{
-			rom[i+j] = buffer[BITSWAP24(j,23,22,21,20,19,18,17,16,15,14,9,4,8,3,13,6,2,7,0,12,1,11,10,5)];
-		}
+		banks.perm[j] = BITSWAP24(j,23,22,21,20,19,18,17,16,15,14,9,4,8,3,13,6,2,7,0,12,1,11,10,5);
 	}
+	gn_parallel_for(0, 0x800000/0x8000, 1, p_rom_swap_banks, &banks);
+	free(banks.perm);
 }
 
 
@@ -1139,14 +1330,20 @@ void garouo_decrypt_68k(running_machine *machine)
 {
 	UINT16 *rom;
 	int i,j;
+	struct p_rom_data_job data;
+	struct p_rom_bank_job banks;
 
 	/* thanks to Razoola and Mr K for the info */
 	rom = (UINT16 *)(memory_region(machine, "maincpu") + 0x100000);
 	/* swap data lines on the whole ROMs */
-	for (i = 0;i < 0x800000/2;i++)
+	data.rom = rom;
+	data.table = alloc_array_or_die(UINT16, 0x10000);
+	for (i = 0;i < 0x10000;i++)
 	{
-		rom[i] = BITSWAP16(rom[i],14,5,1,11,7,4,10,15,3,12,8,13,0,2,9,6);
+		data.table[i] = BITSWAP16(i,14,5,1,11,7,4,10,15,3,12,8,13,0,2,9,6);
 	}
+	gn_parallel_for(0, 0x800000/2, 0x400, p_rom_swap_data, &data);
+	free(data.table);
 
 	/* swap address lines & relocate fixed part */
 	rom = (UINT16 *)memory_region(machine, "maincpu");
@@ -1157,15 +1354,15 @@ void garouo_decrypt_68k(running_machine *machine)
 
 	/* swap address lines for the banked part */
 	rom = (UINT16 *)(memory_region(machine, "maincpu") + 0x100000);
-	for (i = 0;i < 0x800000/2;i+=0x8000/2)
+	banks.rom = rom;
+	banks.bank_words = 0x8000/2;
+	banks.perm = alloc_array_or_die(UINT32, 0x8000/2);
+	for (j = 0;j < 0x8000/2;j++)
 	{
-		UINT16 buffer[0x8000/2];
-		memcpy(buffer,&rom[i],0x8000);
-		for (j = 0;j < 0x8000/2;j++)
-		{
-			rom[i+j] = buffer[BITSWAP24(j,23,22,21,20,19,18,17,16,15,14,12,8,1,7,11,3,13,10,6,9,5,4,0,2)];
-		}
+		banks.perm[j] = BITSWAP24(j,23,22,21,20,19,18,17,16,15,14,12,8,1,7,11,3,13,10,6,9,5,4,0,2);
 	}
+	gn_parallel_for(0, 0x800000/0x8000, 1, p_rom_swap_banks, &banks);
+	free(banks.perm);
 }
 
 
@@ -1173,14 +1370,20 @@ void mslug3_decrypt_68k(running_machine *machine)
 {
 	UINT16 *rom;
 	int i,j;
+	struct p_rom_data_job data;
+	struct p_rom_bank_job banks;
 
 	/* thanks to Razoola and Mr K for the info */
 	rom = (UINT16 *)(memory_region(machine, "maincpu") + 0x100000);
 	/* swap data lines on the whole ROMs */
-	for (i = 0;i < 0x800000/2;i++)
+	data.rom = rom;
+	data.table = alloc_array_or_die(UINT16, 0x10000);
+	for (i = 0;i < 0x10000;i++)
 	{
-		rom[i] = BITSWAP16(rom[i],4,11,14,3,1,13,0,7,2,8,12,15,10,9,5,6);
+		data.table[i] = BITSWAP16(i,4,11,14,3,1,13,0,7,2,8,12,15,10,9,5,6);
 	}
+	gn_parallel_for(0, 0x800000/2, 0x400, p_rom_swap_data, &data);
+	free(data.table);
 
 	/* swap address lines & relocate fixed part */
 	rom = (UINT16 *)memory_region(machine, "maincpu");
@@ -1191,15 +1394,15 @@ void mslug3_decrypt_68k(running_machine *machine)
 
 	/* swap address lines for the banked part */
 	rom = (UINT16 *)(memory_region(machine, "maincpu") + 0x100000);
-	for (i = 0;i < 0x800000/2;i+=0x10000/2)
+	banks.rom = rom;
+	banks.bank_words = 0x10000/2;
+	banks.perm = alloc_array_or_die(UINT32, 0x10000/2);
+	for (j = 0;j < 0x10000/2;j++)
 	{
-		UINT16 buffer[0x10000/2];
-		memcpy(buffer,&rom[i],0x10000);
-		for (j = 0;j < 0x10000/2;j++)
-		{
-			rom[i+j] = buffer[BITSWAP24(j,23,22,21,20,19,18,17,16,15,2,11,0,14,6,4,13,8,9,3,10,7,5,12,1)];
-		}
+		banks.perm[j] = BITSWAP24(j,23,22,21,20,19,18,17,16,15,2,11,0,14,6,4,13,8,9,3,10,7,5,12,1);
 	}
+	gn_parallel_for(0, 0x800000/0x10000, 1, p_rom_swap_banks, &banks);
+	free(banks.perm);
 }
 
 
@@ -1207,25 +1410,31 @@ void kof2000_decrypt_68k(running_machine *machine)
 {
 	UINT16 *rom;
 	int i,j;
+	struct p_rom_data_job data;
+	struct p_rom_bank_job banks;
 
 	/* thanks to Razoola and Mr K for the info */
 	rom = (UINT16 *)(memory_region(machine, "maincpu") + 0x100000);
 	/* swap data lines on the whole ROMs */
-	for (i = 0;i < 0x800000/2;i++)
+	data.rom = rom;
+	data.table = alloc_array_or_die(UINT16, 0x10000);
+	for (i = 0;i < 0x10000;i++)
 	{
-		rom[i] = BITSWAP16(rom[i],12,8,11,3,15,14,7,0,10,13,6,5,9,2,1,4);
+		data.table[i] = BITSWAP16(i,12,8,11,3,15,14,7,0,10,13,6,5,9,2,1,4);
 	}
+	gn_parallel_for(0, 0x800000/2, 0x400, p_rom_swap_data, &data);
+	free(data.table);
 
 	/* swap address lines for the banked part */
-	for (i = 0;i < 0x63a000/2;i+=0x800/2)
+	banks.rom = rom;
+	banks.bank_words = 0x800/2;
+	banks.perm = alloc_array_or_die(UINT32, 0x800/2);
+	for (j = 0;j < 0x800/2;j++)
 	{
-		UINT16 buffer[0x800/2];
-		memcpy(buffer,&rom[i],0x800);
-		for (j = 0;j < 0x800/2;j++)
-		{
-			rom[i+j] = buffer[BITSWAP24(j,23,22,21,20,19,18,17,16,15,14,13,12,11,10,4,1,3,8,6,2,7,0,9,5)];
-		}
+		banks.perm[j] = BITSWAP24(j,23,22,21,20,19,18,17,16,15,14,13,12,11,10,4,1,3,8,6,2,7,0,9,5);
 	}
+	gn_parallel_for(0, 0x63a000/0x800, 1, p_rom_swap_banks, &banks);
+	free(banks.perm);
 
 	/* swap address lines & relocate fixed part */
 	rom = (UINT16 *)memory_region(machine, "maincpu");
@@ -1306,6 +1515,8 @@ void mslug5_decrypt_68k(running_machine *machine)
 	static const UINT8 xor2[ 0x20 ] = { 0x36, 0x09, 0xb0, 0x64, 0x95, 0x0f, 0x90, 0x42, 0x6e, 0x0f, 0x30, 0xf6, 0xe5, 0x08, 0x30, 0x64, 0x08, 0x04, 0x00, 0x2f, 0x72, 0x09, 0xa0, 0x13, 0xc9, 0x0b, 0xa0, 0x3e, 0xc2, 0x00, 0x40, 0x2b };
 	int i;
 	int ofst;
+	struct p_rom_xor_job swap;
+	struct p_rom_block_job blocks;
 	int rom_size = 0x800000;
 	UINT8 *rom = memory_region( machine, "maincpu" );
 	UINT8 *buf = alloc_array_or_die(UINT8,  rom_size );
@@ -1314,30 +1525,29 @@ void mslug5_decrypt_68k(running_machine *machine)
 	{
 		rom[ i ] ^= xor1[ (BYTE_XOR_LE(i) % 0x20) ];
 	}
-	for( i = 0x100000; i < 0x800000; i++ )
+	swap.rom = rom;
+	swap.xor_bytes = xor2;
+	swap.table = alloc_array_or_die(UINT16, 0x10000);
+	for( i = 0; i < 0x10000; i++ )
 	{
-		rom[ i ] ^= xor2[ (BYTE_XOR_LE(i) % 0x20) ];
-	}
-
-	for( i = 0x100000; i < 0x0800000; i += 4 )
-	{
-		UINT16 rom16;
-		rom16 = rom[BYTE_XOR_LE(i+1)] | rom[BYTE_XOR_LE(i+2)]<<8;
-		rom16 = BITSWAP16( rom16, 15, 14, 13, 12, 10, 11, 8, 9, 6, 7, 4, 5, 3, 2, 1, 0 );
-		rom[BYTE_XOR_LE(i+1)] = rom16&0xff;
-		rom[BYTE_XOR_LE(i+2)] = rom16>>8;
+		swap.table[ i ] = BITSWAP16( i, 15, 14, 13, 12, 10, 11, 8, 9, 6, 7, 4, 5, 3, 2, 1, 0 );
 	}
+	gn_parallel_for( 0x100000 / 4, 0x800000 / 4, 0x100, p_rom_xor_swap, &swap );
+	free( swap.table );
 	memcpy( buf, rom, rom_size );
 	for( i = 0; i < 0x0100000 / 0x10000; i++ )
 	{
 		ofst = (i & 0xf0) + BITSWAP8( (i & 0x0f), 7, 6, 5, 4, 1, 0, 3, 2 );
 		memcpy( &rom[ i * 0x10000 ], &buf[ ofst * 0x10000 ], 0x10000 );
 	}
-	for( i = 0x100000; i < 0x800000; i += 0x100 )
+	blocks.dst = rom;
+	blocks.src = buf;
+	blocks.xor_8_11 = 0x00700;
+	for( i = 0; i < 0x100; i++ )
 	{
-		ofst = (i & 0xf000ff) + ((i & 0x000f00) ^ 0x00700) + (BITSWAP8( ((i & 0x0ff000) >> 12), 5, 4, 7, 6, 1, 0, 3, 2 ) << 12);
-		memcpy( &rom[ i ], &buf[ ofst ], 0x100 );
+		blocks.bank[ i ] = BITSWAP8( i, 5, 4, 7, 6, 1, 0, 3, 2 );
 	}
+	gn_parallel_for( 0x100000 / 0x100, 0x800000 / 0x100, 0x10, p_rom_move_blocks, &blocks );
 	memcpy( buf, rom, rom_size );
 	memcpy( &rom[ 0x100000 ], &buf[ 0x700000 ], 0x100000 );
 	memcpy( &rom[ 0x200000 ], &buf[ 0x100000 ], 0x600000 );
@@ -1351,6 +1561,8 @@ void svc_px_decrypt(running_machine *machine)
 	static const UINT8 xor2[ 0x20 ] = { 0x69, 0x0b, 0x60, 0xd6, 0x4f, 0x01, 0x40, 0x1a, 0x9f, 0x0b, 0xf0, 0x75, 0x58, 0x0e, 0x60, 0xb4, 0x14, 0x04, 0x20, 0xe4, 0xb9, 0x0d, 0x10, 0x89, 0xeb, 0x07, 0x30, 0x90, 0x50, 0x0e, 0x20, 0x26 };
 	int i;
 	int ofst;
+	struct p_rom_xor_job swap;
+	struct p_rom_block_job blocks;
 	int rom_size = 0x800000;
 	UINT8 *rom = memory_region( machine, "maincpu" );
 	UINT8 *buf = alloc_array_or_die(UINT8,  rom_size );
@@ -1359,30 +1571,29 @@ void svc_px_decrypt(running_machine *machine)
 	{
 		rom[ i ] ^= xor1[ (BYTE_XOR_LE(i) % 0x20) ];
 	}
-	for( i = 0x100000; i < 0x800000; i++ )
-	{
-		rom[ i ] ^= xor2[ (BYTE_XOR_LE(i) % 0x20) ];
-	}
-
-	for( i = 0x100000; i < 0x0800000; i += 4 )
+	swap.rom = rom;
+	swap.xor_bytes = xor2;
+	swap.table = alloc_array_or_die(UINT16, 0x10000);
+	for( i = 0; i < 0x10000; i++ )
 	{
-		UINT16 rom16;
-		rom16 = rom[BYTE_XOR_LE(i+1)] | rom[BYTE_XOR_LE(i+2)]<<8;
-		rom16 = BITSWAP16( rom16, 15, 14, 13, 12, 10, 11, 8, 9, 6, 7, 4, 5, 3, 2, 1, 0 );
-		rom[BYTE_XOR_LE(i+1)] = rom16&0xff;
-		rom[BYTE_XOR_LE(i+2)] = rom16>>8;
+		swap.table[ i ] = BITSWAP16( i, 15, 14, 13, 12, 10, 11, 8, 9, 6, 7, 4, 5, 3, 2, 1, 0 );
 	}
+	gn_parallel_for( 0x100000 / 4, 0x800000 / 4, 0x100, p_rom_xor_swap, &swap );
+	free( swap.table );
 	memcpy( buf, rom, rom_size );
 	for( i = 0; i < 0x0100000 / 0x10000; i++ )
 	{
 		ofst = (i & 0xf0) + BITSWAP8( (i & 0x0f), 7, 6, 5, 4, 2, 3, 0, 1 );
 		memcpy( &rom[ i * 0x10000 ], &buf[ ofst * 0x10000 ], 0x10000 );
 	}
-	for( i = 0x100000; i < 0x800000; i += 0x100 )
+	blocks.dst = rom;
+	blocks.src = buf;
+	blocks.xor_8_11 = 0x00a00;
+	for( i = 0; i < 0x100; i++ )
 	{
-		ofst = (i & 0xf000ff) + ((i & 0x000f00) ^ 0x00a00) + (BITSWAP8( ((i & 0x0ff000) >> 12), 4, 5, 6, 7, 1, 0, 3, 2 ) << 12);
-		memcpy( &rom[ i ], &buf[ ofst ], 0x100 );
+		blocks.bank[ i ] = BITSWAP8( i, 4, 5, 6, 7, 1, 0, 3, 2 );
 	}
+	gn_parallel_for( 0x100000 / 0x100, 0x800000 / 0x100, 0x10, p_rom_move_blocks, &blocks );
 	memcpy( buf, rom, rom_size );
 	memcpy( &rom[ 0x100000 ], &buf[ 0x700000 ], 0x100000 );
 	memcpy( &rom[ 0x200000 ], &buf[ 0x100000 ], 0x600000 );
@@ -1395,6 +1606,8 @@ void kf2k3pcb_decrypt_68k(running_machine *machine)
 	static const UINT8 xor2[ 0x20 ] = { 0xb4, 0x0f, 0x40, 0x6c, 0x38, 0x07, 0xd0, 0x3f, 0x53, 0x08, 0x80, 0xaa, 0xbe, 0x07, 0xc0, 0xfa, 0xd0, 0x08, 0x10, 0xd2, 0xf1, 0x03, 0x70, 0x7e, 0x87, 0x0b, 0x40, 0xf6, 0x2a, 0x0a, 0xe0, 0xf9 };
 	int i;
 	int ofst;
+	struct p_rom_xor_job swap;
+	struct p_rom_block_job blocks;
 	int rom_size = 0x900000;
 	UINT8 *rom = memory_region( machine, "maincpu" );
 	UINT8 *buf = alloc_array_or_die(UINT8,  rom_size );
@@ -1403,28 +1616,28 @@ void kf2k3pcb_decrypt_68k(running_machine *machine)
 	{
 		rom[ 0x800000 + i ] ^= rom[ 0x100002 | BYTE_XOR_LE(i) ];
 	}
-	for( i = 0x100000; i < 0x800000; i++ )
+	swap.rom = rom;
+	swap.xor_bytes = xor2;
+	swap.table = alloc_array_or_die(UINT16, 0x10000);
+	for( i = 0; i < 0x10000; i++ )
 	{
-		rom[ i ] ^= xor2[ (BYTE_XOR_LE(i) % 0x20) ];
-	}
-	for( i = 0x100000; i < 0x800000; i += 4 )
-	{
-		UINT16 rom16;
-		rom16 = rom[BYTE_XOR_LE(i+1)] | rom[BYTE_XOR_LE(i+2)]<<8;
-		rom16 = BITSWAP16( rom16, 15, 14, 13, 12, 4, 5, 6, 7, 8, 9, 10, 11, 3, 2, 1, 0 );
-		rom[BYTE_XOR_LE(i+1)] = rom16&0xff;
-		rom[BYTE_XOR_LE(i+2)] = rom16>>8;
+		swap.table[ i ] = BITSWAP16( i, 15, 14, 13, 12, 4, 5, 6, 7, 8, 9, 10, 11, 3, 2, 1, 0 );
 	}
+	gn_parallel_for( 0x100000 / 4, 0x800000 / 4, 0x100, p_rom_xor_swap, &swap );
+	free( swap.table );
 	for( i = 0; i < 0x0100000 / 0x10000; i++ )
 	{
 		ofst = (i & 0xf0) + BITSWAP8( (i & 0x0f), 7, 6, 5, 4, 1, 0, 3, 2 );
 		memcpy( &buf[ i * 0x10000 ], &rom[ ofst * 0x10000 ], 0x10000 );
 	}
-	for( i = 0x100000; i < 0x900000; i += 0x100 )
+	blocks.dst = buf;
+	blocks.src = rom;
+	blocks.xor_8_11 = 0x00300;
+	for( i = 0; i < 0x100; i++ )
 	{
-		ofst = (i & 0xf000ff) + ((i & 0x000f00) ^ 0x00300) + (BITSWAP8( ((i & 0x0ff000) >> 12), 4, 5, 6, 7, 1, 0, 3, 2 ) << 12);
-		memcpy( &buf[ i ], &rom[ ofst ], 0x100 );
+		blocks.bank[ i ] = BITSWAP8( i, 4, 5, 6, 7, 1, 0, 3, 2 );
 	}
+	gn_parallel_for( 0x100000 / 0x100, 0x900000 / 0x100, 0x10, p_rom_move_blocks, &blocks );
 	memcpy (&rom[0x000000], &buf[0x000000], 0x100000);
 	memcpy (&rom[0x100000], &buf[0x800000], 0x100000);
 	memcpy (&rom[0x200000], &buf[0x100000], 0x700000);
@@ -1438,6 +1651,8 @@ void kof2003_decrypt_68k(running_machine *machine)
 	static const UINT8 xor2[0x20] = { 0x2f, 0x02, 0x60, 0xbb, 0x77, 0x01, 0x30, 0x08, 0xd8, 0x01, 0xa0, 0xdf, 0x37, 0x0a, 0xf0, 0x65, 0x28, 0x03, 0xd0, 0x23, 0xd3, 0x03, 0x70, 0x42, 0xbb, 0x06, 0xf0, 0x28, 0xba, 0x0f, 0xf0, 0x7a };
 	int i;
 	int ofst;
+	struct p_rom_xor_job swap;
+	struct p_rom_block_job blocks;
 	int rom_size = 0x900000;
 	UINT8 *rom = memory_region( machine, "maincpu" );
 	UINT8 *buf = alloc_array_or_die(UINT8,  rom_size );
@@ -1450,28 +1665,28 @@ void kof2003_decrypt_68k(running_machine *machine)
 	{
 		rom[ i ] ^= xor1[ (BYTE_XOR_LE(i) % 0x20) ];
 	}
-	for( i = 0x100000; i < 0x800000; i++)
-	{
-		rom[ i ] ^= xor2[ (BYTE_XOR_LE(i) % 0x20) ];
-	}
-	for( i = 0x100000; i < 0x800000; i += 4)
+	swap.rom = rom;
+	swap.xor_bytes = xor2;
+	swap.table = alloc_array_or_die(UINT16, 0x10000);
+	for( i = 0; i < 0x10000; i++ )
 	{
-		UINT16 rom16;
-		rom16 = rom[BYTE_XOR_LE(i+1)] | rom[BYTE_XOR_LE(i+2)]<<8;
-		rom16 = BITSWAP16( rom16, 15, 14, 13, 12, 5, 4, 7, 6, 9, 8, 11, 10, 3, 2, 1, 0 );
-		rom[BYTE_XOR_LE(i+1)] = rom16&0xff;
-		rom[BYTE_XOR_LE(i+2)] = rom16>>8;
+		swap.table[ i ] = BITSWAP16( i, 15, 14, 13, 12, 5, 4, 7, 6, 9, 8, 11, 10, 3, 2, 1, 0 );
 	}
+	gn_parallel_for( 0x100000 / 4, 0x800000 / 4, 0x100, p_rom_xor_swap, &swap );
+	free( swap.table );
 	for( i = 0; i < 0x0100000 / 0x10000; i++ )
 	{
 		ofst = (i & 0xf0) + BITSWAP8((i & 0x0f), 7, 6, 5, 4, 0, 1, 2, 3);
 		memcpy( &buf[ i * 0x10000 ], &rom[ ofst * 0x10000 ], 0x10000 );
 	}
-	for( i = 0x100000; i < 0x900000; i += 0x100)
+	blocks.dst = buf;
+	blocks.src = rom;
+	blocks.xor_8_11 = 0x00800;
+	for( i = 0; i < 0x100; i++ )
 	{
-		ofst = (i & 0xf000ff) + ((i & 0x000f00) ^ 0x00800) + (BITSWAP8( ((i & 0x0ff000) >> 12), 4, 5, 6, 7, 1, 0, 3, 2 ) << 12);
-		memcpy( &buf[ i ], &rom[ ofst ], 0x100 );
+		blocks.bank[ i ] = BITSWAP8( i, 4, 5, 6, 7, 1, 0, 3, 2 );
 	}
+	gn_parallel_for( 0x100000 / 0x100, 0x900000 / 0x100, 0x10, p_rom_move_blocks, &blocks );
 	memcpy (&rom[0x000000], &buf[0x000000], 0x100000);
 	memcpy (&rom[0x100000], &buf[0x800000], 0x100000);
 	memcpy (&rom[0x200000], &buf[0x100000], 0x700000);
@@ -1486,6 +1701,8 @@ void kof2003h_decrypt_68k(running_machine *machine)
 	static const UINT8 xor2[0x20] = { 0x2b, 0x09, 0xd0, 0x7f, 0x51, 0x0b, 0x10, 0x4c, 0x5b, 0x07, 0x70, 0x9d, 0x3e, 0x0b, 0xb0, 0xb6, 0x54, 0x09, 0xe0, 0xcc, 0x3d, 0x0d, 0x80, 0x99, 0x87, 0x03, 0x90, 0x82, 0xfe, 0x04, 0x20, 0x18 };
 	int i;
 	int ofst;
+	struct p_rom_xor_job swap;
+	struct p_rom_block_job blocks;
 	int rom_size = 0x900000;
 	UINT8 *rom = memory_region( machine, "maincpu" );
 	UINT8 *buf = alloc_array_or_die(UINT8,  rom_size );
@@ -1498,28 +1715,28 @@ void kof2003h_decrypt_68k(running_machine *machine)
 	{
 		rom[ i ] ^= xor1[ (BYTE_XOR_LE(i) % 0x20) ];
 	}
-	for( i = 0x100000; i < 0x800000; i++)
+	swap.rom = rom;
+	swap.xor_bytes = xor2;
+	swap.table = alloc_array_or_die(UINT16, 0x10000);
+	for( i = 0; i < 0x10000; i++ )
 	{
-		rom[ i ] ^= xor2[ (BYTE_XOR_LE(i) % 0x20) ];
-	}
-	for( i = 0x100000; i < 0x800000; i += 4)
-	{
-		UINT16 rom16;
-		rom16 = rom[BYTE_XOR_LE(i+1)] | rom[BYTE_XOR_LE(i+2)]<<8;
-		rom16 = BITSWAP16( rom16, 15, 14, 13, 12, 10, 11, 8, 9, 6, 7, 4, 5, 3, 2, 1, 0 );
-		rom[BYTE_XOR_LE(i+1)] = rom16&0xff;
-		rom[BYTE_XOR_LE(i+2)] = rom16>>8;
+		swap.table[ i ] = BITSWAP16( i, 15, 14, 13, 12, 10, 11, 8, 9, 6, 7, 4, 5, 3, 2, 1, 0 );
 	}
+	gn_parallel_for( 0x100000 / 4, 0x800000 / 4, 0x100, p_rom_xor_swap, &swap );
+	free( swap.table );
 	for( i = 0; i < 0x0100000 / 0x10000; i++ )
 	{
 		ofst = (i & 0xf0) + BITSWAP8((i & 0x0f), 7, 6, 5, 4, 1, 0, 3, 2);
 		memcpy( &buf[ i * 0x10000 ], &rom[ ofst * 0x10000 ], 0x10000 );
 	}
-	for( i = 0x100000; i < 0x900000; i += 0x100)
+	blocks.dst = buf;
+	blocks.src = rom;
+	blocks.xor_8_11 = 0x00400;
+	for( i = 0; i < 0x100; i++ )
 	{
-		ofst = (i & 0xf000ff) + ((i & 0x000f00) ^ 0x00400) + (BITSWAP8( ((i & 0x0ff000) >> 12), 6, 7, 4, 5, 0, 1, 2, 3 ) << 12);
-		memcpy( &buf[ i ], &rom[ ofst ], 0x100 );
+		blocks.bank[ i ] = BITSWAP8( i, 6, 7, 4, 5, 0, 1, 2, 3 );
 	}
+	gn_parallel_for( 0x100000 / 0x100, 0x900000 / 0x100, 0x10, p_rom_move_blocks, &blocks );
 	memcpy (&rom[0x000000], &buf[0x000000], 0x100000);
 	memcpy (&rom[0x100000], &buf[0x800000], 0x100000);
 	memcpy (&rom[0x200000], &buf[0x100000], 0x700000);
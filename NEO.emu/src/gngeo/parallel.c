@@ -0,0 +1,180 @@
+/*  gngeo, a neogeo emulator
+ *  Copyright (C) 2001 Peponas Mathieu
+ * 
+ *  This program is free software; you can redistribute it and/or modify  
+ *  it under the terms of the GNU General Public License as published by   
+ *  the Free Software Foundation; either version 2 of the License, or    
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Library General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA. 
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <gngeo-config.h>
+#endif
+
+#include <time.h>
+#if defined(__unix__) || defined(__APPLE__)
+#define PARALLEL_THREADS
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#include "parallel.h"
+
+#define MAX_THREADS 8
+
+struct parallel_job {
+	gn_parallel_func func;
+	void *arg;
+	Uint32 end;
+	Uint32 chunk;
+	Uint32 next; /* start of the next chunk nobody took yet */
+};
+
+static void run_chunks(struct parallel_job *job) {
+	for (;;) {
+#ifdef PARALLEL_THREADS
+		Uint32 s = __sync_fetch_and_add(&job->next, job->chunk);
+#else
+		Uint32 s = job->next;
+		job->next += job->chunk;
+#endif
+		Uint32 e;
+		if (s >= job->end)
+			return;
+		e = job->end - s < job->chunk ? job->end : s + job->chunk;
+		job->func(job->arg, s, e);
+	}
+}
+
+#ifdef PARALLEL_THREADS
+/* Workers started by gn_parallel_start(), parked on wake between jobs */
+static struct {
+	pthread_t thread[MAX_THREADS];
+	int threads;
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+	pthread_cond_t done;
+	struct parallel_job *job;
+	Uint32 generation; /* bumped for every job */
+	int busy; /* workers still running the current job */
+	int stop;
+} pool = { .lock = PTHREAD_MUTEX_INITIALIZER, .wake = PTHREAD_COND_INITIALIZER, .done = PTHREAD_COND_INITIALIZER };
+
+static void *parallel_worker(void *arg) {
+	Uint32 generation = 0;
+
+	pthread_mutex_lock(&pool.lock);
+	for (;;) {
+		struct parallel_job *job;
+		while (pool.generation == generation && !pool.stop)
+			pthread_cond_wait(&pool.wake, &pool.lock);
+		if (pool.stop)
+			break;
+		generation = pool.generation;
+		job = pool.job;
+		pthread_mutex_unlock(&pool.lock);
+		run_chunks(job);
+		pthread_mutex_lock(&pool.lock);
+		if (--pool.busy == 0)
+			pthread_cond_signal(&pool.done);
+	}
+	pthread_mutex_unlock(&pool.lock);
+	return NULL;
+}
+
+static int cpu_count(void) {
+	static int cpus = 0;
+	if (!cpus) {
+		long n = sysconf(_SC_NPROCESSORS_ONLN);
+		cpus = n < 1 ? 1 : n > MAX_THREADS ? MAX_THREADS : n;
+	}
+	return cpus;
+}
+#endif
+
+void gn_parallel_start(void) {
+#ifdef PARALLEL_THREADS
+	int cpus = cpu_count();
+
+	if (pool.threads)
+		return;
+	/* the thread calling gn_parallel_for() makes up the last CPU */
+	while (pool.threads < cpus - 1) {
+		if (pthread_create(&pool.thread[pool.threads], NULL, parallel_worker, NULL) != 0)
+			break;
+		pool.threads++;
+	}
+#endif
+}
+
+void gn_parallel_stop(void) {
+#ifdef PARALLEL_THREADS
+	int i;
+
+	if (!pool.threads)
+		return;
+	pthread_mutex_lock(&pool.lock);
+	pool.stop = 1;
+	pthread_cond_broadcast(&pool.wake);
+	pthread_mutex_unlock(&pool.lock);
+	for (i = 0; i < pool.threads; i++)
+		pthread_join(pool.thread[i], NULL);
+	/* the next workers start out waiting for the first job again */
+	pool.threads = 0;
+	pool.generation = 0;
+	pool.stop = 0;
+#endif
+}
+
+void gn_parallel_for(Uint32 start, Uint32 end, Uint32 grain, gn_parallel_func func, void *arg) {
+	struct parallel_job job;
+	Uint32 chunk;
+	int threads = 1;
+
+	if (end <= start)
+		return;
+	if (grain == 0)
+		grain = 1;
+#ifdef PARALLEL_THREADS
+	threads += pool.threads;
+#endif
+	/* a few chunks per thread evens out CPUs of different speeds */
+	chunk = (end - start) / (threads * 4);
+	chunk = chunk < grain ? grain : chunk - chunk % grain;
+	job.func = func;
+	job.arg = arg;
+	job.end = end;
+	job.chunk = chunk;
+	job.next = start;
+#ifdef PARALLEL_THREADS
+	if (threads > 1 && end - start > chunk) {
+		pthread_mutex_lock(&pool.lock);
+		pool.job = &job;
+		pool.busy = pool.threads;
+		pool.generation++;
+		pthread_cond_broadcast(&pool.wake);
+		pthread_mutex_unlock(&pool.lock);
+		run_chunks(&job);
+		pthread_mutex_lock(&pool.lock);
+		while (pool.busy)
+			pthread_cond_wait(&pool.done, &pool.lock);
+		pthread_mutex_unlock(&pool.lock);
+		return;
+	}
+#endif
+	run_chunks(&job);
+}
+
+Uint32 gn_time_ms(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
@@ -0,0 +1,41 @@
+/*  gngeo, a neogeo emulator
+ *  Copyright (C) 2001 Peponas Mathieu
+ * 
+ *  This program is free software; you can redistribute it and/or modify  
+ *  it under the terms of the GNU General Public License as published by   
+ *  the Free Software Foundation; either version 2 of the License, or    
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Library General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA. 
+ */
+
+#ifndef _PARALLEL_H_
+#define _PARALLEL_H_
+
+#include <gngeoTypes.h>
+
+/* Start and join the worker threads, one per online CPU besides the calling
+ * thread. They're kept from the start of a load until its end, and wait for
+ * work in between. */
+void gn_parallel_start(void);
+void gn_parallel_stop(void);
+
+/* Calls func(arg, s, e) on consecutive chunks [s, e) of [start, end) from
+ * the started workers and the calling thread, and returns once every chunk
+ * is done. Without workers the range runs on the calling thread. Chunks hold
+ * at least grain items, so func can assume alignment to it. func must only
+ * write data owned by its own chunk. */
+typedef void (*gn_parallel_func)(void *arg, Uint32 start, Uint32 end);
+void gn_parallel_for(Uint32 start, Uint32 end, Uint32 grain, gn_parallel_func func, void *arg);
+
+/* Milliseconds from an arbitrary point, for load time logging */
+Uint32 gn_time_ms(void);
+
+#endif
@@ -28,6 +28,7 @@
 #include "transpack.h"
 #include "conf.h"
 #include "resfile.h"
+#include "parallel.h"
 #include "menu.h"
 #ifdef GP2X
 #include "gp2x.h"
@@ -1078,62 +1079,67 @@ static struct PKZIP *open_rom_zip(char *rom_path, char *name) {
 	return NULL;
 }
 
+/* plane_spread[b] has bit x of b moved to bit 0 of nibble 7 - x, so a row of
+ * 4bpp pixels is built from its 4 bit planes with 4 lookups */
+static Uint32 plane_spread[256];
+
+static void init_plane_spread(void) {
+	int b, x;
+	for (b = 0; b < 256; b++) {
+		Uint32 v = 0;
+		for (x = 0; x < 8; x++)
+			v |= ((b >> x) & 1) << ((7 - x) << 2);
+		plane_spread[b] = v;
+	}
+}
+
+static __inline__ Uint32 convert_tile_row(const Uint8 *p) {
+	return plane_spread[p[3]] << 3 | plane_spread[p[1]] << 2 |
+			plane_spread[p[2]] << 1 | plane_spread[p[0]];
+}
+
 static int convert_roms_tile(Uint8 *g, int tileno) {
 	unsigned char swap[128];
 	unsigned int *gfxdata;
-	int x, y;
-	unsigned int pen, usage = 0;
+	int y;
+	Uint32 pens = 0;
 	gfxdata = (Uint32*) & g[tileno << 7];
 
 	memcpy(swap, gfxdata, 128);
 
-	//filed=1;
 	for (y = 0; y < 16; y++) {
-		unsigned int dw;
-
-		dw = 0;
-		for (x = 0; x < 8; x++) {
-			pen = ((swap[64 + (y << 2) + 3] >> x) & 1) << 3;
-			pen |= ((swap[64 + (y << 2) + 1] >> x) & 1) << 2;
-			pen |= ((swap[64 + (y << 2) + 2] >> x) & 1) << 1;
-			pen |= (swap[64 + (y << 2)] >> x) & 1;
-			//if (!pen) filed=0;
-			dw |= pen << ((7 - x) << 2);
-			//memory.pen_usage[tileno]  |= (1 << pen);
-			usage |= (1 << pen);
-		}
-		*(gfxdata++) = dw;
-
-		dw = 0;
-		for (x = 0; x < 8; x++) {
-			pen = ((swap[(y << 2) + 3] >> x) & 1) << 3;
-			pen |= ((swap[(y << 2) + 1] >> x) & 1) << 2;
-			pen |= ((swap[(y << 2) + 2] >> x) & 1) << 1;
-			pen |= (swap[(y << 2)] >> x) & 1;
-			//if (!pen) filed=0;
-			dw |= pen << ((7 - x) << 2);
-			//memory.pen_usage[tileno]  |= (1 << pen);
-			usage |= (1 << pen);
-		}
-		*(gfxdata++) = dw;
+		Uint32 dw0 = convert_tile_row(&swap[64 + (y << 2)]);
+		Uint32 dw1 = convert_tile_row(&swap[y << 2]);
+		*(gfxdata++) = dw0;
+		*(gfxdata++) = dw1;
+		pens |= dw0 | dw1;
 	}
 
-	//if ((usage & ~1) == 0) pen_usage|=(TILE_INVISIBLE<<((tileno&0xF)*2));
 	/* TODO transpack support */
-	if ((usage & ~1) == 0)
+	/* Invisible when every pixel uses pen 0 */
+	if (pens == 0)
 		return (TILE_INVISIBLE << ((tileno & 0xF) * 2));
 	else
 		return 0;
 
 }
 
+/* Each usage word covers 16 tiles, so chunks of words never share data */
+static void convert_tile_range(void *arg, Uint32 start, Uint32 end) {
+	GAME_ROMS *r = arg;
+	Uint32 i, j;
+	for (i = start; i < end; i++) {
+		Uint32 usage = 0;
+		for (j = i << 4; j < (i + 1) << 4; j++)
+			usage |= convert_roms_tile(r->tiles.p, j);
+		((Uint32*) r->spr_usage.p)[i] = usage;
+	}
+}
+
 void convert_all_tile(GAME_ROMS *r) {
-	Uint32 i;
 	allocate_region(&r->spr_usage, (r->tiles.size >> 11) * sizeof (Uint32), REGION_SPR_USAGE);
-	memset(r->spr_usage.p, 0, r->spr_usage.size);
-	for (i = 0; i < r->tiles.size >> 7; i++) {
-		((Uint32*) r->spr_usage.p)[i >> 4] |= convert_roms_tile(r->tiles.p, i);
-	}
+	init_plane_spread();
+	gn_parallel_for(0, r->tiles.size >> 11, 16, convert_tile_range, r);
 }
 
 void convert_all_char(Uint8 *Ptr, int Taille,
@@ -1374,6 +1380,7 @@ int dr_load_roms(GAME_ROMS *r, char *rom_path, char *name) {
 	ROM_DEF *drv;
 	int i;
 	int romsize;
+	Uint32 start_time;
 
 	memset(r, 0, sizeof (GAME_ROMS));
 
@@ -1450,6 +1457,7 @@ int dr_load_roms(GAME_ROMS *r, char *rom_path, char *name) {
 	}
 
 	/* Now, load the roms */
+	start_time = gn_time_ms();
 	read_counter = 0;
 	romsize = 0;
 	for (i = 0; i < drv->nb_romfile; i++)
@@ -1507,10 +1515,17 @@ int dr_load_roms(GAME_ROMS *r, char *rom_path, char *name) {
 	memset(memory.pen_usage, 0, (r->tiles.size >> 11) * sizeof(Uint32));
 	 */
 	memory.nb_of_tiles = r->tiles.size >> 7;
+	logMsg("ROM read took %u ms\n", gn_time_ms() - start_time);
 
-	/* Init rom and bios */
+	/* Init rom and bios, decryption and tile conversion share the workers */
+	gn_parallel_start();
+	start_time = gn_time_ms();
 	init_roms(r);
+	logMsg("ROM init & decrypt took %u ms\n", gn_time_ms() - start_time);
+	start_time = gn_time_ms();
 	convert_all_tile(r);
+	logMsg("Tile conversion took %u ms\n", gn_time_ms() - start_time);
+	gn_parallel_stop();
 	return dr_load_bios(r);
 
 error1:
@@ -1843,7 +1858,9 @@ int dr_open_gno(char *filename) {
 	memory.nb_of_tiles = r->tiles.size >> 7;
 
 	/* Init rom and bios */
+	gn_parallel_start();
 	init_roms(r);
+	gn_parallel_stop();
 	//convert_all_tile(r);
 	if(!dr_load_bios(r))
 		return false;
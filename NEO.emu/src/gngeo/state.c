@@ -6,6 +6,7 @@
 //#include "SDL_endian.h"
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 #include <stdbool.h>
 #if defined(HAVE_LIBZ) && defined (HAVE_MMAP)
 #include <zlib.h>
@@ -512,7 +513,28 @@ static gzFile open_state(/*char *game,int slot,*/char *st_name,int mode) {
 	return open_stateWithName(st_name, mode);
 }*/
 
+/* in-memory state, used by mkstate_data() when gzf is NULL */
+static Uint8 *mem_state_data;
+static int mem_state_size;
+static int mem_state_pos;
+
+static int mkstate_mem_data(void *data,int size,int mode) {
+	if (mem_state_pos + size > mem_state_size)
+		return 0;
+	/* a NULL buffer only counts the bytes written */
+	if (mem_state_data) {
+		if (mode==STREAD)
+			memcpy(data, mem_state_data + mem_state_pos, size);
+		else
+			memcpy(mem_state_data + mem_state_pos, data, size);
+	}
+	mem_state_pos += size;
+	return size;
+}
+
 int mkstate_data(gzFile gzf,void *data,int size,int mode) {
+	if (!gzf)
+		return mkstate_mem_data(data,size,mode);
 	if (mode==STREAD)
 		return gzread(gzf,data,size);
 	return gzwrite(gzf,data,size);
@@ -580,8 +602,7 @@ int save_state(char *game,int slot) {
 	return save_stateWithName(st_name);
 }
 
-int load_stateWithName(char *name) {
-	gzFile gzf;
+static void neogeo_load_mkstate(gzFile gzf) {
 	/* Save pointers */
 	Uint8 *ng_lo = memory.ng_lo;
 	Uint8 *fix_game_usage=memory.fix_game_usage;
@@ -589,11 +610,6 @@ int load_stateWithName(char *name) {
 	int *bksw_offset=memory.bksw_offset;
 //	GAME_ROMS r;
 //	memcpy(&r,&memory.rom,sizeof(GAME_ROMS));
-	
-	if ((gzf = open_state(name, STREAD))==NULL)
-		return false;
-
-	//gzread(gzf,state_img_tmp->pixels,304*224*2);
 
 	neogeo_mkstate(gzf,STREAD);
 
@@ -626,11 +642,75 @@ int load_stateWithName(char *name) {
 		current_fix = memory.rom.bios_sfix.p;
 		fix_usage = memory.fix_board_usage;
 	}
+}
+
+int load_stateWithName(char *name) {
+	gzFile gzf;
+
+	if ((gzf = open_state(name, STREAD))==NULL)
+		return false;
+
+	//gzread(gzf,state_img_tmp->pixels,304*224*2);
+
+	neogeo_load_mkstate(gzf);
 
 	gzclose(gzf);
 	return true;
 }
 
+static const char mem_state_sig[6] = {'G','N','G','S','T','3'};
+#define MEM_STATE_HEADER_SIZE (int)(sizeof(mem_state_sig) + sizeof(int))
+
+int save_stateSize(void) {
+	mem_state_data = NULL;
+	mem_state_size = INT_MAX;
+	mem_state_pos = 0;
+	neogeo_mkstate(NULL,STWRITE);
+	return MEM_STATE_HEADER_SIZE + mem_state_pos;
+}
+
+int save_stateToBuffer(Uint8 *buf,int size) {
+	int flags=m68k_flag | z80_flag | endian_flag;
+
+	if (size < MEM_STATE_HEADER_SIZE)
+		return 0;
+	memcpy(buf, mem_state_sig, sizeof(mem_state_sig));
+	memcpy(buf + sizeof(mem_state_sig), &flags, sizeof(int));
+
+	mem_state_data = buf + MEM_STATE_HEADER_SIZE;
+	mem_state_size = size - MEM_STATE_HEADER_SIZE;
+	mem_state_pos = 0;
+	neogeo_mkstate(NULL,STWRITE);
+	mem_state_data = NULL;
+	return MEM_STATE_HEADER_SIZE + mem_state_pos;
+}
+
+int load_stateFromBuffer(const Uint8 *buf,int size) {
+	int flags;
+
+	if (size != save_stateSize()) {
+		logMsg("state data has incorrect size %d", size);
+		return false;
+	}
+	if (memcmp(buf, mem_state_sig, sizeof(mem_state_sig))) {
+		logMsg("state data is not a valid gngeo state");
+		return false;
+	}
+	memcpy(&flags, buf + sizeof(mem_state_sig), sizeof(int));
+	if (flags != (m68k_flag | z80_flag | endian_flag)) {
+		logMsg("This save state comes from a different endian architecture.\n"
+				"This is not currently supported :(");
+		return false;
+	}
+
+	mem_state_data = (Uint8 *)buf + MEM_STATE_HEADER_SIZE;
+	mem_state_size = size - MEM_STATE_HEADER_SIZE;
+	mem_state_pos = 0;
+	neogeo_load_mkstate(NULL);
+	mem_state_data = NULL;
+	return true;
+}
+
 int load_state(char *game,int slot) {
 	char *st_name=(char*)alloca(strlen(getGngeoDir())+strlen(game)+5);
 	make_stateName(game,slot,st_name);
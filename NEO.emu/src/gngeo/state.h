@@ -94,6 +94,9 @@ int load_state(char *game,int slot);
 int save_state(char *game,int slot);
 int save_stateWithName(char *name);
 int load_stateWithName(char *name);
+int save_stateSize(void);
+int save_stateToBuffer(Uint8 *buf,int size);
+int load_stateFromBuffer(const Uint8 *buf,int size);
 Uint32 how_many_slot(char *game);
 int mkstate_data(gzFile gzf,void *data,int size,int mode);
 
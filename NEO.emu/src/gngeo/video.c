@@ -23,6 +23,13 @@
 #include <string.h>
 #include <stdlib.h>
 #include <zlib.h>
+#if defined(__unix__) || defined(__APPLE__)
+#define SPR_CACHE_MMAP
+#define SPR_CACHE_PREFETCH
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <pthread.h>
+#endif
 #include "video.h"
 #include "memory.h"
 #include "emu.h"
@@ -126,14 +133,320 @@ static Uint16 fix_addr[40][32];
 static Uint8 fix_shift[40];
 
 
+/* Sprite cache
+ *
+ * The sprite region of a .gno file is stored as zlib compressed banks, which
+ * are decompressed on demand into a fixed number of cache slots and evicted
+ * with the CLOCK algorithm. Once per frame sprite_cache_frame() walks the
+ * sprite list and hands the banks it references that aren't cached yet to a
+ * background thread, so by the time the frame gets drawn most of them are
+ * already decompressed and only need to be moved into a slot.
+ */
+
+#ifdef SPR_CACHE_PREFETCH
+#define PREFETCH_BANKS 256 /* power of 2 */
+
+enum { PF_FREE, PF_QUEUED, PF_BUSY, PF_READY };
+
+struct gfx_prefetch {
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t work; /* signaled when banks are queued or on exit */
+	pthread_cond_t done; /* signaled when a bank is decompressed */
+	int quit;
+	int cursor;          /* next entry the thread looks at */
+	Sint16 *pending;     /* entry handling each bank, -1 if none */
+	Uint8 *data;
+	int nb_free;
+	Sint16 free_entry[PREFETCH_BANKS];
+	struct {
+		int bank;
+		int state;
+		Uint8 *buf;      /* swapped with the slot buffer the bank goes into */
+	} entry[PREFETCH_BANKS];
+};
+#endif
+
+/* Decompress bank into dst, safe to call from the prefetch thread as long as
+ * the .gno file is mapped */
+static int read_bank(GFX_CACHE *gcache, int bank, Uint8 *dst) {
+	Uint32 cmp_size;
+	uLongf dst_size = gcache->slot_size;
+	const Uint8 *src;
+
+#ifdef SPR_CACHE_MMAP
+	if (gcache->map) {
+		size_t offset = gcache->offset[bank];
+		if (offset + sizeof (Uint32) > gcache->map_size)
+			return 1;
+		memcpy(&cmp_size, gcache->map + offset, sizeof (Uint32));
+		if (cmp_size > gcache->map_size - offset - sizeof (Uint32))
+			return 1;
+		src = gcache->map + offset + sizeof (Uint32);
+	} else
+#endif
+	{
+		fseek(gcache->gno, gcache->offset[bank], SEEK_SET);
+		if (fread(&cmp_size, sizeof (Uint32), 1, gcache->gno) != 1
+				|| cmp_size > compressBound(gcache->slot_size)
+				|| fread(gcache->in_buf, cmp_size, 1, gcache->gno) != 1)
+			return 1;
+		src = gcache->in_buf;
+	}
+	if (uncompress(dst, &dst_size, src, cmp_size) != Z_OK) {
+		logMsg("Can't decompress sprite bank %d\n", bank);
+		return 1;
+	}
+	return 0;
+}
+
+/* Free a slot, giving banks that were used since the last pass a second chance */
+static int evict_slot(GFX_CACHE *gcache) {
+	for (;;) {
+		int a = gcache->hand;
+		int bank = gcache->usage[a];
+
+		if (++gcache->hand >= gcache->max_slot) gcache->hand = 0;
+		if (bank == -1)
+			return a;
+		if (!gcache->ref[bank]) {
+			gcache->ptr[bank] = NULL;
+			gcache->usage[a] = -1;
+			return a;
+		}
+		gcache->ref[bank] = 0;
+	}
+}
+
+static Uint8 *set_slot(GFX_CACHE *gcache, int a, int bank) {
+	gcache->usage[a] = bank;
+	gcache->ref[bank] = 1;
+	gcache->ptr[bank] = gcache->slot[a];
+	return gcache->ptr[bank];
+}
+
+static void reset_slots(GFX_CACHE *gcache) {
+	int i;
+
+	memset(gcache->ptr, 0, gcache->total_bank * sizeof (Uint8*));
+	memset(gcache->ref, 0, gcache->total_bank);
+	for (i = 0; i < gcache->max_slot; i++)
+		gcache->usage[i] = -1;
+	gcache->hand = 0;
+}
+
+#ifdef SPR_CACHE_MMAP
+static void map_gno(GFX_CACHE *gcache) {
+	struct stat st;
+	void *map;
+	int fd = fileno(gcache->gno);
+
+	if (fstat(fd, &st) != 0 || st.st_size <= 0)
+		return;
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	if (map == MAP_FAILED) {
+		logMsg("Can't map .gno file, reading sprites with stdio\n");
+		return;
+	}
+	gcache->map = map;
+	gcache->map_size = st.st_size;
+}
+#endif
+
+#ifdef SPR_CACHE_PREFETCH
+static void release_entry(struct gfx_prefetch *pf, int e) {
+	pf->pending[pf->entry[e].bank] = -1;
+	pf->entry[e].state = PF_FREE;
+	pf->free_entry[pf->nb_free++] = e;
+}
+
+/* Move a decompressed bank into the cache, called with the lock held */
+static Uint8 *install_prefetched(GFX_CACHE *gcache, int e) {
+	struct gfx_prefetch *pf = gcache->prefetch;
+	int bank = pf->entry[e].bank;
+	int a = evict_slot(gcache);
+	Uint8 *buf = gcache->slot[a];
+
+	gcache->slot[a] = pf->entry[e].buf;
+	pf->entry[e].buf = buf;
+	release_entry(pf, e);
+	gcache->stats.prefetch++;
+	return set_slot(gcache, a, bank);
+}
+
+/* Called with the lock held, waits for the thread to finish its current bank */
+static void reset_prefetch(GFX_CACHE *gcache) {
+	struct gfx_prefetch *pf = gcache->prefetch;
+	int i;
+
+	for (i = 0; i < PREFETCH_BANKS; i++) {
+		while (pf->entry[i].state == PF_BUSY)
+			pthread_cond_wait(&pf->done, &pf->lock);
+	}
+	memset(pf->pending, 0xff, gcache->total_bank * sizeof (Sint16));
+	pf->nb_free = 0;
+	for (i = PREFETCH_BANKS - 1; i >= 0; i--) {
+		pf->entry[i].state = PF_FREE;
+		pf->free_entry[pf->nb_free++] = i;
+	}
+}
+
+static void *prefetch_thread(void *arg) {
+	GFX_CACHE *gcache = arg;
+	struct gfx_prefetch *pf = gcache->prefetch;
+
+	pthread_mutex_lock(&pf->lock);
+	while (!pf->quit) {
+		int i, e = -1;
+
+		for (i = 0; i < PREFETCH_BANKS; i++) {
+			int n = (pf->cursor + i) & (PREFETCH_BANKS - 1);
+			if (pf->entry[n].state == PF_QUEUED) {
+				e = n;
+				break;
+			}
+		}
+		if (e == -1) {
+			pthread_cond_wait(&pf->work, &pf->lock);
+			continue;
+		}
+		pf->cursor = (e + 1) & (PREFETCH_BANKS - 1);
+		pf->entry[e].state = PF_BUSY;
+		pthread_mutex_unlock(&pf->lock);
+		read_bank(gcache, pf->entry[e].bank, pf->entry[e].buf);
+		pthread_mutex_lock(&pf->lock);
+		pf->entry[e].state = PF_READY;
+		pthread_cond_broadcast(&pf->done);
+	}
+	pthread_mutex_unlock(&pf->lock);
+	return NULL;
+}
+
+static void start_prefetch(GFX_CACHE *gcache) {
+	struct gfx_prefetch *pf;
+	int i;
+
+	/* Reading through gno isn't thread safe */
+	if (!gcache->map)
+		return;
+	pf = calloc(1, sizeof (struct gfx_prefetch));
+	if (pf == NULL)
+		return;
+	pf->pending = malloc(gcache->total_bank * sizeof (Sint16));
+	pf->data = malloc(PREFETCH_BANKS * gcache->slot_size);
+	if (pf->pending == NULL || pf->data == NULL) {
+		free(pf->pending);
+		free(pf->data);
+		free(pf);
+		return;
+	}
+	for (i = 0; i < PREFETCH_BANKS; i++)
+		pf->entry[i].buf = pf->data + i * gcache->slot_size;
+	pthread_mutex_init(&pf->lock, NULL);
+	pthread_cond_init(&pf->work, NULL);
+	pthread_cond_init(&pf->done, NULL);
+	gcache->prefetch = pf;
+	reset_prefetch(gcache);
+	if (pthread_create(&pf->thread, NULL, prefetch_thread, gcache) != 0) {
+		logMsg("Can't start sprite prefetch thread\n");
+		pthread_cond_destroy(&pf->done);
+		pthread_cond_destroy(&pf->work);
+		pthread_mutex_destroy(&pf->lock);
+		free(pf->pending);
+		free(pf->data);
+		free(pf);
+		gcache->prefetch = NULL;
+	}
+}
+
+static void stop_prefetch(GFX_CACHE *gcache) {
+	struct gfx_prefetch *pf = gcache->prefetch;
+
+	if (pf == NULL)
+		return;
+	pthread_mutex_lock(&pf->lock);
+	pf->quit = 1;
+	pthread_cond_signal(&pf->work);
+	pthread_mutex_unlock(&pf->lock);
+	pthread_join(pf->thread, NULL);
+	pthread_cond_destroy(&pf->done);
+	pthread_cond_destroy(&pf->work);
+	pthread_mutex_destroy(&pf->lock);
+	free(pf->pending);
+	free(pf->data);
+	free(pf);
+	gcache->prefetch = NULL;
+}
+
+/* Queue the banks used by the sprite list that aren't cached yet, and mark
+ * the cached ones as referenced so they survive until the frame is drawn.
+ * Called with the lock held. Zoom and auto animation are ignored, animated
+ * tiles never leave their bank and this only needs to be a good guess. */
+static int queue_sprite_banks(GFX_CACHE *gcache) {
+	struct gfx_prefetch *pf = gcache->prefetch;
+	Uint8 *vidram = memory.vid.ram;
+	int tiles_per_bank = gcache->slot_size >> 7;
+	int count, y, my = 0, sx = 0, queued = 0;
+
+	for (count = 0; count < 0x300; count += 2) {
+		unsigned int t1 = READ_WORD(&vidram[0x10400 + count]);
+		unsigned int t2 = READ_WORD(&vidram[0x10800 + count]);
+		int offs = count << 6;
+
+		if (t1 & 0x40) {
+			sx += 16;
+		} else {
+			sx = t2 >> 7;
+			my = t1 & 0x3f;
+			if (my > 0x20) my = 0x20;
+		}
+		if (sx >= 0x1F0) sx -= 0x200;
+		if (my == 0 || sx >= 320) continue;
+
+		for (y = 0; y < my; y++, offs += 4) {
+			unsigned int tileno = READ_WORD(&vidram[offs]);
+			unsigned int tileatr = READ_WORD(&vidram[offs + 2]);
+			unsigned int bank;
+			int e;
+
+			if (memory.nb_of_tiles > 0x10000 && tileatr & 0x10) tileno += 0x10000;
+			if (memory.nb_of_tiles > 0x20000 && tileatr & 0x20) tileno += 0x20000;
+			if (memory.nb_of_tiles > 0x40000 && tileatr & 0x40) tileno += 0x40000;
+			if (tileno > memory.nb_of_tiles) continue;
+
+			bank = tileno / tiles_per_bank;
+			if (bank >= gcache->total_bank) continue;
+			if (gcache->ptr[bank]) {
+				gcache->ref[bank] = 1;
+				continue;
+			}
+			if (pf->pending[bank] != -1) continue;
+			if (pf->nb_free == 0) return queued;
+
+			e = pf->free_entry[--pf->nb_free];
+			pf->entry[e].bank = bank;
+			pf->entry[e].state = PF_QUEUED;
+			pf->pending[bank] = e;
+			queued++;
+		}
+	}
+	return queued;
+}
+#endif
+
 int init_sprite_cache(Uint32 size, Uint32 bsize) {
 	GFX_CACHE *gcache = &memory.vid.spr_cache;
 	int i;
 
 	if (gcache->data != NULL) { /* We allready have a cache, just reset it */
-		memset(gcache->ptr, 0, gcache->total_bank * sizeof (Uint8*));
-		for (i = 0; i < gcache->max_slot; i++)
-			gcache->usage[i] = -1;
+#ifdef SPR_CACHE_PREFETCH
+		if (gcache->prefetch) {
+			pthread_mutex_lock(&gcache->prefetch->lock);
+			reset_prefetch(gcache);
+			pthread_mutex_unlock(&gcache->prefetch->lock);
+		}
+#endif
+		reset_slots(gcache);
 		return 0;
 	}
 
@@ -142,38 +455,64 @@ int init_sprite_cache(Uint32 size, Uint32 bsize) {
 	logMsg("gfx_size=%08x\n", memory.rom.tiles.size);
 	gcache->total_bank = memory.rom.tiles.size / gcache->slot_size;
 	gcache->ptr = malloc(gcache->total_bank * sizeof (Uint8*));
-	if (gcache->ptr == NULL)
+	gcache->ref = malloc(gcache->total_bank);
+	if (gcache->ptr == NULL || gcache->ref == NULL) {
+		free(gcache->ptr);
+		free(gcache->ref);
+		gcache->ptr = NULL;
+		gcache->ref = NULL;
 		return 1;
-	//gcache->z_pos=malloc(gcache->total_bank*sizeof(unz_file_pos ));
-	memset(gcache->ptr, 0, gcache->total_bank * sizeof (Uint8*));
+	}
 
 	gcache->size = size;
 	gcache->data = malloc(gcache->size);
 	if (gcache->data == NULL) {
 		free(gcache->ptr);
+		free(gcache->ref);
+		gcache->ptr = NULL;
+		gcache->ref = NULL;
 		return 1;
 	}
 	logMsg("INIT CACHE %p\n", gcache->data);
 
-	//gcache->max_slot=((float)gcache->size/0x4000000)*TOTAL_GFX_BANK;
-	//gcache->max_slot=((float)gcache->size/memory.rom.tiles.size)*gcache->total_bank;
 	gcache->max_slot = size / gcache->slot_size;
-	//gcache->slot_size=0x4000000/TOTAL_GFX_BANK;
 	logMsg("Allocating %08x for gfx cache (%d %d slot)\n", gcache->size, gcache->max_slot, gcache->slot_size);
-	gcache->usage = malloc(gcache->max_slot * sizeof (Uint32));
+	gcache->usage = malloc(gcache->max_slot * sizeof (int));
+	gcache->slot = malloc(gcache->max_slot * sizeof (Uint8*));
 	for (i = 0; i < gcache->max_slot; i++)
-		gcache->usage[i] = -1;
+		gcache->slot[i] = gcache->data + i * gcache->slot_size;
+	reset_slots(gcache);
+	memset(&gcache->stats, 0, sizeof (gcache->stats));
 	//printf("inbuf size= %d\n",compressBound(bsize));
 #ifdef WIZ
 	gcache->in_buf = malloc(bsize + 1024);
 #else
 	gcache->in_buf = malloc(compressBound(bsize));
 #endif
+#ifdef SPR_CACHE_MMAP
+	map_gno(gcache);
+#endif
+#ifdef SPR_CACHE_PREFETCH
+	start_prefetch(gcache);
+#endif
+	logMsg("Sprite banks read %s, %s prefetch thread\n",
+			gcache->map ? "from mapped file" : "with stdio",
+			gcache->prefetch ? "with" : "without");
 	return 0;
 }
 
 void free_sprite_cache(void) {
 	GFX_CACHE *gcache = &memory.vid.spr_cache;
+#ifdef SPR_CACHE_PREFETCH
+	stop_prefetch(gcache);
+#endif
+#ifdef SPR_CACHE_MMAP
+	if (gcache->map) {
+		munmap(gcache->map, gcache->map_size);
+		gcache->map = NULL;
+		gcache->map_size = 0;
+	}
+#endif
 	if (gcache->data) {
 		free(gcache->data);
 		gcache->data = NULL;
@@ -182,51 +521,98 @@ void free_sprite_cache(void) {
 		free(gcache->ptr);
 		gcache->ptr = NULL;
 	}
+	if (gcache->ref) {
+		free(gcache->ref);
+		gcache->ref = NULL;
+	}
 	if (gcache->usage) {
 		free(gcache->usage);
 		gcache->usage = NULL;
 	}
+	if (gcache->slot) {
+		free(gcache->slot);
+		gcache->slot = NULL;
+	}
 	if (gcache->in_buf) {
 		free(gcache->in_buf);
 		gcache->in_buf = NULL;
 	}
 }
 
-Uint8 *get_cached_sprite_ptr(Uint32 tileno) {
+/* Called at the start of each drawn frame while the sprite cache is used */
+void sprite_cache_frame(void) {
 	GFX_CACHE *gcache = &memory.vid.spr_cache;
-	static int pos = 0;
-	static int init = 1;
-	int tile_sh = ~((gcache->slot_size >> 7) - 1);
+#ifdef SPR_CACHE_STATS
+	static int frames = 0;
+#endif
+
+#ifdef SPR_CACHE_PREFETCH
+	if (gcache->prefetch) {
+		struct gfx_prefetch *pf = gcache->prefetch;
+		int i;
+
+		pthread_mutex_lock(&pf->lock);
+		/* Banks left over from the last frame go in first, since the sprite
+		 * list scan marks banks it finds in the cache as referenced */
+		for (i = 0; i < PREFETCH_BANKS; i++) {
+			if (pf->entry[i].state == PF_READY)
+				install_prefetched(gcache, i);
+		}
+		if (queue_sprite_banks(gcache))
+			pthread_cond_signal(&pf->work);
+		pthread_mutex_unlock(&pf->lock);
+	}
+#endif
+#ifdef SPR_CACHE_STATS
+	if (++frames == 600) {
+		logMsg("sprite cache: %u hits, %u misses, %u prefetched, %u stalls\n",
+				gcache->stats.hit, gcache->stats.miss,
+				gcache->stats.prefetch, gcache->stats.stall);
+		memset(&gcache->stats, 0, sizeof (gcache->stats));
+		frames = 0;
+	}
+#endif
+}
 
-	int bank = ((tileno & tile_sh) / (gcache->slot_size >> 7));
+Uint8 *get_cached_sprite_ptr(Uint32 tileno) {
+	GFX_CACHE *gcache = &memory.vid.spr_cache;
+	int bank = tileno / (gcache->slot_size >> 7);
 	int a;
-	int r;
-	Uint32 cmp_size;
-	uLongf dst_size;
 
 	if (gcache->ptr[bank]) {
 		/* The bank is present in the cache */
+		gcache->ref[bank] = 1;
+		gcache->stats.hit++;
 		return gcache->ptr[bank];
 	}
-	/* We have to find a slot for this bank */
-	a = pos;
-	pos++;
-	if (pos >= gcache->max_slot) pos = 0;
-	//printf("Offset for bank is %d\n",gcache->offset[bank]);
-
-	fseek(gcache->gno, gcache->offset[bank], SEEK_SET);
-	r = fread(&cmp_size, sizeof (Uint32), 1, gcache->gno);
-	r = fread(gcache->in_buf, cmp_size, 1, gcache->gno);
-	dst_size = gcache->slot_size;
-	r = uncompress(gcache->data + a * gcache->slot_size, &dst_size, gcache->in_buf, cmp_size);
-
-	gcache->ptr[bank] = gcache->data + a * gcache->slot_size;
-
-	if (gcache->usage[a] != -1) {
-		gcache->ptr[gcache->usage[a]] = 0;
+#ifdef SPR_CACHE_PREFETCH
+	/* pending is only written from this thread, no need to lock to test it */
+	if (gcache->prefetch && gcache->prefetch->pending[bank] != -1) {
+		struct gfx_prefetch *pf = gcache->prefetch;
+		int e = pf->pending[bank];
+
+		pthread_mutex_lock(&pf->lock);
+		if (pf->entry[e].state != PF_QUEUED) {
+			Uint8 *p;
+			if (pf->entry[e].state == PF_BUSY) {
+				gcache->stats.stall++;
+				while (pf->entry[e].state != PF_READY)
+					pthread_cond_wait(&pf->done, &pf->lock);
+			}
+			p = install_prefetched(gcache, e);
+			pthread_mutex_unlock(&pf->lock);
+			return p;
+		}
+		/* Not started yet, quicker to do it here than to wait for it */
+		release_entry(pf, e);
+		pthread_mutex_unlock(&pf->lock);
 	}
-	gcache->usage[a] = bank;
-	return gcache->ptr[bank];
+#endif
+	/* We have to find a slot for this bank */
+	a = evict_slot(gcache);
+	read_bank(gcache, bank, gcache->slot[a]);
+	gcache->stats.miss++;
+	return set_slot(gcache, a, bank);
 }
 
 static void fix_value_init(void) {
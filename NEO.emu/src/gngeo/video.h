@@ -35,10 +35,22 @@ typedef struct gfx_cache {
 	Uint8 **ptr/*[TOTAL_GFX_BANK]*/; /* ptr[i] Contain a pointer to cached data for bank i */
 	int max_slot; /* Maximal numer of bank that can be cached (depend on cache size) */
 	int slot_size;
-	int *usage;   /* contain index to the banks in used order */
+	int *usage;   /* bank held by each slot, -1 if the slot is free */
+	Uint8 **slot; /* slot[i] points to the buffer currently holding slot i */
+	Uint8 *ref;   /* ref[i] set when bank i was used since the clock hand last passed it */
+	int hand;     /* clock hand, next slot considered for eviction */
 	FILE *gno;
     Uint32 *offset;
     Uint8* in_buf;
+	Uint8 *map;   /* The .gno file mapped in memory, banks are read from gno if NULL */
+	size_t map_size;
+	struct gfx_prefetch *prefetch; /* Background decompression, NULL if not running */
+	struct {
+		Uint32 hit;      /* bank already cached */
+		Uint32 miss;     /* bank decompressed by the render thread */
+		Uint32 prefetch; /* bank decompressed ahead of time by the prefetch thread */
+		Uint32 stall;    /* render thread waited for the prefetch thread */
+	} stats;
 }GFX_CACHE;
 
 typedef struct VIDEO {
@@ -81,5 +93,6 @@ void draw_screen(void);
 // void show_cache(void);
 int init_sprite_cache(Uint32 size,Uint32 bsize);
 void free_sprite_cache(void);
+void sprite_cache_frame(void);
 
 #endif
@@ -178,6 +178,7 @@ const bool EmuSystem::inputHasTriggerBtns = false;
 const bool EmuSystem::inputHasRevBtnLayout = false;
 const char *EmuSystem::configFilename = "NeoEmu.config";
 const uint EmuSystem::maxPlayers = 2;
+bool EmuSystem::gzipsStateFiles = true;
 const AspectRatioInfo EmuSystem::aspectRatioInfo[] =
 {
 		{"4:3 (Original)", 4, 3},
@@ -409,28 +410,22 @@ FS::PathString EmuSystem::sprintStateFilename(int slot, const char *statePath, c
 	return FS::makePathStringPrintf("%s/%s.0%c.sta", statePath, gameName, saveSlotChar(slot));
 }
 
-std::error_code EmuSystem::saveState()
+std::error_code EmuSystem::saveStateToBuffer(std::vector<uint8_t> &buff)
 {
-	auto saveStr = sprintStateFilename(saveStateSlot);
-	fixFilePermissions(saveStr);
-	if(!save_stateWithName(saveStr.data()))
+	buff.resize(save_stateSize());
+	int size = save_stateToBuffer(buff.data(), buff.size());
+	if(!size)
 		return {EIO, std::system_category()};
-	else
-		return {};
+	buff.resize(size);
+	return {};
 }
 
-std::system_error EmuSystem::loadState(int saveStateSlot)
+std::system_error EmuSystem::loadStateFromBuffer(const uint8_t *data, size_t size)
 {
-	auto saveStr = sprintStateFilename(saveStateSlot);
-	if(FS::exists(saveStr.data()))
-	{
-		logMsg("loading state %s", saveStr.data());
-		if(load_stateWithName(saveStr.data()))
-			return {{}};
-		else
-			return {{EIO, std::system_category()}};
-	}
-	return {{ENOENT, std::system_category()}};
+	if(load_stateFromBuffer(data, size))
+		return {{}};
+	else
+		return {{EIO, std::system_category()}};
 }
 
 void EmuSystem::saveBackupMem()
@@ -442,17 +437,6 @@ void EmuSystem::saveBackupMem()
 	}
 }
 
-void EmuSystem::saveAutoState()
-{
-	if(gameIsRunning() && optionAutoSaveState)
-	{
-		auto saveStr = sprintStateFilename(-1);
-		fixFilePermissions(saveStr);
-		if(!save_stateWithName(saveStr.data()))
-			logMsg("error saving state %s", saveStr.data());
-	}
-}
-
 void EmuSystem::closeSystem()
 {
 	close_game();
@@ -14,7 +14,6 @@ CPPFLAGS += -I$(projectPath)/src \
 -DPSS_STYLE=1 \
 -DLSB_FIRST \
 -DFRAMESKIP \
--DFCEU_NO_HQ_SOUND \
 -DUSE_PIX_RGB565 \
 -I$(projectPath)/src/fceu
 
@@ -13,12 +13,98 @@
 #include <cmath>
 #include <cstdio>
 
+#if defined(__SSE2__)
+#define FILTER_SIMD_SSE2
+#include <emmintrin.h>
+#ifdef __SSE4_1__
+#include <smmintrin.h>
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define FILTER_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
 static int32 sq2coeffs[SQ2NCOEFFS];
 static int32 coeffs[NCOEFFS];
+static_assert(SQ2NCOEFFS%4==0 && NCOEFFS%4==0, "FIRPair works on 4 taps at a time");
 
 static uint32 mrindex;
 static uint32 mrratio;
 
+/* The tap tables are symmetric, so the FIR can walk the input forwards
+   from the oldest sample instead of backwards. Returns the dot products
+   of D with the windows at S and S+1, each term scaled like the original
+   loop so the output is bit-exact. n must be a multiple of 4. */
+static void FIRPairScalar(const FCEU_SoundSample2 *S, const int32 *D, uint32 n, int32 *acc, int32 *acc2)
+{
+ int32 a=0,a2=0;
+ for(uint32 c=0;c<n;c++)
+ {
+  a+=(S[c]*D[c])>>6;
+  a2+=(S[c+1]*D[c])>>6;
+ }
+ *acc=a;
+ *acc2=a2;
+}
+
+#ifdef FILTER_SIMD_SSE2
+static inline __m128i FIRMul(__m128i a, __m128i b)
+{
+#ifdef __SSE4_1__
+ return _mm_mullo_epi32(a,b);
+#else
+ /* low halves of the unsigned products equal the signed ones */
+ __m128i even=_mm_mul_epu32(a,b);
+ __m128i odd=_mm_mul_epu32(_mm_srli_epi64(a,32),_mm_srli_epi64(b,32));
+ return _mm_unpacklo_epi32(_mm_shuffle_epi32(even,_MM_SHUFFLE(0,0,2,0)),
+  _mm_shuffle_epi32(odd,_MM_SHUFFLE(0,0,2,0)));
+#endif
+}
+
+static inline int32 FIRSum(__m128i v)
+{
+ v=_mm_add_epi32(v,_mm_shuffle_epi32(v,_MM_SHUFFLE(1,0,3,2)));
+ v=_mm_add_epi32(v,_mm_shuffle_epi32(v,_MM_SHUFFLE(2,3,0,1)));
+ return _mm_cvtsi128_si32(v);
+}
+
+static void FIRPair(const FCEU_SoundSample2 *S, const int32 *D, uint32 n, int32 *acc, int32 *acc2)
+{
+ __m128i a=_mm_setzero_si128(),a2=_mm_setzero_si128();
+ for(uint32 c=0;c<n;c+=4)
+ {
+  __m128i d=_mm_loadu_si128((const __m128i *)&D[c]);
+  __m128i s=_mm_loadu_si128((const __m128i *)&S[c]);
+  __m128i s2=_mm_loadu_si128((const __m128i *)&S[c+1]);
+  a=_mm_add_epi32(a,_mm_srai_epi32(FIRMul(s,d),6));
+  a2=_mm_add_epi32(a2,_mm_srai_epi32(FIRMul(s2,d),6));
+ }
+ *acc=FIRSum(a);
+ *acc2=FIRSum(a2);
+}
+#elif defined(FILTER_SIMD_NEON)
+static inline int32 FIRSum(int32x4_t v)
+{
+ int32x2_t h=vadd_s32(vget_low_s32(v),vget_high_s32(v));
+ return vget_lane_s32(vpadd_s32(h,h),0);
+}
+
+static void FIRPair(const FCEU_SoundSample2 *S, const int32 *D, uint32 n, int32 *acc, int32 *acc2)
+{
+ int32x4_t a=vdupq_n_s32(0),a2=vdupq_n_s32(0);
+ for(uint32 c=0;c<n;c+=4)
+ {
+  int32x4_t d=vld1q_s32(&D[c]);
+  a=vsraq_n_s32(a,vmulq_s32(vld1q_s32(&S[c]),d),6);
+  a2=vsraq_n_s32(a2,vmulq_s32(vld1q_s32(&S[c+1]),d),6);
+ }
+ *acc=FIRSum(a);
+ *acc2=FIRSum(a2);
+}
+#else
+#define FIRPair FIRPairScalar
+#endif
+
 void SexyFilter2(FCEU_SoundSample *in, int32 count)
 {
  #ifdef moo
@@ -109,58 +195,36 @@ int32 NeoFilterSound(FCEU_SoundSample2 *in, FCEU_SoundSample2 *out, uint32 inlen
 //	}
         max=(inlen-1)<<16;
 
-	if(FSettings.soundq==2)
-         for(x=mrindex;x<max;x+=mrratio)
-         {
-          int32 acc=0,acc2=0;
-          unsigned int c;
-          const FCEU_SoundSample2 *S;
-          const int32 *D;
-         
-          for(c=SQ2NCOEFFS,S=&in[(x>>16)-SQ2NCOEFFS],D=sq2coeffs;c;c--,D++)
-          {
-           acc+=(S[c]**D)>>6;
-           acc2+=(S[1+c]**D)>>6;
-          }
-
-          acc=((int64)acc*(65536-(x&65535))+(int64)acc2*(x&65535))>>(16+11);
-          *out=acc;
-          out++;   
-          count++; 
-         }
-	else
-         for(x=mrindex;x<max;x+=mrratio)
-         {
-          int32 acc=0,acc2=0;
-          unsigned int c;
-          const FCEU_SoundSample2 *S;
-          const int32 *D;
- 
-          for(c=NCOEFFS,S=&in[(x>>16)-NCOEFFS],D=coeffs;c;c--,D++)
- 	  {
- 	   acc+=(S[c]**D)>>6;
- 	   acc2+=(S[1+c]**D)>>6;
- 	  }
- 
-          acc=((int64)acc*(65536-(x&65535))+(int64)acc2*(x&65535))>>(16+11);  
-          *out=acc;
-          out++;
-          count++;
-         }
-
-        mrindex=x-max;
+	const int32 *D;
+	uint32 nco;
 
 	if(FSettings.soundq==2)
 	{
-         mrindex+=SQ2NCOEFFS*65536;
-         *leftover=SQ2NCOEFFS+1;
+	 D=sq2coeffs;
+	 nco=SQ2NCOEFFS;
 	}
 	else
 	{
-         mrindex+=NCOEFFS*65536;
-         *leftover=NCOEFFS+1;
+	 D=coeffs;
+	 nco=NCOEFFS;
 	}
 
+        for(x=mrindex;x<max;x+=mrratio)
+        {
+         int32 acc,acc2;
+
+         FIRPair(&in[(x>>16)-nco+1],D,nco,&acc,&acc2);
+
+         acc=((int64)acc*(65536-(x&65535))+(int64)acc2*(x&65535))>>(16+11);
+         *out=acc;
+         out++;
+         count++;
+        }
+
+        mrindex=x-max;
+        mrindex+=nco*65536;
+        *leftover=nco+1;
+
 	if(GameExpSound.NeoFill)
 	 GameExpSound.NeoFill(outsave,count);
 
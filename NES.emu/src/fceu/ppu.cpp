@@ -38,6 +38,7 @@
 #include  "debug.h"
 
 #include        <cstring>
+#include <imagine/pixmap/PixmapConvert.hh>
 #include        <cstdio>
 #include        <cstdlib>
 
@@ -1253,28 +1254,19 @@ static void DoLine(void) {
 		}
 		uint y =  scanline - 8;
 		assert(y*nesPixX < nesPixX*nesVisiblePixY);
-		NATIVE_PIX_TYPE *outLine = &nativePixBuff[(y*nesPixX)];
+		// select the palette block for the emphasis bits in place, then expand the line through nativeCol
+		uint32 palMask = 0x3f3f3f3f, palBlock = 0x80808080;
 		if((PPU[1] >> 5) == 0x7)
+			palBlock = 0xc0c0c0c0;
+		else if(PPU[1] & 0xE0)
 		{
-			//for(x=63;x>=0;x--)
-			for(x=0;x<=255;x++)
-			{
-				//*(uint32 *)&target[x<<2]=((*(uint32*)&target[x<<2])&0x3f3f3f3f)|0xc0c0c0c0;
-				outLine[x] = nativeCol[(target[x]&0x3f)|0xc0];
-			}
+			palMask = 0xffffffff;
+			palBlock = 0x40404040;
 		}
-		else if(PPU[1] & 0xE0)
-			for(x=0;x<=255;x++)
-			{
-				//*(uint32 *)&target[x<<2]=(*(uint32*)&target[x<<2])|0x40404040;
-				outLine[x] = nativeCol[(target[x])|0x40];
-			}
-		else
-			for(x=0;x<=255;x++)
-			{
-				//*(uint32 *)&target[x<<2]=((*(uint32*)&target[x<<2])&0x3f3f3f3f)|0x80808080;
-				outLine[x] = nativeCol[(target[x]&0x3f)|0x80];
-			}
+		for(x=63;x>=0;x--)
+			*(uint32 *)&target[x<<2]=((*(uint32*)&target[x<<2])&palMask)|palBlock;
+		IG::Pixmap outLine{{{(int)nesPixX, 1}, NATIVE_PIX_FMT}, &nativePixBuff[(y*nesPixX)]};
+		IG::convertPixmapWithPalette(outLine, {{{(int)nesPixX, 1}, IG::PIXEL_FMT_I8}, target}, nativeCol);
 	}
 
 	sphitx = 0x100;
@@ -49,8 +49,10 @@ static const uint nesPixX = 256, nesPixY = 240, nesVisiblePixY = 224;
 
 #ifdef USE_PIX_RGB565
 #define NATIVE_PIX_TYPE uint16
+#define NATIVE_PIX_FMT IG::PIXEL_FMT_RGB565
 #else
 #define NATIVE_PIX_TYPE uint32
+#define NATIVE_PIX_FMT IG::PIXEL_FMT_RGBA8888
 #endif
 
 extern NATIVE_PIX_TYPE nativeCol[256];
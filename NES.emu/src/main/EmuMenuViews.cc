@@ -64,6 +64,36 @@ public:
 	{}
 };
 
+class EmuAudioOptionView : public AudioOptionView
+{
+	TextMenuItem soundQualityItem[3]
+	{
+		{"Normal", [](){ setSoundQuality(0); }},
+		{"High", [](){ setSoundQuality(1); }},
+		{"Highest", [](){ setSoundQuality(2); }}
+	};
+
+	MultiChoiceMenuItem soundQuality
+	{
+		"Emulation Quality",
+		optionSoundQuality,
+		soundQualityItem
+	};
+
+	static void setSoundQuality(uint quality)
+	{
+		optionSoundQuality = quality;
+		FCEUI_SetSoundQuality(quality);
+	}
+
+public:
+	EmuAudioOptionView(Base::Window &win): AudioOptionView{win, true}
+	{
+		loadStockItems();
+		item.emplace_back(&soundQuality);
+	}
+};
+
 class EmuVideoOptionView : public VideoOptionView
 {
 	TextMenuItem videoSystemItem[3]
@@ -292,7 +322,7 @@ View *EmuSystem::makeView(Base::Window &win, ViewID id)
 	{
 		case ViewID::MAIN_MENU: return new EmuMenuView(win);
 		case ViewID::VIDEO_OPTIONS: return new EmuVideoOptionView(win);
-		case ViewID::AUDIO_OPTIONS: return new AudioOptionView(win);
+		case ViewID::AUDIO_OPTIONS: return new EmuAudioOptionView(win);
 		case ViewID::INPUT_OPTIONS: return new EmuInputOptionView(win);
 		case ViewID::SYSTEM_OPTIONS: return new EmuSystemOptionView(win);
 		case ViewID::GUI_OPTIONS: return new GUIOptionView(win);
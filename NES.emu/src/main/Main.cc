@@ -25,11 +25,13 @@ uint fceuCheats = 0;
 
 #include <fceu/driver.h>
 #include <fceu/state.h>
+#include <fceu/emufile.h>
 #include <fceu/fceu.h>
 #include <fceu/ppu.h>
 #include <fceu/fds.h>
 #include <fceu/input.h>
 #include <fceu/cheat.h>
+#include <zlib.h>
 
 bool hasFDSBIOSExtension(const char *name)
 {
@@ -76,13 +78,14 @@ ESI nesInputPortDev[2]{SI_UNSET, SI_UNSET};
 
 enum {
 	CFGKEY_FDS_BIOS_PATH = 270, CFGKEY_FOUR_SCORE = 271,
-	CFGKEY_VIDEO_SYSTEM = 272,
+	CFGKEY_VIDEO_SYSTEM = 272, CFGKEY_SOUND_QUALITY = 273,
 };
 
 FS::PathString fdsBiosPath{};
 PathOption optionFdsBiosPath{CFGKEY_FDS_BIOS_PATH, fdsBiosPath, ""};
 Byte1Option optionFourScore{CFGKEY_FOUR_SCORE, 0};
 Byte1Option optionVideoSystem{CFGKEY_VIDEO_SYSTEM, 0};
+Byte1Option optionSoundQuality{CFGKEY_SOUND_QUALITY, 1, 0, optionIsValidWithMax<2>};
 uint autoDetectedVidSysPAL = 0;
 
 const char *EmuSystem::inputFaceBtnName = "A/B";
@@ -150,6 +153,7 @@ bool EmuSystem::readConfig(IO &io, uint key, uint readSize)
 		bcase CFGKEY_FOUR_SCORE: optionFourScore.readFromIO(io, readSize);
 		bcase CFGKEY_FDS_BIOS_PATH: optionFdsBiosPath.readFromIO(io, readSize);
 		bcase CFGKEY_VIDEO_SYSTEM: optionVideoSystem.readFromIO(io, readSize);
+		bcase CFGKEY_SOUND_QUALITY: optionSoundQuality.readFromIO(io, readSize);
 		logMsg("fds bios path %s", fdsBiosPath.data());
 	}
 	return 1;
@@ -159,6 +163,7 @@ void EmuSystem::writeConfig(IO &io)
 {
 	optionFourScore.writeWithKeyIfNotDefault(io);
 	optionVideoSystem.writeWithKeyIfNotDefault(io);
+	optionSoundQuality.writeWithKeyIfNotDefault(io);
 	optionFdsBiosPath.writeToIO(io);
 }
 
@@ -272,29 +277,23 @@ FS::PathString EmuSystem::sprintStateFilename(int slot, const char *statePath, c
 	return FS::makePathStringPrintf("%s/%s.fc%c", statePath, gameName, saveSlotChar(slot));
 }
 
-std::error_code EmuSystem::saveState()
+std::error_code EmuSystem::saveStateToBuffer(std::vector<uint8_t> &buff)
 {
-	auto saveStr = sprintStateFilename(saveStateSlot);
-	fixFilePermissions(saveStr);
-	if(!FCEUI_SaveState(saveStr.data()))
+	buff.clear();
+	EMUFILE_MEMORY ms{&buff};
+	if(!FCEUSS_SaveMS(&ms, Z_NO_COMPRESSION))
 		return {EIO, std::system_category()};
 	else
 		return {};
 }
 
-std::system_error EmuSystem::loadState(int saveStateSlot)
+std::system_error EmuSystem::loadStateFromBuffer(const uint8_t *data, size_t size)
 {
-	auto saveStr = sprintStateFilename(saveStateSlot);
-	if(FS::exists(saveStr))
-	{
-		logMsg("loading state %s", saveStr.data());
-		if(!FCEUI_LoadState(saveStr.data()))
-			return {{EIO, std::system_category()}};
-		else
-			return {{}};
-	}
+	EMUFILE_MEMORY ms{(void*)data, (s32)size};
+	if(!FCEUSS_LoadFP(&ms, SSLOADPARAM_NOBACKUP))
+		return {{EIO, std::system_category()}};
 	else
-		return {{ENOENT, std::system_category()}};
+		return {{}};
 }
 
 void EmuSystem::saveBackupMem() // for manually saving when not closing game
@@ -311,16 +310,6 @@ void EmuSystem::saveBackupMem() // for manually saving when not closing game
 	}
 }
 
-void EmuSystem::saveAutoState()
-{
-	if(gameIsRunning() && optionAutoSaveState)
-	{
-		auto saveStr = sprintStateFilename(-1);
-		fixFilePermissions(saveStr);
-		FCEUI_SaveState(saveStr.data());
-	}
-}
-
 void EmuSystem::closeSystem()
 {
 	FCEUI_CloseGame();
@@ -608,6 +597,6 @@ CallResult EmuSystem::onInit()
 	{
 		bug_exit("error in FCEUI_Initialize");
 	}
-	//FCEUI_SetSoundQuality(2);
+	FCEUI_SetSoundQuality(optionSoundQuality);
 	return OK;
 }
@@ -7,6 +7,7 @@ extern FS::PathString fdsBiosPath;
 extern PathOption optionFdsBiosPath;
 extern Byte1Option optionFourScore;
 extern Byte1Option optionVideoSystem;
+extern Byte1Option optionSoundQuality;
 extern ESI nesInputPortDev[2];
 extern uint autoDetectedVidSysPAL;
 
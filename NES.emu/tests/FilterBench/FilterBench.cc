@@ -0,0 +1,113 @@
+/*  This file is part of NES.emu.
+
+	NES.emu is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	NES.emu is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with NES.emu.  If not, see <http://www.gnu.org/licenses/> */
+
+// Times the FIR of NeoFilterSound() over one frame of random input for
+// every tap table MakeFilters() can pick: FIRPair() as built (SSE2, SSE4.1
+// or NEON), FIRPairScalar() and the original backwards loop, checking all
+// three give the same output samples.
+// Build & run from NES.emu (add -msse4.1 or a -march for the SSE4.1 multiply):
+// c++ -std=gnu++14 -O2 -w -DPSS_STYLE=1 -DLSB_FIRST -Isrc -Isrc/fceu -I../imagine/include \
+//  -I../imagine/include/imagine/override -DIMAGINE_CONFIG_H=cstddef tests/FilterBench/FilterBench.cc \
+//  -o FilterBench && ./FilterBench
+
+// FIRPair() and the tap tables are private to the filter
+#include "filter.cpp"
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+FCEUS FSettings;
+EXPSOUND GameExpSound;
+uint8 PAL;
+
+static const int frames = 60;
+
+// NeoFilterSound()'s loop before FIRPair()
+static void FIROriginal(const FCEU_SoundSample2 *in, const int32 *coeffs, uint32 nco, uint32 x, int32 *acc, int32 *acc2)
+{
+	int32 a = 0, a2 = 0;
+	const FCEU_SoundSample2 *S = &in[(x>>16)-nco];
+	const int32 *D = coeffs;
+	for(uint32 c = nco; c; c--, D++)
+	{
+		a += (S[c] * *D) >> 6;
+		a2 += (S[1+c] * *D) >> 6;
+	}
+	*acc = a;
+	*acc2 = a2;
+}
+
+template<class Func>
+static double timeFrames(Func &&filterFrame)
+{
+	auto start = std::chrono::steady_clock::now();
+	for(int i = 0; i < frames; i++)
+		filterFrame();
+	std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+	return elapsed.count() / frames;
+}
+
+int main()
+{
+	static const int32 rates[] = { 44100, 48000, 96000 };
+	std::mt19937 rng(1);
+	int failed = 0;
+	for(int soundq = 1; soundq <= 2; soundq++)
+	{
+		for(int pal = 0; pal < 2; pal++)
+		{
+			for(int32 rate : rates)
+			{
+				FSettings.soundq = soundq;
+				PAL = pal;
+				MakeFilters(rate);
+				const int32 *D = soundq == 2 ? sq2coeffs : coeffs;
+				const uint32 nco = soundq == 2 ? SQ2NCOEFFS : NCOEFFS;
+				// one frame of CPU-rate samples after the leftover taps
+				const uint32 inlen = nco + 1 + (pal ? 33248 : 29781);
+				std::vector<FCEU_SoundSample2> in(inlen + 4);
+				for(auto &s : in)
+					s = rng() % 32768;
+				const uint32 start = mrindex, max = (inlen - 1) << 16;
+				std::vector<int32> out[3];
+				auto filterFrame = [&](int method, std::vector<int32> &out)
+				{
+					out.clear();
+					for(uint32 x = start; x < max; x += mrratio)
+					{
+						int32 acc, acc2;
+						switch(method)
+						{
+							case 0: FIRPair(&in[(x>>16)-nco+1], D, nco, &acc, &acc2); break;
+							case 1: FIRPairScalar(&in[(x>>16)-nco+1], D, nco, &acc, &acc2); break;
+							default: FIROriginal(in.data(), D, nco, x, &acc, &acc2); break;
+						}
+						out.push_back(((int64)acc*(65536-(x&65535))+(int64)acc2*(x&65535))>>(16+11));
+					}
+				};
+				double us[3];
+				for(int method = 0; method < 3; method++)
+					us[method] = timeFrames([&](){ filterFrame(method, out[method]); });
+				bool match = out[0] == out[2] && out[1] == out[2];
+				if(!match)
+					failed = 1;
+				printf("%4u taps, %d Hz %s, %zu samples: FIRPair %.1f us/frame, scalar %.1f, original %.1f%s\n",
+					nco, rate, pal ? "PAL" : "NTSC", out[2].size(), us[0], us[1], us[2], match ? "" : ", MISMATCH");
+			}
+		}
+	}
+	return failed;
+}
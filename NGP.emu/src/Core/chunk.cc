@@ -23,62 +23,67 @@
 static uint8 read1(const uint8 *);
 static uint16 read2(const uint8 *);
 static uint32 read4(const uint8 *);
-static uint8 *read_chunk_data(FILE *, uint32);
 static void read_soundchip(SoundChip *, const uint8 **);
 static void read_REGS(const uint8 *);
 
 static void write1(uint8 *, uint8);
 static void write2(uint8 *, uint16);
 static void write4(uint8 *, uint32);
-static bool write_chunk(FILE *, uint32, const uint8 *, uint32);
+static bool write_chunk(std::vector<uint8> &, uint32, const uint8 *, uint32);
 static void write_soundchip(const SoundChip *, uint8 **);
-static bool write_FLSH(FILE *, const uint8 *, uint32);
-static bool write_RAM(FILE *);
-static bool write_REGS(FILE *);
-static bool write_ROM(FILE *);
-static bool write_ROMH(FILE *);
-static bool write_TIME(FILE *);
+static bool write_FLSH(std::vector<uint8> &, const uint8 *, uint32);
+static bool write_RAM(std::vector<uint8> &);
+static bool write_REGS(std::vector<uint8> &);
+static bool write_ROM(std::vector<uint8> &);
+static bool write_ROMH(std::vector<uint8> &);
+static bool write_TIME(std::vector<uint8> &);
 
 
-bool read_chunk(FILE *fp, uint32 *tagp, uint32 *sizep)
+bool read_chunk(const uint8 **pp, const uint8 *end, uint32 *tagp, uint32 *sizep)
 {
-	uint8 buf[SIZE_CHUNK];
+	const uint8 *buf = *pp;
 	
-	if (fread(buf, 1, SIZE_CHUNK, fp) != SIZE_CHUNK)
+	if (end - buf < SIZE_CHUNK)
 		return FALSE;
 	
 	*tagp = read4(buf);
 	*sizep = read4(buf+4);
+	*pp = buf + SIZE_CHUNK;
 	
 	return TRUE;
 }
 
-bool read_header(FILE *fp)
+bool read_header(const uint8 **pp, const uint8 *end)
 {
-	uint8 buf[HEADER_SIZE];
+	const uint8 *buf = *pp;
 
-	if (fread(buf, 1, HEADER_SIZE, fp) != HEADER_SIZE)
+	if (end - buf < HEADER_SIZE)
 		return FALSE;
 
 	if (memcmp(buf, HEADER, HEADER_SIZE) != 0)
 		return FALSE;
 
+	*pp = buf + HEADER_SIZE;
+
 	return TRUE;
 }
 
-bool read_SNAP(FILE *fp, uint32 size)
+bool read_SNAP(const uint8 *data, uint32 size)
 {
-	uint8 *data, *end, *p;
+	const uint8 *end, *p;
 	#define new new_SNAP
 	int got, new, subsize;
 	
-	if ((data=read_chunk_data(fp, size)) == NULL)
-		return FALSE;
-	
 	got = 0;
 	end = data+size;
 	for (p=data; p<end; p += subsize+SIZE_CHUNK) {
+		if (end - p < SIZE_CHUNK)
+			return FALSE;
 		subsize = read4(p+4);
+		if (subsize < 0 || subsize > end - p - SIZE_CHUNK) {
+			/* chunk overruns SNAP chunk */
+			return FALSE;
+		}
 		switch (read4(p)) {
 		case TAG_FLSH:
 			new = OPT_FLSH;
@@ -106,7 +111,6 @@ bool read_SNAP(FILE *fp, uint32 size)
 			if (memcmp(rom_header, p+SIZE_CHUNK,
 				   sizeof(RomHeader)) != 0) {
 				system_message(system_get_string(IDS_WRONGROM));
-				free(data);
 				return FALSE;
 			}
 			break;
@@ -122,7 +126,6 @@ bool read_SNAP(FILE *fp, uint32 size)
 		
 		if (new == -1 || (got & new)) {
 			/* illegal chunk or duplicate chunk */
-			free(data);
 			return FALSE;
 		}
 		got |= new;
@@ -130,14 +133,12 @@ bool read_SNAP(FILE *fp, uint32 size)
 	
 	if (p != end) {
 		/* chunk overruns SNAP chunk */
-		free(data);
 		return FALSE;
 	}
 	
 	if (((got & (OPT_REGS|OPT_RAM)) != (OPT_REGS|OPT_RAM))
 	    || (got & (OPT_ROM|OPT_ROMH)) == (OPT_ROM|OPT_ROMH)) {
 		/* missing chunks or ROM and ROMH */
-		free(data);
 		return FALSE;
 	}
 	
@@ -172,26 +173,24 @@ bool read_SNAP(FILE *fp, uint32 size)
 	}
 	
 	#undef new
-	free(data);
 	system_sound_chipreset(); // reset sound chip again or sample_chip_noise() can hang
 	return TRUE;
 }
 
 
-bool write_header(FILE *fp)
+bool write_header(std::vector<uint8> &out)
 {
-	if (fwrite(HEADER, 1, HEADER_SIZE, fp) != HEADER_SIZE)
-		return FALSE;
+	out.insert(out.end(), (const uint8*)HEADER, (const uint8*)HEADER + HEADER_SIZE);
 
 	return TRUE;
 }
 
-bool write_EOD(FILE *fp)
+bool write_EOD(std::vector<uint8> &out)
 {
-	return write_chunk(fp, TAG_EOD, NULL, SIZE_EOD);
+	return write_chunk(out, TAG_EOD, NULL, SIZE_EOD);
 }
 
-bool write_SNAP(FILE *fp, int options)
+bool write_SNAP(std::vector<uint8> &out, int options)
 {
 	uint32 size;
 	int flash_size;
@@ -216,21 +215,22 @@ bool write_SNAP(FILE *fp, int options)
 	if (options & OPT_FLSH)
 		size += flash_size + SIZE_CHUNK;
 
-	ret = write_chunk(fp, TAG_SNAP, NULL, size);
+	out.reserve(out.size() + SIZE_CHUNK + size);
+	ret = write_chunk(out, TAG_SNAP, NULL, size);
 
 	if (options & OPT_TIME)
-		ret &= write_TIME(fp);
+		ret &= write_TIME(out);
 	if (options & OPT_ROM)
-		ret &= write_ROM(fp);
+		ret &= write_ROM(out);
 	if (options & OPT_ROMH)
-		ret &= write_ROMH(fp);
+		ret &= write_ROMH(out);
 	if (options & OPT_FLSH) {
-		ret &= write_FLSH(fp, flash, flash_size);
+		ret &= write_FLSH(out, flash, flash_size);
 		free(flash);
 	}
 
-	ret &= write_RAM(fp);
-	ret &= write_REGS(fp);
+	ret &= write_RAM(out);
+	ret &= write_REGS(out);
 
 	return ret;
 }
@@ -251,21 +251,6 @@ static uint32 read4(const uint8 *d)
 	return (d[0]<<24)|(d[1]<<16)|(d[2]<<8)|d[3];
 }
 
-static uint8 *read_chunk_data(FILE *fp, uint32 size)
-{
-	uint8 *data;
-
-	if ((data=(uint8*)malloc(size)) == NULL)
-		return NULL;
-
-	if (fread(data, 1, size, fp) != size) {
-		free(data);
-		return NULL;
-	}
-
-	return data;
-}
-
 static void read_soundchip(SoundChip *chip, const uint8 **pp)
 {
 	const uint8 *p;
@@ -365,21 +350,20 @@ static void write4(uint8 *p, uint32 val)
 	p[3] = val & 0xff;
 }
 
-static bool write_chunk(FILE *fp, uint32 name, const uint8 *data, uint32 size)
+static bool write_chunk(std::vector<uint8> &out, uint32 name, const uint8 *data, uint32 size)
 {
 	uint8 buf[SIZE_CHUNK], *p;
-	int ret;
 
 	p = buf;
 	write4(p, name), p+=4;
 	write4(p, size);
 
-	ret = fwrite(buf, 1, SIZE_CHUNK, fp) == SIZE_CHUNK;
+	out.insert(out.end(), buf, buf + SIZE_CHUNK);
 
 	if (data && size > 0)
-	    ret &= fwrite(data, 1, size, fp) == size;
+	    out.insert(out.end(), data, data + size);
 
-	return ret;
+	return TRUE;
 }
 
 static void write_soundchip(const SoundChip *chip, uint8 **pp)
@@ -404,17 +388,17 @@ static void write_soundchip(const SoundChip *chip, uint8 **pp)
 	write4(p, chip->NoiseFB), p+=4;
 }
 
-static bool write_FLSH(FILE *fp, const uint8 *data, uint32 size)
+static bool write_FLSH(std::vector<uint8> &out, const uint8 *data, uint32 size)
 {
-	return write_chunk(fp, TAG_FLSH, data, size);
+	return write_chunk(out, TAG_FLSH, data, size);
 }
 
-static bool write_RAM(FILE *fp)
+static bool write_RAM(std::vector<uint8> &out)
 {
-	return write_chunk(fp, TAG_RAM, ram, SIZE_RAM);
+	return write_chunk(out, TAG_RAM, ram, SIZE_RAM);
 }
 
-static bool write_REGS(FILE *fp)
+static bool write_REGS(std::vector<uint8> &out)
 {
 	uint8 data[SIZE_REGS], *p;
 	int i, j;
@@ -471,23 +455,23 @@ static bool write_REGS(FILE *fp)
 	for (i=0; i<4; i++)
 		write1(p, dmaM[i]), p+=1;
 
-	return write_chunk(fp, TAG_REGS, data, SIZE_REGS);
+	return write_chunk(out, TAG_REGS, data, SIZE_REGS);
 }
 
-static bool write_ROM(FILE *fp)
+static bool write_ROM(std::vector<uint8> &out)
 {
-	return write_chunk(fp, TAG_ROM, rom.data, SIZE_ROM);
+	return write_chunk(out, TAG_ROM, rom.data, SIZE_ROM);
 }
 
-static bool write_ROMH(FILE *fp)
+static bool write_ROMH(std::vector<uint8> &out)
 {
-	return write_chunk(fp, TAG_ROMH, (uint8*)rom_header, SIZE_ROMH);
+	return write_chunk(out, TAG_ROMH, (uint8*)rom_header, SIZE_ROMH);
 }
 
-static bool write_TIME(FILE *fp)
+static bool write_TIME(std::vector<uint8> &out)
 {
 	uint8 data[SIZE_TIME];
 
 	write4(data, frame_count);
-	return write_chunk(fp, TAG_TIME, data, SIZE_TIME);
+	return write_chunk(out, TAG_TIME, data, SIZE_TIME);
 }
@@ -22,10 +22,10 @@
 #define OPT_RAM		0x0010
 #define OPT_REGS	0x0020
 
-bool read_chunk(FILE *, uint32 *, uint32 *);
-bool read_header(FILE *);
-bool read_SNAP(FILE *, uint32);
+bool read_chunk(const uint8 **, const uint8 *, uint32 *, uint32 *);
+bool read_header(const uint8 **, const uint8 *);
+bool read_SNAP(const uint8 *, uint32);
 
-bool write_header(FILE *);
-bool write_EOD(FILE *);
-bool write_SNAP(FILE *, int);
+bool write_header(std::vector<uint8> &);
+bool write_EOD(std::vector<uint8> &);
+bool write_SNAP(std::vector<uint8> &, int);
@@ -121,6 +121,7 @@
 #include <stdarg.h>
 #include <endian.h>
 #include <imagine/util/ansiTypes.h>
+#include <vector>
 
 //=============================================================================
 
@@ -343,8 +344,8 @@ RomHeader;
 // Core <--> System-IO Interface
 //-----------------------------------------------------------------------------
 
-	bool state_restore(const char* filename);
-	bool state_store(const char* filename);
+	bool state_restore(const uint8* data, uint32 size);
+	bool state_store(std::vector<uint8>& buffer);
 
 		//=========================================
 
@@ -386,12 +387,6 @@ RomHeader;
 	bool system_io_flash_write(uint8* buffer, uint32 bufferLength);
 
 
-/*! Reads from the file specified by 'filename' into the given preallocated
-	buffer. This is state data. */
-
-	bool system_io_state_read(const char* filename, uint8* buffer, uint32 bufferLength);
-	
-
 /*! Writes to the file specified by 'filename' from the given buffer.
 	This is state data. */
 
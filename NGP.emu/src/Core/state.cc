@@ -52,29 +52,30 @@
 
 //=============================================================================
 
-static bool read_state_0050(const char* filename);
-static bool read_state_0060(const char* filename);
+static bool read_state_0050(const uint8* data, uint32 size);
+static bool read_state_0060(const uint8* data, uint32 size);
 
 //-----------------------------------------------------------------------------
 // state_restore()
 //-----------------------------------------------------------------------------
-bool state_restore(const char* filename)
+bool state_restore(const uint8* data, uint32 size)
 {
 	uint16 version;
 
-	if (system_io_state_read(filename, (uint8*)&version, sizeof(uint16)))
+	if (size >= sizeof(uint16))
 	{
+		memcpy(&version, data, sizeof(uint16));
 		switch(version)
 		{
 		case 0x0050:
-			return read_state_0050(filename);
+			return read_state_0050(data, size);
 
 #ifdef MSB_FIRST
 		case 0x0060:
 #else
 		case 0x6000:
 #endif
-			return read_state_0060(filename);
+			return read_state_0060(data, size);
 		default:
 			system_message(system_get_string(IDS_BADSTATE));
 			return FALSE;
@@ -94,36 +95,32 @@ bool state_restore(const char* filename)
 //-----------------------------------------------------------------------------
 // state_store()
 //-----------------------------------------------------------------------------
-bool state_store(const char* filename)
+bool state_store(std::vector<uint8>& buffer)
 {
-	FILE *fp;
 	int ret, options;
 
 	/* XXX: user settable */
 	options = OPT_ROMH;
 	
-	if ((fp=fopen(filename, "wb")) == NULL)
-		return FALSE;
-	
-	ret = write_header(fp);
-	ret = write_SNAP(fp, options);
-	ret = write_EOD(fp);
-
-	if (fclose(fp) < 0)
-		ret = FALSE;
+	buffer.clear();
+	ret = write_header(buffer);
+	ret &= write_SNAP(buffer, options);
+	ret &= write_EOD(buffer);
 
 	return ret;
 }
 
 //=============================================================================
 
-static bool read_state_0050(const char* filename)
+static bool read_state_0050(const uint8* data, uint32 size)
 {
 	NEOPOPSTATE0050	state;
 	int i,j;
 
-	if (system_io_state_read(filename, (uint8*)&state, sizeof(NEOPOPSTATE0050)))
+	if (size >= sizeof(NEOPOPSTATE0050))
 	{
+		memcpy(&state, data, sizeof(NEOPOPSTATE0050));
+
 		//Verify correct rom...
 		if (memcmp(rom_header, &state.header, sizeof(RomHeader)) != 0)
 		{
@@ -186,30 +183,21 @@ static bool read_state_0050(const char* filename)
 	return FALSE;
 }
 
-static bool read_state_0060(const char* filename)
+static bool read_state_0060(const uint8* data, uint32 size)
 {
-	FILE *fp;
-	uint32 tag, size;
-	
-	if ((fp=fopen(filename, "rb")) == NULL)
-		return FALSE;
+	const uint8 *p = data, *end = data + size;
+	uint32 tag, chunkSize;
 
-	if (read_header(fp) != TRUE) {
-		fclose(fp);
+	if (read_header(&p, end) != TRUE)
 		return FALSE;
-	}
 
-	if (read_chunk(fp, &tag, &size) != TRUE) {
-	    fclose(fp);
-	    return FALSE;
-	}
+	if (read_chunk(&p, end, &tag, &chunkSize) != TRUE)
+		return FALSE;
 
-	if (tag != TAG_SNAP) {
-	    fclose(fp);
-	    return FALSE;
-	}
+	if (tag != TAG_SNAP || chunkSize > (uint32)(end - p))
+		return FALSE;
 
-	return read_SNAP(fp, size);
+	return read_SNAP(p, chunkSize);
 }
 
 //=============================================================================
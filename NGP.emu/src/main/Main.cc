@@ -167,35 +167,20 @@ FS::PathString EmuSystem::sprintStateFilename(int slot, const char *statePath, c
 	return FS::makePathStringPrintf("%s/%s.0%c.ngs", statePath, gameName, saveSlotChar(slot));
 }
 
-std::error_code EmuSystem::saveState()
+std::error_code EmuSystem::saveStateToBuffer(std::vector<uint8_t> &buff)
 {
-	auto saveStr = sprintStateFilename(saveStateSlot);
-	fixFilePermissions(saveStr);
-	if(!state_store(saveStr.data()))
+	if(!state_store(buff))
 		return {EIO, std::system_category()};
 	else
 		return {};
 }
 
-std::system_error EmuSystem::loadState(int saveStateSlot)
+std::system_error EmuSystem::loadStateFromBuffer(const uint8_t *data, size_t size)
 {
-	auto saveStr = sprintStateFilename(saveStateSlot);
-	if(FS::exists(saveStr))
-	{
-		logMsg("loading state %s", saveStr.data());
-		if(!state_restore(saveStr.data()))
-			return {{EIO, std::system_category()}};
-		else
-		{
-			return {{}};
-		}
-	}
-	return {{ENOENT, std::system_category()}};
-}
-
-bool system_io_state_read(const char* filename, uchar* buffer, uint32 bufferLength)
-{
-	return readFromFile(filename, buffer, bufferLength) > 0;
+	if(!state_restore(data, size))
+		return {{EIO, std::system_category()}};
+	else
+		return {{}};
 }
 
 static FS::PathString sprintSaveFilename()
@@ -225,17 +210,6 @@ void EmuSystem::saveBackupMem()
 	flash_commit();
 }
 
-void EmuSystem::saveAutoState()
-{
-	if(gameIsRunning() && optionAutoSaveState)
-	{
-		logMsg("saving auto-state");
-		auto saveStr = sprintStateFilename(-1);
-		fixFilePermissions(saveStr);
-		state_store(saveStr.data());
-	}
-}
-
 void EmuSystem::closeSystem()
 {
 	rom_unload();
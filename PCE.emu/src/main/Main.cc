@@ -55,6 +55,7 @@ const bool EmuSystem::inputHasTriggerBtns = false;
 const bool EmuSystem::inputHasRevBtnLayout = false;
 const char *EmuSystem::configFilename = "PceEmu.config";
 const uint EmuSystem::maxPlayers = 5;
+bool EmuSystem::gzipsStateFiles = true;
 const AspectRatioInfo EmuSystem::aspectRatioInfo[] =
 {
 		{"4:3 (Original)", 4, 3},
@@ -158,17 +159,6 @@ static MDFN_Surface mSurface{pixBuff, vidBufferX, vidBufferY, vidBufferX, mPixFm
 static uint16 inputBuff[5] {0}; // 5 gamepad buffers
 static bool usingMultires = false;
 
-void EmuSystem::saveAutoState()
-{
-	if(gameIsRunning() && optionAutoSaveState)
-	{
-		std::string statePath = MDFN_MakeFName(MDFNMKF_STATE, 0, "ncq");
-		logMsg("saving autosave-state %s", statePath.c_str());
-		fixFilePermissions(statePath.c_str());
-		MDFNI_SaveState(statePath.c_str(), 0, 0, 0, 0);
-	}
-}
-
 void EmuSystem::saveBackupMem() // for manually saving when not closing game
 {
 	if(gameIsRunning())
@@ -559,33 +549,34 @@ void EmuSystem::reset(ResetMode mode)
 	PCE_Fast::PCE_Power();
 }
 
-std::error_code EmuSystem::saveState()
+std::error_code EmuSystem::saveStateToBuffer(std::vector<uint8_t> &buff)
 {
-	char ext[] = { "nc0" };
-	ext[2] = saveSlotChar(saveStateSlot);
-	std::string statePath = MDFN_MakeFName(MDFNMKF_STATE, 0, ext);
-	logMsg("saving state %s", statePath.c_str());
-	fixFilePermissions(statePath.c_str());
-	if(!MDFNI_SaveState(statePath.c_str(), 0, 0, 0, 0))
+	if(!MDFNGameInfo->StateAction)
 		return {EIO, std::system_category()};
-	else
-		return {};
+	StateMem st;
+	memset(&st, 0, sizeof(StateMem));
+	if(!MDFNSS_SaveSM(&st, 0, 0))
+	{
+		free(st.data);
+		return {EIO, std::system_category()};
+	}
+	buff.assign(st.data, st.data + st.len);
+	free(st.data);
+	return {};
 }
 
-std::system_error EmuSystem::loadState(int saveStateSlot)
+std::system_error EmuSystem::loadStateFromBuffer(const uint8_t *data, size_t size)
 {
-	char ext[] = { "nc0" };
-	ext[2] = saveSlotChar(saveStateSlot);
-	std::string statePath = MDFN_MakeFName(MDFNMKF_STATE, 0, ext);
-	if(FS::exists(statePath.c_str()))
-	{
-		logMsg("loading state %s", statePath.c_str());
-		if(!MDFNI_LoadState(statePath.c_str(), 0))
-			return {{EIO, std::system_category()}};
-		else
-			return {{}};
-	}
-	return {{ENOENT, std::system_category()}};
+	if(!MDFNGameInfo->StateAction)
+		return {{EIO, std::system_category()}};
+	StateMem st;
+	memset(&st, 0, sizeof(StateMem));
+	st.data = (uint8*)data;
+	st.len = size;
+	if(!MDFNSS_LoadSM(&st, 1, 0))
+		return {{EIO, std::system_category()}};
+	else
+		return {{}};
 }
 
 void EmuSystem::savePathChanged() { }
@@ -40,9 +40,17 @@ ifeq ($(ARCH), arm)
   yabause/sh2_dynarec/sh2_dynarec.c
  endif
 else ifeq ($(ARCH), x86_64)
- # TODO: x86_64 dynarec has 64/32-bit pointer conversion issues
- #CPPFLAGS += -DCPU_X64=1 -DUSE_DYNAREC=1 -DSH2_DYNAREC=1
- #SRC += yabause/sh2_dynarec/linkage_x64.s yabause/sh2_dynarec/sh2_dynarec.c
+ ifeq ($(ENV), linux)
+  # the x86_64 dynarec embeds host addresses as 32-bit immediates, so the
+  # executable must be non-PIE and SH2 memory/contexts are mapped below 2GB
+  CPPFLAGS += -DCPU_X64=1 \
+  -DUSE_DYNAREC=1 \
+  -DSH2_DYNAREC=1
+  CFLAGS_CODEGEN += -fno-pie
+  LDFLAGS += -no-pie
+  SRC += yabause/sh2_dynarec/linkage_x64.s \
+  yabause/sh2_dynarec/sh2_dynarec.c
+ endif
 else ifeq ($(ARCH), x86)
  CPPFLAGS += -DCPU_X86=1 \
  -DUSE_DYNAREC=1 \
@@ -85,13 +93,29 @@ yabause/yabause.c \
 yabause/scsp.c \
 yabause/japmodem.c
 
+# threaded SCSP, selectable at runtime through yabsys.UseThreads
+SRC += yabause/scsp2.c
+CPPFLAGS += -DHAVE_SCSP2=1
+ifeq ($(ENV), ios)
+ SRC += yabause/thr-macosx.c
+else
+ SRC += yabause/thr-linux.c
+endif
+
 #SRC += yabause/c68k/c68kexec.c yabause/c68k/c68k.c yabause/m68kc68k.c
 #CPPFLAGS += -DHAVE_C68K=1
 SRC += yabause/q68/q68.c \
 yabause/q68/q68-core.c \
 yabause/m68kq68.c
 CPPFLAGS += -DHAVE_Q68=1
-# TODO: -DQ68_USE_JIT=1
+ifeq ($(ENV), linux)
+ # Q68 only has x86/x86_64 code generators, other CPUs use its interpreter
+ ifneq ($(filter x86 x86_64,$(ARCH)),)
+  CPPFLAGS += -DQ68_USE_JIT=1
+  SRC += yabause/q68/q68-jit.c \
+  yabause/q68/q68-jit-x86.S
+ endif
+endif
 
 include $(EMUFRAMEWORK_PATH)/package/emuframework.mk
 
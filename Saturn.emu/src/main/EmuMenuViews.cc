@@ -4,6 +4,51 @@
 
 static constexpr uint MAX_SH2_CORES = 4;
 
+class EmuVideoOptionView : public VideoOptionView
+{
+	BoolMenuItem vdp2Threads
+	{
+		"Threaded VDP2 Rendering",
+		(bool)optionVDP2Threads,
+		[this](BoolMenuItem &item, View &, Input::Event e)
+		{
+			optionVDP2Threads = item.flipBoolValue(*this);
+			applyVDP2ThreadsOption();
+		}
+	};
+
+public:
+	EmuVideoOptionView(Base::Window &win): VideoOptionView{win, true}
+	{
+		loadStockItems();
+		item.emplace_back(&vdp2Threads);
+	}
+};
+
+class EmuAudioOptionView : public AudioOptionView
+{
+	BoolMenuItem scspThread
+	{
+		"Threaded SCSP",
+		(bool)optionSCSPThread,
+		[this](BoolMenuItem &item, View &, Input::Event e)
+		{
+			// applied by YabauseInit() on the next game load
+			optionSCSPThread = item.flipBoolValue(*this);
+			yinit.usethreads = optionSCSPThread;
+		}
+	};
+
+public:
+	EmuAudioOptionView(Base::Window &win): AudioOptionView{win, true}
+	{
+		loadStockItems();
+		#ifdef HAVE_SCSP2
+		item.emplace_back(&scspThread);
+		#endif
+	}
+};
+
 class EmuSystemOptionView : public SystemOptionView
 {
 	char biosPathStr[256]{};
@@ -76,8 +121,8 @@ View *EmuSystem::makeView(Base::Window &win, ViewID id)
 	switch(id)
 	{
 		case ViewID::MAIN_MENU: return new MenuView(win);
-		case ViewID::VIDEO_OPTIONS: return new VideoOptionView(win);
-		case ViewID::AUDIO_OPTIONS: return new AudioOptionView(win);
+		case ViewID::VIDEO_OPTIONS: return new EmuVideoOptionView(win);
+		case ViewID::AUDIO_OPTIONS: return new EmuAudioOptionView(win);
 		case ViewID::SYSTEM_OPTIONS: return new EmuSystemOptionView(win);
 		case ViewID::GUI_OPTIONS: return new GUIOptionView(win);
 		default: return nullptr;
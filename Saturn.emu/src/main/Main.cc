@@ -1,5 +1,7 @@
 
 #define LOGTAG "main"
+#include <thread>
+#include <atomic>
 #include <emuframework/EmuApp.hh>
 #include <emuframework/EmuInput.hh>
 #include <emuframework/EmuAppInlines.hh>
@@ -70,10 +72,14 @@ static void mergeSamplesToStereo(s32 srcL, s32 srcR, s16 *dst)
 	else *dst = srcR;
 }
 
-static void SNDImagineUpdateAudioNull(u32 *leftchanbuffer, u32 *rightchanbuffer, u32 frames) { }
+// Set per frame by runFrame(). With the threaded SCSP, UpdateAudio is called
+// from the SCSP thread, so the callback stays fixed and checks this flag instead.
+static std::atomic_bool renderAudioFrame{true};
 
 static void SNDImagineUpdateAudio(u32 *leftchanbuffer, u32 *rightchanbuffer, u32 frames)
 {
+	if(!renderAudioFrame.load(std::memory_order_relaxed))
+		return;
 	//logMsg("got %d audio frames to write", frames);
 	s16 sample[frames*2];
 	iterateTimes(frames, i)
@@ -201,7 +207,8 @@ enum
 };
 
 enum {
-	CFGKEY_BIOS_PATH = 279, CFGKEY_SH2_CORE = 280
+	CFGKEY_BIOS_PATH = 279, CFGKEY_SH2_CORE = 280,
+	CFGKEY_SCSP_THREAD = 281, CFGKEY_VDP2_THREADS = 282
 };
 
 static bool OptionSH2CoreIsValid(uint8 val)
@@ -221,6 +228,8 @@ static bool OptionSH2CoreIsValid(uint8 val)
 FS::PathString biosPath{};
 static PathOption optionBiosPath{CFGKEY_BIOS_PATH, biosPath, ""};
 Byte1Option optionSH2Core{CFGKEY_SH2_CORE, defaultSH2CoreID, false, OptionSH2CoreIsValid};
+Byte1Option optionSCSPThread{CFGKEY_SCSP_THREAD, 0};
+Byte1Option optionVDP2Threads{CFGKEY_VDP2_THREADS, 0};
 
 yabauseinit_struct yinit
 {
@@ -289,6 +298,21 @@ void EmuSystem::initOptions()
 void EmuSystem::onOptionsLoaded()
 {
 	yinit.sh2coretype = optionSH2Core;
+	yinit.usethreads = optionSCSPThread;
+	applyVDP2ThreadsOption();
+}
+
+void applyVDP2ThreadsOption()
+{
+	// leave one core for the emulation thread, which also draws a layer
+	uint threads = 0;
+	if(optionVDP2Threads)
+	{
+		uint cores = std::thread::hardware_concurrency();
+		threads = cores > 1 ? std::min(cores - 1, 4u) : 0;
+	}
+	logMsg("using %u VDP2 layer threads", threads);
+	VIDSoftSetLayerThreads(threads);
 }
 
 bool EmuSystem::readConfig(IO &io, uint key, uint readSize)
@@ -298,6 +322,8 @@ bool EmuSystem::readConfig(IO &io, uint key, uint readSize)
 		default: return 0;
 		bcase CFGKEY_BIOS_PATH: optionBiosPath.readFromIO(io, readSize);
 		bcase CFGKEY_SH2_CORE: optionSH2Core.readFromIO(io, readSize);
+		bcase CFGKEY_SCSP_THREAD: optionSCSPThread.readFromIO(io, readSize);
+		bcase CFGKEY_VDP2_THREADS: optionVDP2Threads.readFromIO(io, readSize);
 	}
 	return 1;
 }
@@ -306,6 +332,8 @@ void EmuSystem::writeConfig(IO &io)
 {
 	optionBiosPath.writeToIO(io);
 	optionSH2Core.writeWithKeyIfNotDefault(io);
+	optionSCSPThread.writeWithKeyIfNotDefault(io);
+	optionVDP2Threads.writeWithKeyIfNotDefault(io);
 }
 
 EmuSystem::NameFilterFunc EmuSystem::defaultFsFilter = hasCDExtension;
@@ -471,28 +499,23 @@ FS::PathString EmuSystem::sprintStateFilename(int slot, const char *statePath, c
 	return FS::makePathStringPrintf("%s/%s.0%c.yss", statePath, gameName, saveSlotChar(slot));
 }
 
-std::error_code EmuSystem::saveState()
+std::error_code EmuSystem::saveStateToBuffer(std::vector<uint8_t> &buff)
 {
-	auto saveStr = sprintStateFilename(saveStateSlot);
-	fixFilePermissions(saveStr);
-	if(YabSaveState(saveStr.data()) == 0)
-		return {};
-	else
+	void *data;
+	size_t size;
+	if(YabSaveStateBuffer(&data, &size) != 0)
 		return {EIO, std::system_category()};
+	buff.assign((uint8_t*)data, (uint8_t*)data + size);
+	free(data);
+	return {};
 }
 
-std::system_error EmuSystem::loadState(int saveStateSlot)
+std::system_error EmuSystem::loadStateFromBuffer(const uint8_t *data, size_t size)
 {
-	auto saveStr = sprintStateFilename(saveStateSlot);
-	if(FS::exists(saveStr))
-	{
-		logMsg("loading state %s", saveStr.data());
-		if(YabLoadState(saveStr.data()) == 0)
-			return {{}};
-		else
-			return {{EIO, std::system_category()}};
-	}
-	return {{ENOENT, std::system_category()}};
+	if(YabLoadStateBuffer(data, size) == 0)
+		return {{}};
+	else
+		return {{EIO, std::system_category()}};
 }
 
 void EmuSystem::saveBackupMem() // for manually saving when not closing game
@@ -504,17 +527,6 @@ void EmuSystem::saveBackupMem() // for manually saving when not closing game
 	}
 }
 
-void EmuSystem::saveAutoState()
-{
-	if(gameIsRunning() && optionAutoSaveState)
-	{
-		auto saveStr = sprintStateFilename(-1);
-		fixFilePermissions(saveStr);
-		if(YabSaveState(saveStr.data()) != 0)
-			logMsg("error saving state %s", saveStr.data());
-	}
-}
-
 static bool yabauseIsInit = 0;
 
 void EmuSystem::closeSystem()
@@ -579,7 +591,7 @@ void EmuSystem::runFrame(bool renderGfx, bool processGfx, bool renderAudio)
 {
 	if(renderGfx)
 		renderToScreen = 1;
-	SNDImagine.UpdateAudio = renderAudio ? SNDImagineUpdateAudio : SNDImagineUpdateAudioNull;
+	renderAudioFrame.store(renderAudio, std::memory_order_relaxed);
 	YabauseEmulate();
 }
 
@@ -9,9 +9,12 @@ extern "C"
 }
 
 extern Byte1Option optionSH2Core;
+extern Byte1Option optionSCSPThread;
+extern Byte1Option optionVDP2Threads;
 extern FS::PathString biosPath;
 extern SH2Interface_struct *SH2CoreList[];
 extern uint SH2Cores;
 extern yabauseinit_struct yinit;
 
 bool hasBIOSExtension(const char *name);
+void applyVDP2ThreadsOption();
@@ -34,6 +34,18 @@
 # define NEED_TRAMPOLINE
 #endif
 
+/**
+ * NEED_EXEC_ALLOC:  Defined when Q68 generates native code and the host
+ * does not allow executing memory returned by malloc(), so the virtual
+ * processor must be allocated from executable mappings instead.
+ */
+#if defined(Q68_USE_JIT) && !defined(PSP)
+# define NEED_EXEC_ALLOC
+# include <string.h>
+# include <sys/mman.h>
+# include <unistd.h>
+#endif
+
 /**
  * PROFILE_68K: Perform simple profiling of the 68000 emulation, reporting
  * the average time per 68000 clock cycle.  (Realtime execution would be
@@ -91,6 +103,12 @@ static void writeb_trampoline(uint32_t address, uint32_t data);
 static void writew_trampoline(uint32_t address, uint32_t data);
 #endif
 
+#ifdef NEED_EXEC_ALLOC
+static void *exec_malloc(size_t size);
+static void *exec_realloc(void *ptr, size_t size);
+static void exec_free(void *ptr);
+#endif
+
 /*-----------------------------------------------------------------------*/
 
 /* Module interface definition */
@@ -160,7 +178,12 @@ static M68K_WRITE *real_writeb, *real_writew;
  */
 static int m68kq68_init(void)
 {
-    if (!(state = q68_create())) {
+#ifdef NEED_EXEC_ALLOC
+    state = q68_create_ex(exec_malloc, exec_realloc, exec_free);
+#else
+    state = q68_create();
+#endif
+    if (!state) {
         return -1;
     }
     q68_set_irq(state, 0);
@@ -520,6 +543,83 @@ static void writew_trampoline(uint32_t address, uint32_t data) {
 
 #endif  // NEED_TRAMPOLINE
 
+/*-----------------------------------------------------------------------*/
+
+#ifdef NEED_EXEC_ALLOC
+
+/* Size of the header preceding each block, holding the mapping length
+ * (kept at 16 bytes so returned pointers stay suitably aligned) */
+#define EXEC_HEADER_SIZE  16
+
+/**
+ * exec_mapping_length:  Return the length of the mapping needed to hold
+ * a block of the given size plus its header.
+ *
+ * [Parameters]
+ *     size: Block size, in bytes
+ * [Return value]
+ *     Mapping length, in bytes (a multiple of the page size)
+ */
+static size_t exec_mapping_length(size_t size)
+{
+    const size_t page_mask = (size_t)sysconf(_SC_PAGESIZE) - 1;
+    return (size + EXEC_HEADER_SIZE + page_mask) & ~page_mask;
+}
+
+/**
+ * exec_malloc, exec_realloc, exec_free:  Memory allocation functions
+ * passed to q68_create_ex(), returning readable, writable and executable
+ * memory for the JIT's translated code.  Each block is a separate
+ * anonymous mapping, since translated blocks are few and large.
+ *
+ * [Parameters]
+ *      ptr: Block to reallocate or free (exec_realloc/exec_free only)
+ *     size: Requested block size, in bytes (exec_malloc/exec_realloc only)
+ * [Return value]
+ *     Allocated block, or NULL on failure (exec_malloc/exec_realloc only)
+ */
+
+static void *exec_malloc(size_t size)
+{
+    const size_t length = exec_mapping_length(size);
+    uint8_t *base = mmap(NULL, length, PROT_READ | PROT_WRITE | PROT_EXEC,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {
+        return NULL;
+    }
+    *(size_t *)base = length;
+    return base + EXEC_HEADER_SIZE;
+}
+
+static void *exec_realloc(void *ptr, size_t size)
+{
+    if (!ptr) {
+        return exec_malloc(size);
+    }
+    uint8_t *base = (uint8_t *)ptr - EXEC_HEADER_SIZE;
+    const size_t length = *(size_t *)base;
+    if (size + EXEC_HEADER_SIZE <= length) {
+        return ptr;  // Still fits (or is shrinking); keep the mapping
+    }
+    void *new_ptr = exec_malloc(size);
+    if (!new_ptr) {
+        return NULL;
+    }
+    memcpy(new_ptr, ptr, length - EXEC_HEADER_SIZE);
+    munmap(base, length);
+    return new_ptr;
+}
+
+static void exec_free(void *ptr)
+{
+    if (ptr) {
+        uint8_t *base = (uint8_t *)ptr - EXEC_HEADER_SIZE;
+        munmap(base, *(size_t *)base);
+    }
+}
+
+#endif  // NEED_EXEC_ALLOC
+
 /*************************************************************************/
 /*************************************************************************/
 
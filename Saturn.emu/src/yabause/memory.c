@@ -25,6 +25,9 @@
 #include <stdlib.h>
 #include <sys/stat.h>
 #include <ctype.h>
+#if defined(SH2_DYNAREC) && defined(__x86_64__)
+# include <sys/mman.h>
+#endif
 
 #include "memory.h"
 #include "coffelf.h"
@@ -78,7 +81,19 @@ u8 BupRamWritten;
 
 u8 * T1MemoryInit(u32 size)
 {
-#ifdef PSP  // FIXME: could be ported to all arches, but requires stdint.h
+#if defined(SH2_DYNAREC) && defined(__x86_64__)
+   // The x86-64 dynarec emits host addresses of emulated memory and the SH2
+   // contexts as 32-bit values, so keep them in the low 2GB of the address
+   // space. The mapping size is saved in the first 64 bytes for T1MemoryDeInit().
+   u8 * base = mmap(NULL, size + 64, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+
+   if (base == MAP_FAILED)
+      return NULL;
+
+   *(u32 *)base = size + 64;
+   return base + 64;
+#elif defined(PSP)  // FIXME: could be ported to all arches, but requires stdint.h
             //        for uintptr_t
    u8 * base;
    u8 * mem;
@@ -100,7 +115,10 @@ u8 * T1MemoryInit(u32 size)
 
 void T1MemoryDeInit(u8 * mem)
 {
-#ifdef PSP
+#if defined(SH2_DYNAREC) && defined(__x86_64__)
+   if (mem)
+      munmap(mem - 64, *(u32 *)(mem - 64));
+#elif defined(PSP)
    if (mem)
       free(*(u8 **)(mem - sizeof(u8 *)));
 #else
@@ -994,8 +1012,32 @@ void FormatBackupRam(void *mem, u32 size)
 
 int YabSaveState(const char *filename)
 {
-   u32 i;
    FILE *fp;
+   int ret;
+
+   //use a second set of savestates for movies
+   filename = MakeMovieStateName(filename);
+   if (!filename)
+      return -1;
+
+   if ((fp = fopen(filename, "wb")) == NULL)
+      return -1;
+
+   ret = YabSaveStateStream(fp);
+
+   fclose(fp);
+
+   if (ret == 0)
+      OSDPushMessage(OSDMSG_STATUS, 150, "STATE SAVED");
+
+   return ret;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int YabSaveStateStream(FILE *fp)
+{
+   u32 i;
    int offset;
    IOCheck_struct check;
    u8 *buf;
@@ -1009,14 +1051,6 @@ int YabSaveState(const char *filename)
    check.done = 0;
    check.size = 0;
 
-   //use a second set of savestates for movies
-   filename = MakeMovieStateName(filename);
-   if (!filename)
-      return -1;
-
-   if ((fp = fopen(filename, "wb")) == NULL)
-      return -1;
-
    // Write signature
    fprintf(fp, "YSS");
 
@@ -1106,19 +1140,45 @@ int YabSaveState(const char *filename)
    ywrite(&check, (void *)&i, sizeof(i), 1, fp);
    fseek(fp, 16, SEEK_SET);
    ywrite(&check, (void *)&movieposition, sizeof(movieposition), 1, fp);
-
-   fclose(fp);
-
-   OSDPushMessage(OSDMSG_STATUS, 150, "STATE SAVED");
+   fseek(fp, 0, SEEK_END);
 
    return 0;
 }
 
 //////////////////////////////////////////////////////////////////////////////
 
+static int LoadStateStream(FILE *fp, const char *filename);
+
 int YabLoadState(const char *filename)
 {
    FILE *fp;
+   int ret;
+
+   filename = MakeMovieStateName(filename);
+   if (!filename)
+      return -1;
+
+   if ((fp = fopen(filename, "rb")) == NULL)
+      return -1;
+
+   ret = LoadStateStream(fp, filename);
+
+   fclose(fp);
+
+   return ret;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int YabLoadStateStream(FILE *fp)
+{
+   return LoadStateStream(fp, NULL);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static int LoadStateStream(FILE *fp, const char *filename)
+{
    char id[3];
    u8 endian;
    int headerversion, version, size, chunksize, headersize;
@@ -1133,13 +1193,6 @@ int YabLoadState(const char *filename)
    int temp;
    u32 temp32;
 
-   filename = MakeMovieStateName(filename);
-   if (!filename)
-      return -1;
-
-   if ((fp = fopen(filename, "rb")) == NULL)
-      return -1;
-
    headersize = 0xC;
 
    // Read signature
@@ -1147,7 +1200,6 @@ int YabLoadState(const char *filename)
 
    if (strncmp(id, "YSS", 3) != 0)
    {
-      fclose(fp);
       return -2;
    }
 
@@ -1170,7 +1222,6 @@ int YabLoadState(const char *filename)
       default:
          /* we're trying to open a save state using a future version
           * of the YSS format, that won't work, sorry :) */
-         fclose(fp);
          return -3;
          break;
    }
@@ -1183,7 +1234,6 @@ int YabLoadState(const char *filename)
    {
       // should setup reading so it's byte-swapped
       YabSetError(YAB_ERR_OTHER, (void *)"Load State byteswapping not supported");
-      fclose(fp);
       return -3;
    }
 
@@ -1192,7 +1242,6 @@ int YabLoadState(const char *filename)
 
    if (size != (ftell(fp) - headersize))
    {
-      fclose(fp);
       return -2;
    }
    fseek(fp, headersize, SEEK_SET);
@@ -1203,7 +1252,6 @@ int YabLoadState(const char *filename)
    
    if (StateCheckRetrieveHeader(fp, "CART", &version, &chunksize) != 0)
    {
-      fclose(fp);
       // Revert back to old state here
       ScspUnMuteAudio(SCSP_MUTE_SYSTEM);
       return -3;
@@ -1212,7 +1260,6 @@ int YabLoadState(const char *filename)
 
    if (StateCheckRetrieveHeader(fp, "CS2 ", &version, &chunksize) != 0)
    {
-      fclose(fp);
       // Revert back to old state here
       ScspUnMuteAudio(SCSP_MUTE_SYSTEM);
       return -3;
@@ -1221,7 +1268,6 @@ int YabLoadState(const char *filename)
 
    if (StateCheckRetrieveHeader(fp, "MSH2", &version, &chunksize) != 0)
    {
-      fclose(fp);
       // Revert back to old state here
       ScspUnMuteAudio(SCSP_MUTE_SYSTEM);
       return -3;
@@ -1230,7 +1276,6 @@ int YabLoadState(const char *filename)
 
    if (StateCheckRetrieveHeader(fp, "SSH2", &version, &chunksize) != 0)
    {
-      fclose(fp);
       // Revert back to old state here
       ScspUnMuteAudio(SCSP_MUTE_SYSTEM);
       return -3;
@@ -1239,7 +1284,6 @@ int YabLoadState(const char *filename)
 
    if (StateCheckRetrieveHeader(fp, "SCSP", &version, &chunksize) != 0)
    {
-      fclose(fp);
       // Revert back to old state here
       ScspUnMuteAudio(SCSP_MUTE_SYSTEM);
       return -3;
@@ -1248,7 +1292,6 @@ int YabLoadState(const char *filename)
 
    if (StateCheckRetrieveHeader(fp, "SCU ", &version, &chunksize) != 0)
    {
-      fclose(fp);
       // Revert back to old state here
       ScspUnMuteAudio(SCSP_MUTE_SYSTEM);
       return -3;
@@ -1257,7 +1300,6 @@ int YabLoadState(const char *filename)
 
    if (StateCheckRetrieveHeader(fp, "SMPC", &version, &chunksize) != 0)
    {
-      fclose(fp);
       // Revert back to old state here
       ScspUnMuteAudio(SCSP_MUTE_SYSTEM);
       return -3;
@@ -1266,7 +1308,6 @@ int YabLoadState(const char *filename)
 
    if (StateCheckRetrieveHeader(fp, "VDP1", &version, &chunksize) != 0)
    {
-      fclose(fp);
       // Revert back to old state here
       ScspUnMuteAudio(SCSP_MUTE_SYSTEM);
       return -3;
@@ -1275,7 +1316,6 @@ int YabLoadState(const char *filename)
 
    if (StateCheckRetrieveHeader(fp, "VDP2", &version, &chunksize) != 0)
    {
-      fclose(fp);
       // Revert back to old state here
       ScspUnMuteAudio(SCSP_MUTE_SYSTEM);
       return -3;
@@ -1284,7 +1324,6 @@ int YabLoadState(const char *filename)
 
    if (StateCheckRetrieveHeader(fp, "OTHR", &version, &chunksize) != 0)
    {
-      fclose(fp);
       // Revert back to old state here
       ScspUnMuteAudio(SCSP_MUTE_SYSTEM);
       return -3;
@@ -1337,11 +1376,12 @@ int YabLoadState(const char *filename)
    #endif
    YuiSwapBuffers();
 
-   fseek(fp, movieposition, SEEK_SET);
-   MovieReadState(fp, filename);
+   if (filename)
+   {
+      fseek(fp, movieposition, SEEK_SET);
+      MovieReadState(fp, filename);
+   }
    }
-   
-   fclose(fp);
 
    ScspUnMuteAudio(SCSP_MUTE_SYSTEM);
 
@@ -1352,6 +1392,141 @@ int YabLoadState(const char *filename)
 
 //////////////////////////////////////////////////////////////////////////////
 
+#ifndef __GLIBC__
+// funopen() based memory streams for platforms lacking open_memstream()/fmemopen()
+typedef struct
+{
+   u8 *data;
+   size_t size;
+   size_t capacity;
+   size_t pos;
+} MemStream;
+
+static int MemStreamRead(void *cookie, char *buf, int len)
+{
+   MemStream *s = (MemStream *)cookie;
+   size_t avail = s->pos < s->size ? s->size - s->pos : 0;
+
+   if ((size_t)len > avail)
+      len = avail;
+   memcpy(buf, s->data + s->pos, len);
+   s->pos += len;
+   return len;
+}
+
+static int MemStreamWrite(void *cookie, const char *buf, int len)
+{
+   MemStream *s = (MemStream *)cookie;
+
+   if (s->pos + len > s->capacity)
+   {
+      size_t newCapacity = s->capacity ? s->capacity : 0x100000;
+      u8 *newData;
+
+      while (newCapacity < s->pos + len)
+         newCapacity *= 2;
+      if ((newData = (u8 *)realloc(s->data, newCapacity)) == NULL)
+         return -1;
+      s->data = newData;
+      s->capacity = newCapacity;
+   }
+   if (s->pos > s->size)
+      memset(s->data + s->size, 0, s->pos - s->size);
+   memcpy(s->data + s->pos, buf, len);
+   s->pos += len;
+   if (s->pos > s->size)
+      s->size = s->pos;
+   return len;
+}
+
+static fpos_t MemStreamSeek(void *cookie, fpos_t offset, int whence)
+{
+   MemStream *s = (MemStream *)cookie;
+
+   switch (whence)
+   {
+      case SEEK_SET: break;
+      case SEEK_CUR: offset += s->pos; break;
+      case SEEK_END: offset += s->size; break;
+      default: return -1;
+   }
+   if (offset < 0)
+      return -1;
+   s->pos = offset;
+   return offset;
+}
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+
+int YabSaveStateBuffer(void **buffer, size_t *size)
+{
+   FILE *fp;
+   int ret;
+#ifdef __GLIBC__
+   char *data = NULL;
+   size_t dataSize = 0;
+
+   if ((fp = open_memstream(&data, &dataSize)) == NULL)
+      return -1;
+
+   ret = YabSaveStateStream(fp);
+   fclose(fp);
+
+   if (ret != 0)
+   {
+      free(data);
+      return ret;
+   }
+
+   *buffer = data;
+   *size = dataSize;
+#else
+   MemStream s = { NULL, 0, 0, 0 };
+
+   if ((fp = funopen(&s, NULL, MemStreamWrite, MemStreamSeek, NULL)) == NULL)
+      return -1;
+
+   ret = YabSaveStateStream(fp);
+   fclose(fp);
+
+   if (ret != 0)
+   {
+      free(s.data);
+      return ret;
+   }
+
+   *buffer = s.data;
+   *size = s.size;
+#endif
+
+   return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+int YabLoadStateBuffer(const void *buffer, size_t size)
+{
+   FILE *fp;
+   int ret;
+#ifdef __GLIBC__
+   if ((fp = fmemopen((void *)buffer, size, "rb")) == NULL)
+      return -1;
+#else
+   MemStream s = { (u8 *)buffer, size, size, 0 };
+
+   if ((fp = funopen(&s, MemStreamRead, NULL, MemStreamSeek, NULL)) == NULL)
+      return -1;
+#endif
+
+   ret = YabLoadStateStream(fp);
+   fclose(fp);
+
+   return ret;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 int YabSaveStateSlot(const char *dirpath, u8 slot)
 {
    char filename[512];
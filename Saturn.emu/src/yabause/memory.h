@@ -404,6 +404,10 @@ void FormatBackupRam(void *mem, u32 size);
 
 int YabSaveState(const char *filename);
 int YabLoadState(const char *filename);
+int YabSaveStateStream(FILE *fp);
+int YabLoadStateStream(FILE *fp);
+int YabSaveStateBuffer(void **buffer, size_t *size);
+int YabLoadStateBuffer(const void *buffer, size_t size);
 int YabSaveStateSlot(const char *dirpath, u8 slot);
 int YabLoadStateSlot(const char *dirpath, u8 slot);
 
@@ -263,7 +263,7 @@ int q68_run(Q68State *state, int cycles)
             }
         }
 #ifdef Q68_USE_JIT
-        if (!state->jit_running) {
+        if (!state->jit_running && !state->jit_disabled) {
             state->jit_running = q68_jit_find(state, state->PC);
             if (UNLIKELY(!state->jit_running)) {
                 state->jit_running = q68_jit_translate(state, state->PC);
@@ -1381,9 +1381,12 @@ static int op_DIV(Q68State *state, uint32_t opcode)
 
     int32_t quotient, remainder;
     if (sign) {
-        quotient  = (int32_t)state->D[reg] / (int16_t)divisor;
-        remainder = (int32_t)state->D[reg] % (int16_t)divisor;
-        if (quotient < -0x8000 || quotient > 0x7FFF) {
+        /* Divide in 64 bits, since $80000000 / -1 doesn't fit in 32 */
+        const int64_t dividend = (int32_t)state->D[reg];
+        const int64_t quotient64 = dividend / (int16_t)divisor;
+        quotient  = (int32_t)quotient64;
+        remainder = dividend % (int16_t)divisor;
+        if (quotient64 < -0x8000 || quotient64 > 0x7FFF) {
             state->SR |= SR_V;
         } else {
             state->SR &= ~SR_V;
@@ -1446,7 +1449,9 @@ static int op_MUL(Q68State *state, uint32_t opcode)
     if (sign) {
         state->D[reg] = (int16_t)state->D[reg] * (int16_t)data;
     } else {
-        state->D[reg] = (uint16_t)state->D[reg] * data;
+        /* Multiply in 32 bits; uint16_t operands would be promoted to int
+         * and overflow */
+        state->D[reg] = (uint32_t)(uint16_t)state->D[reg] * data;
     }
     INSN_CLEAR_CC();
     INSN_SETNZ(state->D[reg]);
@@ -1566,11 +1571,11 @@ static int opshft(Q68State *state, uint32_t opcode)
                 }
                 data <<= 1;
             } else {
-                data = (int32_t)data >> (count-1);
+                data >>= count-1;
                 if (data & 1) {
                     state->SR |= SR_X | SR_C;
                 }
-                data = (int32_t)data >> 1;
+                data >>= 1;
             }
             break;
           case 2: {  // ROXL/ROXR
@@ -1595,19 +1600,18 @@ static int opshft(Q68State *state, uint32_t opcode)
             break;
           }
           default: {  // (case 3) ROL/ROR
+            const uint32_t mask = 0xFFFFFFFF >> (32 - nbits);
             count %= nbits;
-            if (is_left) {
-                data = (data << count) | (data >> (nbits - count));
-                if ((data >> (nbits-1)) & 1) {
-                    state->SR |= SR_C;
-                }
-                data <<= 1;
-            } else {
-                data = (data >> count) | (data << (nbits - count));
-                if (data & 1) {
-                    state->SR |= SR_C;
+            if (count > 0) {
+                if (is_left) {
+                    data = (data << count | data >> (nbits - count)) & mask;
+                } else {
+                    data = (data >> count | data << (nbits - count)) & mask;
                 }
-                data = (int32_t)data >> 1;
+            }
+            /* C is the last bit rotated out, even for a multiple of nbits */
+            if ((is_left ? data : data >> (nbits-1)) & 1) {
+                state->SR |= SR_C;
             }
             break;
           }
@@ -1789,7 +1793,10 @@ static int opMVSR(Q68State *state, uint32_t opcode)
         }
         ea_set(state, opcode, SIZE_W, value);
     } else {
-        if (!is_CCR) {
+        if (is_CCR) {
+            state->SR &= 0xFF00;
+            state->SR |= value & 0x00FF;
+        } else {
             set_SR(state, value);
         }
     }
@@ -196,6 +196,9 @@ struct Q68State_ {
     /* Currently executing JIT block (NULL = none) */
     Q68JitEntry *jit_running;
 
+    /* Nonzero if dynamic translation has been turned off at runtime */
+    unsigned int jit_disabled;
+
     /* Nonzero if JIT routine needs to abort because the underlying 68000
      * code was modified (e.g. by a self-modifying routine) */
     unsigned int jit_abort;
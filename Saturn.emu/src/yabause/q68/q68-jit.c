@@ -421,6 +421,7 @@ int q68_jit_init(Q68State *state)
 
     /* Default to no cache flush function */
     state->jit_flush   = NULL;
+    state->jit_disabled = 0;
 
 #ifdef Q68_DISABLE_ADDRESS_ERROR
     /* Hack to avoid compiler warnings about unused functions */
@@ -1009,7 +1010,7 @@ static int translate_insn(Q68State *state, Q68JitEntry *entry)
 
     /* Emit a cycle count check if appropriate */
 #ifdef Q68_JIT_LOOSE_TIMING
-    if ((opcode & 0xFF00) == 0x6100  // Bcc
+    if ((opcode & 0xF000) == 0x6000  // Bcc (including BRA/BSR)
      || (opcode & 0xF0F8) == 0x50C8  // DBcc
      || (opcode & 0xFFF0) == 0x4E40  // TRAP
      || (opcode & 0xFF80) == 0x4E80  // JSR/JMP
@@ -1346,6 +1347,7 @@ static unsigned int cc_info(uint16_t opcode)
 {
     const unsigned int INPUT_XNZVC  = 0x1F00;
     const unsigned int INPUT_XZ     = 0x1400;
+    const unsigned int INPUT_NZ     = 0x0C00;
     const unsigned int INPUT_X      = 0x1000;
     const unsigned int INPUT_N      = 0x0800;
     const unsigned int INPUT_V      = 0x0200;
@@ -1552,8 +1554,9 @@ static unsigned int cc_info(uint16_t opcode)
         }
 
       case 0x8:
-        if ((opcode>>6 & 3) == 3) {  // MULS/MULU
-            return INPUT_NONE | OUTPUT_NZVC;
+        if ((opcode>>6 & 3) == 3) {  // DIVU/DIVS
+            /* N and Z are left unchanged on overflow */
+            return INPUT_NZ | OUTPUT_NZVC;
         } else if ((opcode & 0x01F0) == 0x0100) {  // SBCD
             return INPUT_XZ | OUTPUT_XZC;
         } else {  // OR
@@ -1578,7 +1581,7 @@ static unsigned int cc_info(uint16_t opcode)
         return INPUT_NONE | OUTPUT_NZVC;
 
       case 0xC:
-        if ((opcode>>6 & 3) == 3) {  // DIVS/DIVD
+        if ((opcode>>6 & 3) == 3) {  // MULU/MULS
             return INPUT_NONE | OUTPUT_NZVC;
         } else if ((opcode & 0x01F0) == 0x0100) {  // ABCD
             return INPUT_XZ | OUTPUT_XZC;
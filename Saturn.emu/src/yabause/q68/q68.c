@@ -197,6 +197,31 @@ void q68_set_jit_flush_func(Q68State *state, void (*flush_func)(void))
     state->jit_flush   = flush_func;
 }
 
+/*-----------------------------------------------------------------------*/
+
+/**
+ * q68_set_jit_enabled:  Enable or disable dynamic translation at runtime.
+ * While disabled, all code is run by the interpreter, but translated
+ * blocks are still invalidated by memory writes so they remain valid when
+ * translation is enabled again.  This function has no effect if dynamic
+ * translation is not enabled.
+ *
+ * [Parameters]
+ *       state: Processor state block
+ *     enabled: Nonzero to use dynamic translation, zero to interpret only
+ * [Return value]
+ *     None
+ */
+void q68_set_jit_enabled(Q68State *state, int enabled)
+{
+#ifdef Q68_USE_JIT
+    state->jit_disabled = !enabled;
+    if (!enabled) {
+        state->jit_running = NULL;
+    }
+#endif
+}
+
 /*************************************************************************/
 
 /**
@@ -265,6 +290,8 @@ void q68_set_areg(Q68State *state, int num, uint32_t value)
 void q68_set_pc(Q68State *state, uint32_t value)
 {
     state->PC = value;
+    /* Don't resume a translated block from its old position */
+    state->jit_running = NULL;
 }
 
 void q68_set_sr(Q68State *state, uint16_t value)
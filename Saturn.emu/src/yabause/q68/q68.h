@@ -153,6 +153,21 @@ extern void q68_set_writew_func(Q68State *state, Q68WriteFunc func);
  */
 extern void q68_set_jit_flush_func(Q68State *state, void (*flush_func)(void));
 
+/**
+ * q68_set_jit_enabled:  Enable or disable dynamic translation at runtime.
+ * While disabled, all code is run by the interpreter, but translated
+ * blocks are still invalidated by memory writes so they remain valid when
+ * translation is enabled again.  This function has no effect if dynamic
+ * translation is not enabled.
+ *
+ * [Parameters]
+ *       state: Processor state block
+ *     enabled: Nonzero to use dynamic translation, zero to interpret only
+ * [Return value]
+ *     None
+ */
+extern void q68_set_jit_enabled(Q68State *state, int enabled);
+
 /*----------------------------------*/
 
 /**
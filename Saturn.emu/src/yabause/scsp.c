@@ -2556,12 +2556,83 @@ scsp_midi_out_read (void)
   return 0xFF;
 }
 
+////////////////////////////////////////////////////////////////
+// Threaded SCSP
+//
+// With HAVE_SCSP2, scsp2.c is linked in as well with its entry points
+// prefixed by Scsp2_. Setting yabsys.UseThreads before ScspInit() selects
+// it and the public functions in this file then forward to it. It runs the
+// SCSP and M68K on a subthread, so M68KExec() and M68KSync() do nothing and
+// ScspExec() only advances its clock target by one scanline.
+
+#ifdef HAVE_SCSP2
+static int scsp2active = 0;
+
+int Scsp2_ScspInit (int coreid, void (*interrupt_handler)(void));
+int Scsp2_ScspChangeSoundCore (int coreid);
+void Scsp2_ScspSetFrameAccurate (int on);
+void Scsp2_ScspDeInit (void);
+void Scsp2_M68KStart (void);
+void Scsp2_M68KStop (void);
+void Scsp2_ScspReset (void);
+int Scsp2_ScspChangeVideoFormat (int type);
+void Scsp2_ScspExec (int decilines);
+void Scsp2_ScspReceiveCDDA (const u8 *sector);
+int Scsp2_SoundSaveState (FILE *fp);
+int Scsp2_SoundLoadState (FILE *fp, int version, int size);
+void Scsp2_ScspSlotDebugStats (u8 slotnum, char *outstring);
+void Scsp2_ScspCommonControlRegisterDebugStats (char *outstring);
+int Scsp2_ScspSlotDebugSaveRegisters (u8 slotnum, const char *filename);
+int Scsp2_ScspSlotDebugAudioSaveWav (u8 slotnum, const char *filename);
+void Scsp2_ScspMuteAudio (int flags);
+void Scsp2_ScspUnMuteAudio (int flags);
+void Scsp2_ScspSetVolume (int volume);
+u8 FASTCALL Scsp2_SoundRamReadByte (u32 address);
+u16 FASTCALL Scsp2_SoundRamReadWord (u32 address);
+u32 FASTCALL Scsp2_SoundRamReadLong (u32 address);
+void FASTCALL Scsp2_SoundRamWriteByte (u32 address, u8 data);
+void FASTCALL Scsp2_SoundRamWriteWord (u32 address, u16 data);
+void FASTCALL Scsp2_SoundRamWriteLong (u32 address, u32 data);
+u8 FASTCALL Scsp2_ScspReadByte (u32 address);
+u16 FASTCALL Scsp2_ScspReadWord (u32 address);
+u32 FASTCALL Scsp2_ScspReadLong (u32 address);
+void FASTCALL Scsp2_ScspWriteByte (u32 address, u8 data);
+void FASTCALL Scsp2_ScspWriteWord (u32 address, u16 data);
+void FASTCALL Scsp2_ScspWriteLong (u32 address, u32 data);
+void Scsp2_M68KStep (void);
+void Scsp2_M68KWriteNotify (u32 address, u32 size);
+// M68KRegs and M68KBreakpointInfo in scsp2.h have the same layout as
+// m68kregs_struct and m68kcodebreakpoint_struct
+void Scsp2_M68KGetRegisters (m68kregs_struct *regs);
+void Scsp2_M68KSetRegisters (const m68kregs_struct *regs);
+void Scsp2_M68KSetBreakpointCallBack (void (*func)(u32));
+int Scsp2_M68KAddCodeBreakpoint (u32 address);
+int Scsp2_M68KDelCodeBreakpoint (u32 address);
+const m68kcodebreakpoint_struct *Scsp2_M68KGetBreakpointList (void);
+void Scsp2_M68KClearCodeBreakpoints (void);
+
+#define SCSP2_FORWARD(call) \
+  if (scsp2active) \
+    return call
+#define SCSP2_FORWARD_VOID(call) \
+  if (scsp2active) \
+    { \
+      call; \
+      return; \
+    }
+#else
+#define SCSP2_FORWARD(call)
+#define SCSP2_FORWARD_VOID(call)
+#endif
+
 ////////////////////////////////////////////////////////////////
 // Access
 
 void FASTCALL
 scsp_w_b (u32 a, u8 d)
 {
+  SCSP2_FORWARD_VOID (Scsp2_ScspWriteByte (a, d));
+
   a &= 0xFFF;
 
   if (a < 0x400)
@@ -2598,6 +2669,8 @@ scsp_w_b (u32 a, u8 d)
 void FASTCALL
 scsp_w_w (u32 a, u16 d)
 {
+  SCSP2_FORWARD_VOID (Scsp2_ScspWriteWord (a, d));
+
   if (a & 1)
     {
       SCSPLOG ("ERROR: scsp w_w misaligned : %.8X\n", a);
@@ -2639,6 +2712,8 @@ scsp_w_w (u32 a, u16 d)
 void FASTCALL
 scsp_w_d (u32 a, u32 d)
 {
+  SCSP2_FORWARD_VOID (Scsp2_ScspWriteLong (a, d));
+
   if (a & 3)
     {
       SCSPLOG ("ERROR: scsp w_d misaligned : %.8X\n", a);
@@ -2682,6 +2757,8 @@ scsp_w_d (u32 a, u32 d)
 u8 FASTCALL
 scsp_r_b (u32 a)
 {
+  SCSP2_FORWARD (Scsp2_ScspReadByte (a));
+
   a &= 0xFFF;
 
   if (a < 0x400)
@@ -2711,6 +2788,8 @@ scsp_r_b (u32 a)
 u16 FASTCALL
 scsp_r_w (u32 a)
 {
+  SCSP2_FORWARD (Scsp2_ScspReadWord (a));
+
   if (a & 1)
     {
       SCSPLOG ("ERROR: scsp r_w misaligned : %.8X\n", a);
@@ -2745,6 +2824,8 @@ scsp_r_w (u32 a)
 u32 FASTCALL
 scsp_r_d (u32 a)
 {
+  SCSP2_FORWARD (Scsp2_ScspReadLong (a));
+
   if (a & 3)
     {
       SCSPLOG ("ERROR: scsp r_d misaligned : %.8X\n", a);
@@ -3074,6 +3155,8 @@ scu_interrupt_handler (void)
 u8 FASTCALL
 SoundRamReadByte (u32 addr)
 {
+  SCSP2_FORWARD (Scsp2_SoundRamReadByte (addr));
+
   addr &= 0xFFFFF;
 
   // If mem4b is set, mirror ram every 256k
@@ -3090,6 +3173,8 @@ SoundRamReadByte (u32 addr)
 void FASTCALL
 SoundRamWriteByte (u32 addr, u8 val)
 {
+  SCSP2_FORWARD_VOID (Scsp2_SoundRamWriteByte (addr, val));
+
   addr &= 0xFFFFF;
 
   // If mem4b is set, mirror ram every 256k
@@ -3107,6 +3192,8 @@ SoundRamWriteByte (u32 addr, u8 val)
 u16 FASTCALL
 SoundRamReadWord (u32 addr)
 {
+  SCSP2_FORWARD (Scsp2_SoundRamReadWord (addr));
+
   addr &= 0xFFFFF;
 
   if (scsp.mem4b == 0)
@@ -3122,6 +3209,8 @@ SoundRamReadWord (u32 addr)
 void FASTCALL
 SoundRamWriteWord (u32 addr, u16 val)
 {
+  SCSP2_FORWARD_VOID (Scsp2_SoundRamWriteWord (addr, val));
+
   addr &= 0xFFFFF;
 
   // If mem4b is set, mirror ram every 256k
@@ -3139,6 +3228,8 @@ SoundRamWriteWord (u32 addr, u16 val)
 u32 FASTCALL
 SoundRamReadLong (u32 addr)
 {
+  SCSP2_FORWARD (Scsp2_SoundRamReadLong (addr));
+
   addr &= 0xFFFFF;
 
   // If mem4b is set, mirror ram every 256k
@@ -3155,6 +3246,8 @@ SoundRamReadLong (u32 addr)
 void FASTCALL
 SoundRamWriteLong (u32 addr, u32 val)
 {
+  SCSP2_FORWARD_VOID (Scsp2_SoundRamWriteLong (addr, val));
+
   addr &= 0xFFFFF;
 
   // If mem4b is set, mirror ram every 256k
@@ -3174,6 +3267,12 @@ ScspInit (int coreid)
 {
   int i;
 
+#ifdef HAVE_SCSP2
+  scsp2active = yabsys.UseThreads;
+  if (scsp2active)
+    return Scsp2_ScspInit (coreid, &scu_interrupt_handler);
+#endif
+
   if ((SoundRam = T2MemoryInit (0x80000)) == NULL)
     return -1;
 
@@ -3230,6 +3329,8 @@ ScspChangeSoundCore (int coreid)
 {
   int i;
 
+  SCSP2_FORWARD (Scsp2_ScspChangeSoundCore (coreid));
+
   // Make sure the old core is freed
   if (SNDCore)
     SNDCore->DeInit();
@@ -3281,6 +3382,8 @@ ScspChangeSoundCore (int coreid)
 void
 ScspSetFrameAccurate (int on)
 {
+  SCSP2_FORWARD_VOID (Scsp2_ScspSetFrameAccurate (on));
+
    scspframeaccurate = (on != 0);
 }
 
@@ -3289,6 +3392,8 @@ ScspSetFrameAccurate (int on)
 void
 ScspDeInit (void)
 {
+  SCSP2_FORWARD_VOID (Scsp2_ScspDeInit ());
+
   if (scspchannel[0].data32)
     free(scspchannel[0].data32);
   scspchannel[0].data32 = NULL;
@@ -3313,6 +3418,8 @@ ScspDeInit (void)
 void
 M68KStart (void)
 {
+  SCSP2_FORWARD_VOID (Scsp2_M68KStart ());
+
   M68K->Reset ();
   savedcycles = 0;
   IsM68KRunning = 1;
@@ -3323,6 +3430,8 @@ M68KStart (void)
 void
 M68KStop (void)
 {
+  SCSP2_FORWARD_VOID (Scsp2_M68KStop ());
+
   IsM68KRunning = 0;
 }
 
@@ -3331,6 +3440,8 @@ M68KStop (void)
 void
 ScspReset (void)
 {
+  SCSP2_FORWARD_VOID (Scsp2_ScspReset ());
+
   scsp_reset();
 }
 
@@ -3339,6 +3450,8 @@ ScspReset (void)
 int
 ScspChangeVideoFormat (int type)
 {
+  SCSP2_FORWARD (Scsp2_ScspChangeVideoFormat (type));
+
   scspsoundlen = 44100 / (type ? 50 : 60);
   scsplines = type ? 313 : 263;
   scspsoundbufsize = scspsoundlen * scspsoundbufs;
@@ -3364,6 +3477,12 @@ void
 M68KExec (s32 cycles)
 {
   s32 newcycles = savedcycles - cycles;
+
+#ifdef HAVE_SCSP2
+  if (scsp2active)
+    return;
+#endif
+
   if (LIKELY(IsM68KRunning))
     {
       if (LIKELY(newcycles < 0))
@@ -3411,6 +3530,8 @@ M68KExecBP (s32 cycles)
 void
 M68KStep (void)
 {
+  SCSP2_FORWARD_VOID (Scsp2_M68KStep ());
+
   M68K->Exec(1);
 }
 
@@ -3420,6 +3541,11 @@ M68KStep (void)
 void
 M68KSync (void)
 {
+#ifdef HAVE_SCSP2
+  if (scsp2active)
+    return;
+#endif
+
   M68K->Sync();
 }
 
@@ -3461,6 +3587,8 @@ ScspConvert32uto16s (s32 *srcL, s32 *srcR, s16 *dst, u32 len)
 void
 ScspReceiveCDDA (const u8 *sector)
 {	
+  SCSP2_FORWARD_VOID (Scsp2_ScspReceiveCDDA (sector));
+
    // If buffer is half empty or less, boost timing for a bit until we've buffered a few sectors
    if (cdda_out_left < (sizeof(cddabuf.data) / 2))
    {
@@ -3498,6 +3626,8 @@ ScspExec ()
 {
   u32 audiosize;
 
+  SCSP2_FORWARD_VOID (Scsp2_ScspExec (10));
+
   ScspInternalVars->scsptiming2 +=
     ((scspsoundlen << 16) + scsplines / 2) / scsplines;
   scsp_update_timer (ScspInternalVars->scsptiming2 >> 16); // Pass integer part
@@ -3593,6 +3723,8 @@ ScspExec ()
 void
 M68KWriteNotify (u32 address, u32 size)
 {
+  SCSP2_FORWARD_VOID (Scsp2_M68KWriteNotify (address, size));
+
   M68K->WriteNotify (address, size);
 }
 
@@ -3603,6 +3735,8 @@ M68KGetRegisters (m68kregs_struct *regs)
 {
   int i;
 
+  SCSP2_FORWARD_VOID (Scsp2_M68KGetRegisters (regs));
+
   if (regs != NULL)
     {
       for (i = 0; i < 8; i++)
@@ -3623,6 +3757,8 @@ M68KSetRegisters (m68kregs_struct *regs)
 {
   int i;
 
+  SCSP2_FORWARD_VOID (Scsp2_M68KSetRegisters (regs));
+
   if (regs != NULL)
     {
       for (i = 0; i < 8; i++)
@@ -3641,6 +3777,8 @@ M68KSetRegisters (m68kregs_struct *regs)
 void
 ScspMuteAudio (int flags)
 {
+  SCSP2_FORWARD_VOID (Scsp2_ScspMuteAudio (flags));
+
   scsp_mute_flags |= flags;
   if (SNDCore && scsp_mute_flags)
     SNDCore->MuteAudio ();
@@ -3651,6 +3789,8 @@ ScspMuteAudio (int flags)
 void
 ScspUnMuteAudio (int flags)
 {
+  SCSP2_FORWARD_VOID (Scsp2_ScspUnMuteAudio (flags));
+
   scsp_mute_flags &= ~flags;
   if (SNDCore && (scsp_mute_flags == 0))
     SNDCore->UnMuteAudio ();
@@ -3661,6 +3801,8 @@ ScspUnMuteAudio (int flags)
 void
 ScspSetVolume (int volume)
 {
+  SCSP2_FORWARD_VOID (Scsp2_ScspSetVolume (volume));
+
   scsp_volume = volume;
   if (SNDCore)
     SNDCore->SetVolume (volume);
@@ -3671,6 +3813,8 @@ ScspSetVolume (int volume)
 void
 M68KSetBreakpointCallBack (void (*func)(u32))
 {
+  SCSP2_FORWARD_VOID (Scsp2_M68KSetBreakpointCallBack (func));
+
   ScspInternalVars->BreakpointCallBack = func;
 }
 
@@ -3681,6 +3825,8 @@ M68KAddCodeBreakpoint (u32 addr)
 {
   int i;
 
+  SCSP2_FORWARD (Scsp2_M68KAddCodeBreakpoint (addr));
+
   if (ScspInternalVars->numcodebreakpoints < MAX_BREAKPOINTS)
     {
       // Make sure it isn't already on the list
@@ -3730,6 +3876,9 @@ int
 M68KDelCodeBreakpoint (u32 addr)
 {
   int i;
+
+  SCSP2_FORWARD (Scsp2_M68KDelCodeBreakpoint (addr));
+
   if (ScspInternalVars->numcodebreakpoints > 0)
     {
       for (i = 0; i < ScspInternalVars->numcodebreakpoints; i++)
@@ -3754,6 +3903,8 @@ M68KDelCodeBreakpoint (u32 addr)
 m68kcodebreakpoint_struct *
 M68KGetBreakpointList ()
 {
+  SCSP2_FORWARD ((m68kcodebreakpoint_struct *)Scsp2_M68KGetBreakpointList ());
+
   return ScspInternalVars->codebreakpoint;
 }
 
@@ -3763,6 +3914,9 @@ void
 M68KClearCodeBreakpoints ()
 {
   int i;
+
+  SCSP2_FORWARD_VOID (Scsp2_M68KClearCodeBreakpoints ());
+
   for (i = 0; i < MAX_BREAKPOINTS; i++)
     ScspInternalVars->codebreakpoint[i].addr = 0xFFFFFFFF;
 
@@ -3780,6 +3934,8 @@ SoundSaveState (FILE *fp)
   u8 nextphase;
   IOCheck_struct check;
 
+  SCSP2_FORWARD (Scsp2_SoundSaveState (fp));
+
   offset = StateWriteHeader (fp, "SCSP", 2);
 
   // Save 68k registers first
@@ -3899,6 +4055,8 @@ SoundLoadState (FILE *fp, int version, int size)
   u8 nextphase;
   IOCheck_struct check;
 
+  SCSP2_FORWARD (Scsp2_SoundLoadState (fp, version, size));
+
   // Read 68k registers first
   yread (&check, (void *)&IsM68KRunning, 1, 1, fp);
 
@@ -3922,8 +4080,9 @@ SoundLoadState (FILE *fp, int version, int size)
   // Now for the SCSP registers
   yread (&check, (void *)scsp_reg, 0x1000, 1, fp);
 
-  // Lastly, sound ram
+  // Lastly, sound ram (discarding any code translated from the old contents)
   yread (&check, (void *)SoundRam, 0x80000, 1, fp);
+  M68K->WriteNotify (0, 0x80000);
 
   if (version > 1)
     {
@@ -4124,6 +4283,8 @@ ScspSlotDebugStats (u8 slotnum, char *outstring)
 {
   u32 slotoffset = slotnum * 0x20;
 
+  SCSP2_FORWARD_VOID (Scsp2_ScspSlotDebugStats (slotnum, outstring));
+
   AddString (outstring, "Sound Source = ");
   switch (scsp.slot[slotnum].ssctl)
     {
@@ -4251,6 +4412,8 @@ ScspSlotDebugStats (u8 slotnum, char *outstring)
 void
 ScspCommonControlRegisterDebugStats (char *outstring)
 {
+  SCSP2_FORWARD_VOID (Scsp2_ScspCommonControlRegisterDebugStats (outstring));
+
    AddString (outstring, "Memory: %s\r\n", scsp.mem4b ? "4 Mbit" : "2 Mbit");
    AddString (outstring, "Master volume: %ld\r\n", (unsigned long)scsp.mvol);
    AddString (outstring, "Ring buffer length: %ld\r\n", (unsigned long)scsp.rbl);
@@ -4301,6 +4464,8 @@ ScspSlotDebugSaveRegisters (u8 slotnum, const char *filename)
   int i;
   IOCheck_struct check;
 
+  SCSP2_FORWARD (Scsp2_ScspSlotDebugSaveRegisters (slotnum, filename));
+
   if ((fp = fopen (filename, "wb")) == NULL)
     return -1;
 
@@ -4406,6 +4571,8 @@ ScspSlotDebugAudioSaveWav (u8 slotnum, const char *filename)
   long length;
   IOCheck_struct check;
 
+  SCSP2_FORWARD (Scsp2_ScspSlotDebugAudioSaveWav (slotnum, filename));
+
   if (scsp.slot[slotnum].lea == 0)
     return 0;
 
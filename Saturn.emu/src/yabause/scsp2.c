@@ -21,6 +21,53 @@
     Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
 */
 
+// When built alongside scsp.c (HAVE_SCSP2), the exported entry points are
+// renamed with a Scsp2_ prefix and scsp.c forwards to them once this
+// implementation is selected; SoundRam is shared with scsp.c.
+#ifdef HAVE_SCSP2
+# define USE_SCSP2
+# define ScspChangeSoundCore                 Scsp2_ScspChangeSoundCore
+# define ScspChangeVideoFormat               Scsp2_ScspChangeVideoFormat
+# define ScspSetFrameAccurate                Scsp2_ScspSetFrameAccurate
+# define ScspMuteAudio                       Scsp2_ScspMuteAudio
+# define ScspUnMuteAudio                     Scsp2_ScspUnMuteAudio
+# define ScspSetVolume                       Scsp2_ScspSetVolume
+# define ScspDeInit                          Scsp2_ScspDeInit
+# define ScspReset                           Scsp2_ScspReset
+# define ScspExec                            Scsp2_ScspExec
+# define ScspReceiveCDDA                     Scsp2_ScspReceiveCDDA
+# define ScspConvert32uto16s                 Scsp2_ScspConvert32uto16s
+# define ScspSlotDebugStats                  Scsp2_ScspSlotDebugStats
+# define ScspCommonControlRegisterDebugStats Scsp2_ScspCommonControlRegisterDebugStats
+# define ScspSlotDebugSaveRegisters          Scsp2_ScspSlotDebugSaveRegisters
+# define ScspSlotDebugAudioSaveWav           Scsp2_ScspSlotDebugAudioSaveWav
+# define SoundSaveState                      Scsp2_SoundSaveState
+# define SoundLoadState                      Scsp2_SoundLoadState
+# define SoundRamReadByte                    Scsp2_SoundRamReadByte
+# define SoundRamReadWord                    Scsp2_SoundRamReadWord
+# define SoundRamReadLong                    Scsp2_SoundRamReadLong
+# define SoundRamWriteByte                   Scsp2_SoundRamWriteByte
+# define SoundRamWriteWord                   Scsp2_SoundRamWriteWord
+# define SoundRamWriteLong                   Scsp2_SoundRamWriteLong
+# define ScspReadByte                        Scsp2_ScspReadByte
+# define ScspReadWord                        Scsp2_ScspReadWord
+# define ScspReadLong                        Scsp2_ScspReadLong
+# define ScspWriteByte                       Scsp2_ScspWriteByte
+# define ScspWriteWord                       Scsp2_ScspWriteWord
+# define ScspWriteLong                       Scsp2_ScspWriteLong
+# define M68KStart                           Scsp2_M68KStart
+# define M68KStop                            Scsp2_M68KStop
+# define M68KStep                            Scsp2_M68KStep
+# define M68KWriteNotify                     Scsp2_M68KWriteNotify
+# define M68KGetRegisters                    Scsp2_M68KGetRegisters
+# define M68KSetRegisters                    Scsp2_M68KSetRegisters
+# define M68KSetBreakpointCallBack           Scsp2_M68KSetBreakpointCallBack
+# define M68KAddCodeBreakpoint               Scsp2_M68KAddCodeBreakpoint
+# define M68KDelCodeBreakpoint               Scsp2_M68KDelCodeBreakpoint
+# define M68KGetBreakpointList               Scsp2_M68KGetBreakpointList
+# define M68KClearCodeBreakpoints            Scsp2_M68KClearCodeBreakpoints
+#endif
+
 #include "core.h"
 #include "debug.h"
 #include "error.h"
@@ -37,6 +84,9 @@
 #define round(x)  ((int) (floor((x) + 0.5)))
 
 #undef ScspInit  // Disable compatibility alias
+#ifdef HAVE_SCSP2
+# define ScspInit Scsp2_ScspInit
+#endif
 
 extern SoundInterface_struct *SNDCoreList[];  // Defined by each port
 
@@ -66,6 +116,14 @@ extern SoundInterface_struct *SNDCoreList[];  // Defined by each port
 // than a pair of context switches, and it seems that SCSP register writes
 // from the SH-2 are uncommon.)
 //
+// Sound RAM writes from outside the SCSP/M68K are applied immediately, but
+// in multithreaded mode the M68K emulator must not be told about them from
+// the main thread, since a JIT core would then discard translated code the
+// subthread may be executing.  Instead, the main thread marks the written
+// pages in scsp_ram_dirty[] and sets scsp_ram_dirty_pending; the thread
+// loop passes the dirty pages to M68K->WriteNotify() before its next
+// ScspDoExec() iteration.
+//
 // The "PSP_*" macros scattered throughout the file are to support the
 // execution of the SCSP thread on the Media Engine CPU (ME) in the PSP.
 // The ME lacks cache coherence with the main CPU (SC), so special care
@@ -443,7 +501,9 @@ typedef struct ScspState_struct {
 //-------------------------------------------------------------------------
 // Exported data
 
+#ifndef HAVE_SCSP2
 u8 *SoundRam;
+#endif
 
 //-------------------------------------------------------------------------
 // Lookup tables
@@ -515,6 +575,14 @@ PSP_SECTION(both_write)
 PSP_SECTION(both_write)
    static volatile u32 scsp_write_buffer_data;
 
+// Sound RAM pages written by the main thread and not yet passed to the
+// M68K emulator (set by the main thread, cleared by the subthread)
+#define SCSP_RAM_DIRTY_SHIFT 12
+PSP_SECTION(both_write)
+   static volatile u8 scsp_ram_dirty[0x80000 >> SCSP_RAM_DIRTY_SHIFT];
+PSP_SECTION(both_write)
+   static volatile u8 scsp_ram_dirty_pending;
+
 // SCSP register value cache (caching handled separately)
 #ifdef PSP
 __attribute__((aligned(64)))
@@ -568,6 +636,7 @@ static u8 m68k_in_breakpoint;
 // Local function declarations
 
 static void ScspThread(void *arg);
+static void ScspFlushRamWrites(void);
 static void ScspDoExec(u32 cycles);
 static u32 ScspTimerCyclesLeft(u16 timer, u8 timer_scale);
 static void ScspUpdateTimer(u32 samples, u16 *timer_ptr, u8 timer_scale,
@@ -1261,6 +1330,9 @@ static void ScspThread(void *arg)
          PSP_UC(scsp_write_buffer_size) = 0;
       }
 
+      if (PSP_UC(scsp_ram_dirty_pending))
+         ScspFlushRamWrites();
+
       clock_cycles = PSP_UC(scsp_clock_target) - scsp_clock;
       if (clock_cycles > SCSP_CLOCK_MAX_EXEC)
          clock_cycles = SCSP_CLOCK_MAX_EXEC;
@@ -1274,6 +1346,28 @@ static void ScspThread(void *arg)
    }
 }
 
+//-------------------------------------------------------------------------
+
+// ScspFlushRamWrites:  Pass sound RAM pages written by the main thread to
+// the M68K emulator.  The pending flag is cleared before the pages are
+// scanned, so a write racing with the scan is caught on the next call.
+
+static void ScspFlushRamWrites(void)
+{
+   u32 page;
+
+   PSP_UC(scsp_ram_dirty_pending) = 0;
+   for (page = 0; page < sizeof(scsp_ram_dirty); page++)
+   {
+      if (PSP_UC(scsp_ram_dirty[page]))
+      {
+         PSP_UC(scsp_ram_dirty[page]) = 0;
+         M68K->WriteNotify(page << SCSP_RAM_DIRTY_SHIFT,
+                           1 << SCSP_RAM_DIRTY_SHIFT);
+      }
+   }
+}
+
 ///////////////////////////////////////////////////////////////////////////
 
 // ScspDoExec:  Main SCSP processing routine implementation.  Runs M68K
@@ -1528,25 +1622,39 @@ u32 FASTCALL SoundRamReadLong(u32 address)
 
 //----------------------------------//
 
+// SoundRamNotify:  Notify the M68K emulator of an external sound RAM
+// write, deferring it to the SCSP thread when one is running.
+
+static INLINE void SoundRamNotify(u32 address, u32 size)
+{
+   if (scsp_thread_running)
+   {
+      PSP_UC(scsp_ram_dirty[address >> SCSP_RAM_DIRTY_SHIFT]) = 1;
+      PSP_UC(scsp_ram_dirty_pending) = 1;
+   }
+   else
+      M68K->WriteNotify(address, size);
+}
+
 void FASTCALL SoundRamWriteByte(u32 address, u8 data)
 {
    address &= scsp.sound_ram_mask;
    T2WriteByte(SoundRam, address, data);
-   M68K->WriteNotify(address, 1);
+   SoundRamNotify(address, 1);
 }
 
 void FASTCALL SoundRamWriteWord(u32 address, u16 data)
 {
    address &= scsp.sound_ram_mask;
    T2WriteWord(SoundRam, address, data);
-   M68K->WriteNotify(address, 2);
+   SoundRamNotify(address, 2);
 }
 
 void FASTCALL SoundRamWriteLong(u32 address, u32 data)
 {
    address &= scsp.sound_ram_mask;
    T2WriteLong(SoundRam, address, data);
-   M68K->WriteNotify(address, 4);
+   SoundRamNotify(address, 4);
 }
 
 //-------------------------------------------------------------------------
@@ -1835,8 +1943,9 @@ int SoundLoadState(FILE *fp, int version, int size)
    // Now for the SCSP registers
    yread(&check, (void *)scsp_regcache, 0x1000, 1, fp);
 
-   // And sound RAM
+   // And sound RAM (discarding any code translated from the old contents)
    yread(&check, (void *)SoundRam, 0x80000, 1, fp);
+   M68K->WriteNotify(0, 0x80000);
 
    // Break out slot registers into their respective fields
    for (i = 0; i < 32; i++)
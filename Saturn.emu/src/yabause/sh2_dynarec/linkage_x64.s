@@ -101,7 +101,7 @@ newline:
 	sub	%edx, %ebx  /* sh2cycles(full line) - decilinecycles*9 */
 	mov	%rax, CurrentSH2
 	mov	%ebx, -52(%rbp) /* sh2cycles */
-	cmp	$0, (%rax, %rcx)
+	cmpl	$0, (%rax, %rcx)
 	jne	master_handle_interrupts
 	mov	master_cc, %esi
 	sub	%ebx, %esi
@@ -136,7 +136,7 @@ slave_entry:
 	mov	SSH2, %rax
 	mov	NumberOfInterruptsOffset, %ecx
 	mov	%rax, CurrentSH2
-	cmp	$0, (%rax, %rcx)
+	cmpl	$0, (%rax, %rcx)
 	jne	slave_handle_interrupts
 	mov	slave_cc, %esi
 	sub	%ebx, %esi
@@ -322,7 +322,9 @@ dyna_linker:
 	mov	%esi, %ebp
 	lea	4(%ebx,%edi,1), %esi
 	mov	%eax, %edi
+	add	$-8, %rsp /* Align stack */
 	call	add_link
+	add	$8, %rsp /* Align stack */
 	mov	8(%r12), %edi
 	mov	%ebp, %esi
 	lea	-4(%edi), %edx
@@ -369,7 +371,9 @@ dyna_linker:
 	mov	%eax, %edi
 	mov	%eax, %ebp /* Note: assumes %rbx and %rbp are callee-saved */
 	mov	%esi, %r12d
+	add	$-8, %rsp /* Align stack */
 	call	sh2_recompile_block
+	add	$8, %rsp /* Align stack */
 	test	%eax, %eax
 	mov	%ebp, %eax
 	mov	%r12d, %esi
@@ -467,7 +471,9 @@ jump_vaddr:
 	je	.C1
   /* No hit on hash table, call compiler */
 	mov	%esi, %ebx /* CCREG */
+	add	$-8, %rsp /* Align stack */
 	call	get_addr
+	add	$8, %rsp /* Align stack */
 	mov	%ebx, %esi
 	jmp	*%rax
 	.size	jump_vaddr, .-jump_vaddr
@@ -499,7 +505,9 @@ verify_code:
 	add	$8, %rsp /* pop return address, we're not returning */
 	mov	%r12d, %edi
 	mov	%esi, %ebx
+	add	$-8, %rsp /* Align stack */
 	call	get_addr
+	add	$8, %rsp /* Align stack */
 	mov	%ebx, %esi
 	jmp	*%rax
 	.size	verify_code, .-verify_code
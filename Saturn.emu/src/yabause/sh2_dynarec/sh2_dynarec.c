@@ -1329,7 +1329,8 @@ void alu_alloc(struct regstat *current,int i)
     }
   }
   if(opcode[i]==6) { // NOT/NEG/NEGC
-    if(needed_again(rs1[i],i)) alloc_reg(current,i,rs1[i]);
+    // NEGC sets T from the source even if the result is unused
+    if(needed_again(rs1[i],i)||opcode2[i]==10) alloc_reg(current,i,rs1[i]);
     alloc_reg(current,i,rt1[i]);
     if(opcode2[i]==8||opcode2[i]==9) { // SWAP needs temp (?)
       alloc_reg_temp(current,i,-1);
@@ -1445,7 +1446,9 @@ void load_alloc(struct regstat *current,int i)
 
   // Need a register to load from memory_map
   alloc_reg(current,i,MOREG);
-  if(rt1[i]==TBIT||get_reg(current->regmap,rt1[i])<0) {
+  // An unneeded target may still be mapped from an earlier instruction,
+  // but it is dropped from the map before this load is assembled
+  if(rt1[i]==TBIT||get_reg(current->regmap,rt1[i])<0||((current->u>>rt1[i])&1)) {
     // dummy load, but we still need a register to calculate the address
     alloc_reg_temp(current,i,-1);
     minimum_free_regs[i]=1;
@@ -1618,8 +1621,13 @@ void multdiv_alloc(struct regstat *current,int i)
     if(!(current->u&(1LL<<MACH))) {
       alloc_x86_reg(current,i,MACH,EDX); // Don't need to alloc MACH if it's unneeded
       current->u&=~(1LL<<MACL); // But if it is, then assume MACL is needed since it will be overwritten
+      alloc_x86_reg(current,i,MACL,EAX);
+    }
+    else {
+      // 32-bit result only, any register will do.  Pinning an unneeded
+      // MACL to EAX would drop the dirty bit of whatever was there.
+      alloc_reg(current,i,MACL);
     }
-    alloc_x86_reg(current,i,MACL,EAX);
     #else
     if(!(current->u&(1LL<<MACH))) {
       alloc_reg(current,i,MACH);
@@ -1645,12 +1653,15 @@ void complex_alloc(struct regstat *current,int i)
     #if defined(__i386__) || defined(__x86_64__)
     alloc_x86_reg(current,i,rs1[i],ECX);
     alloc_x86_reg(current,i,rs2[i],EAX);
+    // DIV1 Rn,Rn: the divisor is a scratch copy of the shifted Rn
+    if(rs1[i]==rs2[i]) alloc_x86_reg(current,i,TEMPREG,ECX);
     alloc_x86_reg(current,i,SR,EDX);
     alloc_all(current,i);
     #else
     #if defined(__arm__)
     alloc_arm_reg(current,i,rs1[i],1);
     alloc_arm_reg(current,i,rs2[i],0);
+    if(rs1[i]==rs2[i]) alloc_arm_reg(current,i,TEMPREG,1);
     alloc_arm_reg(current,i,SR,2);
     alloc_all(current,i);
     #else
@@ -1985,7 +1996,7 @@ void alu_assemble(int i,struct regstat *i_regs)
   if(opcode[i]==6) { // NOT/SWAP/NEG
     int s=get_reg(i_regs->regmap,rs1[i]);
     int t=get_reg(i_regs->regmap,rt1[i]);
-    if(s<0) {
+    if(s<0&&t>=0) {
       // FIXME: Preload?
       emit_loadreg(rs1[i],t);
       s=t;
@@ -2805,6 +2816,20 @@ void flags_assemble(int i,struct regstat *i_regs)
 void complex_assemble(int i,struct regstat *i_regs)
 {
   if(opcode[i]==3&&opcode2[i]==4) { // DIV1
+    if(rs1[i]==rs2[i]) {
+      // Rn is shifted before Rm is added or subtracted,
+      // so the divisor is (Rn<<1)|T
+      #if defined(__i386__) || defined(__x86_64__)
+      emit_mov(EDX,ECX);
+      emit_andimm(ECX,1,ECX);
+      emit_add(ECX,EAX,ECX);
+      emit_add(ECX,EAX,ECX);
+      #else
+      emit_andimm(2,1,1);
+      emit_add(1,0,1);
+      emit_add(1,0,1);
+      #endif
+    }
     emit_call((pointer)div1);
   }
   if(opcode[i]==0&&opcode2[i]==15) { // MAC.L
@@ -2971,6 +2996,19 @@ void wb_invalidate(signed char pre[],signed char entry[],u32 dirty, u64 u)
 }
 #endif
 
+// Host register state after wb_invalidate(pre,entry,...).  Registers it
+// moved to their new host register are already loaded, so load_regs must
+// not reload them from memory (the moved value may be dirty).
+void wb_invalidate_regmap(signed char pre[],signed char entry[],signed char moved[])
+{
+  int hr;
+  for(hr=0;hr<HOST_REGS;hr++) {
+    moved[hr]=pre[hr];
+    if(hr!=EXCLUDE_REG&&entry[hr]>=0&&(entry[hr]&63)<TEMPREG)
+      if(get_reg(pre,entry[hr])>=0) moved[hr]=entry[hr];
+  }
+}
+
 // Load the specified registers
 // This only loads the registers given as arguments because
 // we don't want to load things that will be overwritten
@@ -3720,6 +3758,7 @@ void add_to_linker(int addr,int target,int ext)
 void ujump_assemble(int i,struct regstat *i_regs)
 {
   u64 bc_unneeded;
+  signed char moved[HOST_REGS];
   int cc,adj;
   signed char *i_regmap=i_regs->regmap;
   if(i==(ba[i]-start)>>1) assem_debug("idle loop\n");
@@ -3757,7 +3796,8 @@ void ujump_assemble(int i,struct regstat *i_regs)
   bc_unneeded|=1LL<<rt1[i];
   wb_invalidate(regs[i].regmap,branch_regs[i].regmap,regs[i].dirty,
                 bc_unneeded);
-  load_regs(regs[i].regmap,branch_regs[i].regmap,CCREG,CCREG,CCREG);
+  wb_invalidate_regmap(regs[i].regmap,branch_regs[i].regmap,moved);
+  load_regs(moved,branch_regs[i].regmap,CCREG,CCREG,CCREG);
   if(rt1[i]==PR) {
     int rt;
     unsigned int return_address;
@@ -3827,6 +3867,7 @@ void rjump_assemble(int i,struct regstat *i_regs)
   int temp;
   int rs,cc,adj,rh,ht;
   u64 bc_unneeded;
+  signed char moved[HOST_REGS];
   rs=get_reg(branch_regs[i].regmap,rs1[i]);
   assert(rs>=0);
   if(!((i_regs->wasdoingcp>>rs)&1)) {
@@ -3889,7 +3930,8 @@ void rjump_assemble(int i,struct regstat *i_regs)
   bc_unneeded&=~(1LL<<rs1[i]);
   wb_invalidate(regs[i].regmap,branch_regs[i].regmap,regs[i].dirty,
                 bc_unneeded);
-  load_regs(regs[i].regmap,branch_regs[i].regmap,rs1[i],CCREG,CCREG);
+  wb_invalidate_regmap(regs[i].regmap,branch_regs[i].regmap,moved);
+  load_regs(moved,branch_regs[i].regmap,rs1[i],CCREG,CCREG);
   if(rt1[i]==PR) {
     int rt,return_address;
     assert(rs1[i+1]!=PR);
@@ -4175,6 +4217,7 @@ void sjump_assemble(int i,struct regstat *i_regs)
   int unconditional=0,nop=0;
   int invert=0;
   int internal=internal_branch(ba[i]);
+  signed char moved[HOST_REGS];
   match=match_bt(branch_regs[i].regmap,branch_regs[i].dirty,ba[i]);
   assem_debug("match=%d\n",match);
   internal=internal_branch(ba[i]);
@@ -4205,7 +4248,8 @@ void sjump_assemble(int i,struct regstat *i_regs)
     bc_unneeded&=~((1LL<<rs1[i])|(1LL<<rs2[i]));
     wb_invalidate(regs[i].regmap,branch_regs[i].regmap,regs[i].dirty,
                   bc_unneeded);
-    load_regs(regs[i].regmap,branch_regs[i].regmap,CCREG,SR,SR);
+    wb_invalidate_regmap(regs[i].regmap,branch_regs[i].regmap,moved);
+    load_regs(moved,branch_regs[i].regmap,CCREG,SR,SR);
     cc=get_reg(branch_regs[i].regmap,CCREG);
     assert(cc==HOST_CCREG);
     if(unconditional) 
@@ -4333,15 +4377,16 @@ void sjump_assemble(int i,struct regstat *i_regs)
       assem_debug("1:\n");
       wb_invalidate(regs[i].regmap,branch_regs[i].regmap,regs[i].dirty,
                     ds_unneeded);
+      wb_invalidate_regmap(regs[i].regmap,branch_regs[i].regmap,moved);
       // load regs
-      load_regs(regs[i].regmap,branch_regs[i].regmap,rs1[i+1],rs2[i+1],rs3[i+1]);
+      load_regs(moved,branch_regs[i].regmap,rs1[i+1],rs2[i+1],rs3[i+1]);
       address_generation(i+1,&branch_regs[i],0);
       if(itype[i+1]==COMPLEX) {
         if((opcode[i+1]|4)==4&&opcode2[i+1]==15) { // MAC.W/MAC.L
-          load_regs(regs[i].regmap,branch_regs[i].regmap,MACL,MACH,MACH);
+          load_regs(moved,branch_regs[i].regmap,MACL,MACH,MACH);
         }
       }
-      load_regs(regs[i].regmap,branch_regs[i].regmap,CCREG,CCREG,CCREG);
+      load_regs(moved,branch_regs[i].regmap,CCREG,CCREG,CCREG);
       ds_assemble(i+1,&branch_regs[i]);
       cc=get_reg(branch_regs[i].regmap,CCREG);
       if(cc==-1) {
@@ -4374,14 +4419,15 @@ void sjump_assemble(int i,struct regstat *i_regs)
       assem_debug("2:\n");
       wb_invalidate(regs[i].regmap,branch_regs[i].regmap,regs[i].dirty,
                     ds_unneeded);
-      load_regs(regs[i].regmap,branch_regs[i].regmap,rs1[i+1],rs2[i+1],rs3[i+1]);
+      wb_invalidate_regmap(regs[i].regmap,branch_regs[i].regmap,moved);
+      load_regs(moved,branch_regs[i].regmap,rs1[i+1],rs2[i+1],rs3[i+1]);
       address_generation(i+1,&branch_regs[i],0);
       if(itype[i+1]==COMPLEX) {
         if((opcode[i+1]|4)==4&&opcode2[i+1]==15) { // MAC.W/MAC.L
-          load_regs(regs[i].regmap,branch_regs[i].regmap,MACL,MACH,MACH);
+          load_regs(moved,branch_regs[i].regmap,MACL,MACH,MACH);
         }
       }
-      load_regs(regs[i].regmap,branch_regs[i].regmap,CCREG,CCREG,CCREG);
+      load_regs(moved,branch_regs[i].regmap,CCREG,CCREG,CCREG);
       ds_assemble(i+1,&branch_regs[i]);
     }
   }
@@ -4512,6 +4558,7 @@ void unneeded_registers(int istart,int iend,int r)
           if(rs1[i+1]>=0) u&=~(1LL<<rs1[i+1]);
           if(rs2[i+1]>=0) u&=~(1LL<<rs2[i+1]);
           if(rs3[i+1]>=0) u&=~(1LL<<rs3[i+1]);
+          if(rs3[i+1]==SR) u&=~(1LL<<TBIT);
         }
       }
       else
@@ -4536,6 +4583,7 @@ void unneeded_registers(int istart,int iend,int r)
             if(rs1[i+1]>=0) temp_u&=~(1LL<<rs1[i+1]);
             if(rs2[i+1]>=0) temp_u&=~(1LL<<rs2[i+1]);
             if(rs3[i+1]>=0) temp_u&=~(1LL<<rs3[i+1]);
+            if(rs3[i+1]==SR) temp_u&=~(1LL<<TBIT);
           }
           if(rt1[i]>=0) temp_u|=1LL<<rt1[i];
           if(rt2[i]>=0) temp_u|=1LL<<rt2[i];
@@ -4566,6 +4614,7 @@ void unneeded_registers(int istart,int iend,int r)
             if(rs1[i+1]>=0) u&=~(1LL<<rs1[i+1]);
             if(rs2[i+1]>=0) u&=~(1LL<<rs2[i+1]);
             if(rs3[i+1]>=0) u&=~(1LL<<rs3[i+1]);
+            if(rs3[i+1]==SR) u&=~(1LL<<TBIT);
           } else {
             // Conditional branch
             b=unneeded_reg[(ba[i]-start)>>1];
@@ -4579,6 +4628,7 @@ void unneeded_registers(int istart,int iend,int r)
               if(rs1[i+1]>=0) b&=~(1LL<<rs1[i+1]);
               if(rs2[i+1]>=0) b&=~(1LL<<rs2[i+1]);
               if(rs3[i+1]>=0) b&=~(1LL<<rs3[i+1]);
+              if(rs3[i+1]==SR) b&=~(1LL<<TBIT);
             }
             u&=b;
             // Always need stack and status in case of interrupt
@@ -4621,6 +4671,9 @@ void unneeded_registers(int istart,int iend,int r)
     if(rs1[i]>=0) u&=~(1LL<<rs1[i]);
     if(rs2[i]>=0) u&=~(1LL<<rs2[i]);
     if(rs3[i]>=0) u&=~(1LL<<rs3[i]);
+    // Instructions reading all of SR also read the separately tracked T bit
+    // (DIV1 shifts it into Rn)
+    if(rs3[i]==SR) u&=~(1LL<<TBIT);
     // Source-target dependencies
     //uu&=~(tdep<<dep1[i]);
     //uu&=~(tdep<<dep2[i]);
@@ -4725,6 +4778,10 @@ void clean_registers(int istart,int iend,int wr)
             if((branch_regs[i].regmap[r]&63)==rt1[i+1]) wont_dirty_i|=1<<r;
             if((branch_regs[i].regmap[r]&63)==rt2[i+1]) wont_dirty_i|=1<<r;
             if(branch_regs[i].regmap[r]==CCREG) wont_dirty_i|=1<<r;
+            // A register the delay slot moved to another host register keeps
+            // the dirty state it had before the move
+            if(itype[i]!=CJUMP&&branch_regs[i].regmap[r]>=0&&branch_regs[i].regmap[r]!=regs[i].regmap[r]&&
+               get_reg(regs[i].regmap,branch_regs[i].regmap[r])>=0) wont_dirty_i|=1<<r;
             if(rt1[i]==TBIT||rt2[i]==TBIT||rt1[i+1]==TBIT||rt2[i+1]==TBIT) {
               if(regs[i].regmap[r]==SR) wont_dirty_i|=1<<r;
               if(branch_regs[i].regmap[r]==SR) wont_dirty_i|=1<<r;
@@ -4826,6 +4883,10 @@ void clean_registers(int istart,int iend,int wr)
               if((branch_regs[i].regmap[r]&63)==rt1[i+1]) temp_wont_dirty|=1<<r;
               if((branch_regs[i].regmap[r]&63)==rt2[i+1]) temp_wont_dirty|=1<<r;
               if(branch_regs[i].regmap[r]==CCREG) temp_wont_dirty|=1<<r;
+              // A register the delay slot moved to another host register keeps
+              // the dirty state it had before the move
+              if(itype[i]!=CJUMP&&branch_regs[i].regmap[r]>=0&&branch_regs[i].regmap[r]!=regs[i].regmap[r]&&
+                 get_reg(regs[i].regmap,branch_regs[i].regmap[r])>=0) temp_wont_dirty|=1<<r;
               if(rt1[i]==TBIT||rt2[i]==TBIT||rt1[i+1]==TBIT||rt2[i+1]==TBIT) {
                 if(regs[i].regmap[r]==SR) temp_wont_dirty|=1<<r;
                 if(branch_regs[i].regmap[r]==SR) temp_wont_dirty|=1<<r;
@@ -4964,6 +5025,10 @@ void clean_registers(int istart,int iend,int wr)
               if((branch_regs[i].regmap[r]&63)==rt1[i+1]) wont_dirty_i|=1<<r;
               if((branch_regs[i].regmap[r]&63)==rt2[i+1]) wont_dirty_i|=1<<r;
               if(branch_regs[i].regmap[r]==CCREG) wont_dirty_i|=1<<r;
+              // A register the delay slot moved to another host register keeps
+              // the dirty state it had before the move
+              if(itype[i]!=CJUMP&&branch_regs[i].regmap[r]>=0&&branch_regs[i].regmap[r]!=regs[i].regmap[r]&&
+                 get_reg(regs[i].regmap,branch_regs[i].regmap[r])>=0) wont_dirty_i|=1<<r;
               if(rt1[i]==TBIT||rt2[i]==TBIT||rt1[i+1]==TBIT||rt2[i+1]==TBIT) {
                 if(regs[i].regmap[r]==SR) wont_dirty_i|=1<<r;
                 if(branch_regs[i].regmap[r]==SR) wont_dirty_i|=1<<r;
@@ -5231,7 +5296,25 @@ void disassemble_inst(int i)
     }
 }
 
-void sh2_dynarec_init()
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0
+#endif
+
+// Maps memory at exactly addr without replacing anything already mapped
+// there. Kernels without MAP_FIXED_NOREPLACE treat addr as a hint, so the
+// result is checked either way.
+static int map_fixed(void *addr, size_t size, int prot)
+{
+  void *p=mmap(addr, size, prot, MAP_FIXED_NOREPLACE | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if(p==addr) return 0;
+  if(p!=MAP_FAILED) munmap(p, size);
+  printf("mmap() at %p failed\n", addr);
+  return -1;
+}
+
+// Returns -1 if the code cache or memory map can't be placed at their
+// fixed addresses, in which case the caller should use the interpreter
+int sh2_dynarec_init()
 {
   int n;
   //printf("Init new dynarec\n");
@@ -5239,10 +5322,8 @@ void sh2_dynarec_init()
   #ifdef __arm__
   mprotect(out, 1<<TARGET_SIZE_2, PROT_READ | PROT_WRITE | PROT_EXEC);
   #else
-  if (mmap (out, 1<<TARGET_SIZE_2,
-            PROT_READ | PROT_WRITE | PROT_EXEC,
-            MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS,
-            -1, 0) == MAP_FAILED) {printf("mmap() failed\n");}
+  if (map_fixed(out, 1<<TARGET_SIZE_2, PROT_READ | PROT_WRITE | PROT_EXEC) != 0)
+    return -1;
   #endif
   //for(n=0x80000;n<0x80800;n++)
   //  invalid_code[n]=1;
@@ -5259,10 +5340,12 @@ void sh2_dynarec_init()
   expirep=16384; // Expiry pointer, +2 blocks
   literalcount=0;
   stop_after_jal=0;
-  if (mmap ((void *)0x80000000, 4194304,
-            PROT_READ | PROT_WRITE,
-            MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS,
-            -1, 0) == MAP_FAILED) {printf("mmap() failed\n");}
+  if (map_fixed((void *)0x80000000, 4194304, PROT_READ | PROT_WRITE) != 0) {
+    #ifndef __arm__
+    munmap((void *)BASE_ADDR, 1<<TARGET_SIZE_2);
+    #endif
+    return -1;
+  }
 
   // This has to be done after BiosRom etc are allocated
   for(n=0;n<1048576;n++) {
@@ -5308,6 +5391,7 @@ void sh2_dynarec_init()
   slave_ip=(void *)0; // Slave not running, go directly to interrupt handler
 
   arch_init();
+  return 0;
 }
 
 void SH2DynarecReset(SH2_struct *context) {
@@ -6405,8 +6489,22 @@ int sh2_recompile_block(int addr)
           }
           else
           {
-            ooo[i]=1;
-            delayslot_alloc(&current,i+1);
+            struct regstat ds_current;
+            memcpy(&ds_current,&current,sizeof(current));
+            delayslot_alloc(&ds_current,i+1);
+            if(get_reg(ds_current.regmap,SR)>=0) {
+              ooo[i]=1;
+              memcpy(&current,&ds_current,sizeof(current));
+            }
+            else {
+              // The delay slot took the register holding the branch
+              // condition (DMULS/DMULU use fixed registers, loads and
+              // stores need temporaries).  Do the branch first.
+              minimum_free_regs[i+1]=0;
+              current.isdoingcp=0;
+              current.wasdoingcp=0;
+              regs[i].wasdoingcp=0;
+            }
           }
           ds=1;
           //current.isdoingcp=0;
@@ -6548,16 +6646,30 @@ int sh2_recompile_block(int addr)
         case SJUMP:
           alloc_cc(&current,i-1);
           dirty_reg(&current,CCREG);
-          if(rt1[i]==TBIT||rt2[i]==TBIT||rt1[i]==SR||rt2[i]==SR||itype[i]==COMPLEX) {
+          if(!ooo[i-1]) {
             // The delay slot overwrote the branch condition
             // Delay slot goes after the test (in order)
+            signed char pre_regmap[HOST_REGS];
+            u32 pre_dirty=current.dirty;
+            memcpy(pre_regmap,current.regmap,sizeof(pre_regmap));
             current.u=branch_unneeded_reg[i-1]&~((1LL<<rs1[i])|(1LL<<rs2[i]));
+            if(rs3[i]>=0) current.u&=~(1LL<<rs3[i]);
+            if(rs3[i]==SR) current.u&=~(1LL<<TBIT);
             delayslot_alloc(&current,i);
             current.isdoingcp=0;
+            // Registers evicted by a fixed allocation (DMULS/DMULU, DIV1)
+            // and reallocated elsewhere are moved by wb_invalidate, so
+            // they are still dirty if they were before
+            for(hr=0;hr<HOST_REGS;hr++) {
+              int r=current.regmap[hr],or;
+              if(r>=0&&(r&63)<TEMPREG&&(or=get_reg(pre_regmap,r))>=0)
+                if((pre_dirty>>or)&1) dirty_reg(&current,r);
+            }
           }
           else
           {
             current.u=branch_unneeded_reg[i-1]&~(1LL<<rs1[i-1]);
+            if(rs1[i-1]==TBIT) current.u&=~(1LL<<SR); // BT/S BF/S
             // Alloc the branch condition register
             alloc_reg(&current,i-1,SR);
           }
@@ -6839,7 +6951,7 @@ int sh2_recompile_block(int addr)
              itype[i+1]==RMW || itype[i+1]==PCREL ||
              itype[i+1]==SYSTEM || source[i]==0x002B /* RTE */ )
             temp1=MOREG;
-          if(itype[i+1]==COMPLEX) {
+          if(itype[i+1]==COMPLEX&&(opcode[i+1]|4)==4&&opcode2[i+1]==15) { // MAC.W/MAC.L
             temp1=MACH;
             temp2=MACL;
           }
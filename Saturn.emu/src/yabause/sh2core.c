@@ -47,8 +47,8 @@ int SH2Init(int coreid)
 {
    int i;
 
-   // MSH2
-   if ((MSH2 = (SH2_struct *)calloc(1, sizeof(SH2_struct))) == NULL)
+   // MSH2, allocated like emulated memory since the dynarec may access it directly
+   if ((MSH2 = (SH2_struct *)T1MemoryInit(sizeof(SH2_struct))) == NULL)
       return -1;
 
    if (SH2TrackInfLoopInit(MSH2) != 0)
@@ -58,7 +58,7 @@ int SH2Init(int coreid)
    MSH2->isslave = 0;
 
    // SSH2
-   if ((SSH2 = (SH2_struct *)calloc(1, sizeof(SH2_struct))) == NULL)
+   if ((SSH2 = (SH2_struct *)T1MemoryInit(sizeof(SH2_struct))) == NULL)
       return -1;
 
    if (SH2TrackInfLoopInit(SSH2) != 0)
@@ -83,8 +83,8 @@ int SH2Init(int coreid)
    }
 
    if ((SH2Core == NULL) || (SH2Core->Init() != 0)) {
-      free(MSH2);
-      free(SSH2);
+      T1MemoryDeInit((u8 *)MSH2);
+      T1MemoryDeInit((u8 *)SSH2);
       MSH2 = SSH2 = NULL;
       return -1;
    }
@@ -103,14 +103,14 @@ void SH2DeInit()
    if (MSH2)
    {
       SH2TrackInfLoopDeInit(MSH2);
-      free(MSH2);
+      T1MemoryDeInit((u8 *)MSH2);
    }
    MSH2 = NULL;
 
    if (SSH2)
    {
       SH2TrackInfLoopDeInit(SSH2);
-      free(SSH2);
+      T1MemoryDeInit((u8 *)SSH2);
    }
    SSH2 = NULL;
 }
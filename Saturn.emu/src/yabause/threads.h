@@ -33,6 +33,10 @@ enum {
    YAB_THREAD_NETLINKLISTENER,
    YAB_THREAD_NETLINKCONNECT,
    YAB_THREAD_NETLINKCLIENT,
+   YAB_THREAD_VIDSOFT_LAYER0,  // Software renderer workers (see vidsoft.c)
+   YAB_THREAD_VIDSOFT_LAYER1,
+   YAB_THREAD_VIDSOFT_LAYER2,
+   YAB_THREAD_VIDSOFT_LAYER3,
    YAB_NUM_THREADS      // Total number of subthreads
 };
 
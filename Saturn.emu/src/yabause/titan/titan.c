@@ -21,10 +21,35 @@
 
 #include <stdlib.h>
 
+/* vectorized compositing is only written for the 32-bit little endian
+   pixel layout, other configurations always use TitanDigPixel */
+#if !defined WORDS_BIGENDIAN && !defined USE_RGB_555 && !defined USE_RGB_565
+#if defined(__SSE2__)
+#define TITAN_HAVE_SSE2
+#include <emmintrin.h>
+#if defined(__GNUC__) && (defined(__clang__) || __GNUC__ >= 5)
+#define TITAN_HAVE_AVX2
+#include <immintrin.h>
+#endif
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define TITAN_HAVE_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
 /* private */
 typedef u32 (*TitanBlendFunc)(u32 top, u32 bottom);
 typedef int FASTCALL (*TitanTransFunc)(u32 pixel);
 
+/* pixels of one VDP2 layer, drawn apart from the priority framebuffers so
+   layers can be drawn concurrently and merged in drawing order afterwards */
+typedef struct {
+   u32 * pixel;
+   u8 * priority;
+   int used;
+} TitanLayer;
+
 static struct TitanContext {
    int inited;
    u32 * vdp2framebuffer[8];
@@ -33,6 +58,9 @@ static struct TitanContext {
    int vdp2height;
    TitanBlendFunc blend;
    TitanTransFunc trans;
+   TitanLayer layer[TITAN_NUM_LAYERS];
+   int blend_mode;
+   int simd;
 } tt_context = {
    0,
    { NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL },
@@ -159,6 +187,363 @@ static u32 TitanDigPixel(int priority, int pos)
    return pixel;
 }
 
+/* The vectorized versions of TitanDigPixel composite the priority levels
+   bottom-up instead of recursing from the top: for each level with a pixel,
+   the result so far is replaced by that pixel, or blended under it if it's
+   transparent. This gives the same result as TitanDigPixel, which stops at
+   the first opaque pixel. The framebuffers are cleared the same way too:
+   levels 1 to 7 always, the back screen only if no opaque pixel covers it.
+   Each function handles a multiple of its vector width and returns the
+   number of pixels done, the rest is left to TitanDigPixel. */
+
+#ifdef TITAN_HAVE_SSE2
+static INLINE __m128i TitanSelectSSE2(__m128i mask, __m128i a, __m128i b)
+{
+   return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+/* x / 0xFF for 0 <= x <= 0xFF * 0xFF */
+static INLINE __m128i TitanDiv255SSE2(__m128i x)
+{
+   return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(x, _mm_set1_epi16(1)), _mm_srli_epi16(x, 8)), 8);
+}
+
+/* (c1 * a) / 0xFF + (c2 * (0xFF - a)) / 0xFF for each color byte */
+static INLINE __m128i TitanMixSSE2(__m128i c1, __m128i c2, __m128i a)
+{
+   __m128i zero = _mm_setzero_si128();
+   __m128i ra = _mm_xor_si128(a, _mm_set1_epi8(-1));
+   __m128i lo = _mm_add_epi16(
+      TitanDiv255SSE2(_mm_mullo_epi16(_mm_unpacklo_epi8(c1, zero), _mm_unpacklo_epi8(a, zero))),
+      TitanDiv255SSE2(_mm_mullo_epi16(_mm_unpacklo_epi8(c2, zero), _mm_unpacklo_epi8(ra, zero))));
+   __m128i hi = _mm_add_epi16(
+      TitanDiv255SSE2(_mm_mullo_epi16(_mm_unpackhi_epi8(c1, zero), _mm_unpackhi_epi8(a, zero))),
+      TitanDiv255SSE2(_mm_mullo_epi16(_mm_unpackhi_epi8(c2, zero), _mm_unpackhi_epi8(ra, zero))));
+   return _mm_packus_epi16(lo, hi);
+}
+
+/* (alpha << 2) + 3 in each color byte */
+static INLINE __m128i TitanAlphaSSE2(__m128i pixel)
+{
+   __m128i a = _mm_add_epi32(_mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(pixel, 24), _mm_set1_epi32(0x3F)), 2), _mm_set1_epi32(3));
+   return _mm_or_si128(_mm_or_si128(a, _mm_slli_epi32(a, 8)), _mm_slli_epi32(a, 16));
+}
+
+static INLINE __m128i TitanTransSSE2(int mode, __m128i pixel)
+{
+   if (mode == TITAN_BLEND_TOP)
+      return _mm_cmpgt_epi32(_mm_set1_epi32(0x3F), _mm_and_si128(_mm_srli_epi32(pixel, 24), _mm_set1_epi32(0x3F)));
+   return _mm_srai_epi32(pixel, 31);
+}
+
+static INLINE __m128i TitanBlendSSE2(int mode, __m128i top, __m128i bottom)
+{
+   __m128i rgb = _mm_set1_epi32(0x00FFFFFF);
+
+   if (mode == TITAN_BLEND_BOTTOM)
+   {
+      __m128i mix = TitanMixSSE2(top, bottom, TitanAlphaSSE2(bottom));
+      mix = _mm_or_si128(_mm_and_si128(mix, rgb), _mm_and_si128(top, _mm_set1_epi32(0x3F000000)));
+      return TitanSelectSSE2(_mm_srai_epi32(top, 31), mix, top);
+   }
+   else if (mode == TITAN_BLEND_ADD)
+      return _mm_or_si128(_mm_and_si128(_mm_adds_epu8(top, bottom), rgb), _mm_set1_epi32(0x3F000000));
+   else
+      return _mm_or_si128(_mm_and_si128(TitanMixSSE2(top, bottom, TitanAlphaSSE2(top)), rgb), _mm_set1_epi32(0x3F000000));
+}
+
+static int TitanRenderSSE2(pixel_t * dispbuffer, int pos, int count)
+{
+   const int mode = tt_context.blend_mode;
+   const __m128i zero = _mm_setzero_si128();
+   const __m128i ones = _mm_cmpeq_epi32(zero, zero);
+   int i, p;
+
+   for (i = 0; i + 4 <= count; i += 4)
+   {
+      __m128i * back = (__m128i *)(tt_context.vdp2framebuffer[0] + pos + i);
+      __m128i * disp = (__m128i *)(dispbuffer + pos + i);
+      __m128i backpixel = _mm_loadu_si128(back);
+      __m128i dot = backpixel;
+      __m128i opaque = zero;
+      __m128i fixed;
+
+      for (p = 1; p < 8; p++)
+      {
+         __m128i * buffer = (__m128i *)(tt_context.vdp2framebuffer[p] + pos + i);
+         __m128i pixel = _mm_loadu_si128(buffer);
+         __m128i empty = _mm_cmpeq_epi32(pixel, zero);
+         __m128i trans;
+
+         if (_mm_movemask_epi8(empty) == 0xFFFF) continue;
+
+         trans = TitanTransSSE2(mode, pixel);
+         pixel = TitanSelectSSE2(trans, TitanBlendSSE2(mode, pixel, dot), pixel);
+         dot = TitanSelectSSE2(empty, dot, pixel);
+         opaque = _mm_or_si128(opaque, _mm_andnot_si128(_mm_or_si128(empty, trans), ones));
+         _mm_storeu_si128(buffer, zero);
+      }
+
+      _mm_storeu_si128(back, _mm_and_si128(backpixel, opaque));
+
+      fixed = _mm_or_si128(_mm_add_epi32(_mm_slli_epi32(_mm_and_si128(dot, _mm_set1_epi32(0x3F000000)), 2), _mm_set1_epi32(0x03000000)),
+                           _mm_and_si128(dot, _mm_set1_epi32(0x00FFFFFF)));
+      _mm_storeu_si128(disp, TitanSelectSSE2(_mm_cmpeq_epi32(dot, zero), _mm_loadu_si128(disp), fixed));
+   }
+
+   return i;
+}
+#endif
+
+#ifdef TITAN_HAVE_AVX2
+#define TITAN_AVX2 __attribute__((target("avx2")))
+
+static INLINE TITAN_AVX2 __m256i TitanSelectAVX2(__m256i mask, __m256i a, __m256i b)
+{
+   return _mm256_or_si256(_mm256_and_si256(mask, a), _mm256_andnot_si256(mask, b));
+}
+
+static INLINE TITAN_AVX2 __m256i TitanDiv255AVX2(__m256i x)
+{
+   return _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(x, _mm256_set1_epi16(1)), _mm256_srli_epi16(x, 8)), 8);
+}
+
+static INLINE TITAN_AVX2 __m256i TitanMixAVX2(__m256i c1, __m256i c2, __m256i a)
+{
+   __m256i zero = _mm256_setzero_si256();
+   __m256i ra = _mm256_xor_si256(a, _mm256_set1_epi8(-1));
+   __m256i lo = _mm256_add_epi16(
+      TitanDiv255AVX2(_mm256_mullo_epi16(_mm256_unpacklo_epi8(c1, zero), _mm256_unpacklo_epi8(a, zero))),
+      TitanDiv255AVX2(_mm256_mullo_epi16(_mm256_unpacklo_epi8(c2, zero), _mm256_unpacklo_epi8(ra, zero))));
+   __m256i hi = _mm256_add_epi16(
+      TitanDiv255AVX2(_mm256_mullo_epi16(_mm256_unpackhi_epi8(c1, zero), _mm256_unpackhi_epi8(a, zero))),
+      TitanDiv255AVX2(_mm256_mullo_epi16(_mm256_unpackhi_epi8(c2, zero), _mm256_unpackhi_epi8(ra, zero))));
+   return _mm256_packus_epi16(lo, hi);
+}
+
+static INLINE TITAN_AVX2 __m256i TitanAlphaAVX2(__m256i pixel)
+{
+   __m256i a = _mm256_add_epi32(_mm256_slli_epi32(_mm256_and_si256(_mm256_srli_epi32(pixel, 24), _mm256_set1_epi32(0x3F)), 2), _mm256_set1_epi32(3));
+   return _mm256_or_si256(_mm256_or_si256(a, _mm256_slli_epi32(a, 8)), _mm256_slli_epi32(a, 16));
+}
+
+static INLINE TITAN_AVX2 __m256i TitanTransAVX2(int mode, __m256i pixel)
+{
+   if (mode == TITAN_BLEND_TOP)
+      return _mm256_cmpgt_epi32(_mm256_set1_epi32(0x3F), _mm256_and_si256(_mm256_srli_epi32(pixel, 24), _mm256_set1_epi32(0x3F)));
+   return _mm256_srai_epi32(pixel, 31);
+}
+
+static INLINE TITAN_AVX2 __m256i TitanBlendAVX2(int mode, __m256i top, __m256i bottom)
+{
+   __m256i rgb = _mm256_set1_epi32(0x00FFFFFF);
+
+   if (mode == TITAN_BLEND_BOTTOM)
+   {
+      __m256i mix = TitanMixAVX2(top, bottom, TitanAlphaAVX2(bottom));
+      mix = _mm256_or_si256(_mm256_and_si256(mix, rgb), _mm256_and_si256(top, _mm256_set1_epi32(0x3F000000)));
+      return TitanSelectAVX2(_mm256_srai_epi32(top, 31), mix, top);
+   }
+   else if (mode == TITAN_BLEND_ADD)
+      return _mm256_or_si256(_mm256_and_si256(_mm256_adds_epu8(top, bottom), rgb), _mm256_set1_epi32(0x3F000000));
+   else
+      return _mm256_or_si256(_mm256_and_si256(TitanMixAVX2(top, bottom, TitanAlphaAVX2(top)), rgb), _mm256_set1_epi32(0x3F000000));
+}
+
+static TITAN_AVX2 int TitanRenderAVX2(pixel_t * dispbuffer, int pos, int count)
+{
+   const int mode = tt_context.blend_mode;
+   const __m256i zero = _mm256_setzero_si256();
+   const __m256i ones = _mm256_cmpeq_epi32(zero, zero);
+   int i, p;
+
+   for (i = 0; i + 8 <= count; i += 8)
+   {
+      __m256i * back = (__m256i *)(tt_context.vdp2framebuffer[0] + pos + i);
+      __m256i * disp = (__m256i *)(dispbuffer + pos + i);
+      __m256i backpixel = _mm256_loadu_si256(back);
+      __m256i dot = backpixel;
+      __m256i opaque = zero;
+      __m256i fixed;
+
+      for (p = 1; p < 8; p++)
+      {
+         __m256i * buffer = (__m256i *)(tt_context.vdp2framebuffer[p] + pos + i);
+         __m256i pixel = _mm256_loadu_si256(buffer);
+         __m256i empty = _mm256_cmpeq_epi32(pixel, zero);
+         __m256i trans;
+
+         if (_mm256_movemask_epi8(empty) == -1) continue;
+
+         trans = TitanTransAVX2(mode, pixel);
+         pixel = TitanSelectAVX2(trans, TitanBlendAVX2(mode, pixel, dot), pixel);
+         dot = TitanSelectAVX2(empty, dot, pixel);
+         opaque = _mm256_or_si256(opaque, _mm256_andnot_si256(_mm256_or_si256(empty, trans), ones));
+         _mm256_storeu_si256(buffer, zero);
+      }
+
+      _mm256_storeu_si256(back, _mm256_and_si256(backpixel, opaque));
+
+      fixed = _mm256_or_si256(_mm256_add_epi32(_mm256_slli_epi32(_mm256_and_si256(dot, _mm256_set1_epi32(0x3F000000)), 2), _mm256_set1_epi32(0x03000000)),
+                              _mm256_and_si256(dot, _mm256_set1_epi32(0x00FFFFFF)));
+      _mm256_storeu_si256(disp, TitanSelectAVX2(_mm256_cmpeq_epi32(dot, zero), _mm256_loadu_si256(disp), fixed));
+   }
+
+   return i;
+}
+#endif
+
+#ifdef TITAN_HAVE_NEON
+static INLINE uint16x8_t TitanDiv255NEON(uint16x8_t x)
+{
+   return vshrq_n_u16(vaddq_u16(vaddq_u16(x, vdupq_n_u16(1)), vshrq_n_u16(x, 8)), 8);
+}
+
+static INLINE uint32x4_t TitanMixNEON(uint32x4_t c1, uint32x4_t c2, uint32x4_t a)
+{
+   uint8x16_t b1 = vreinterpretq_u8_u32(c1);
+   uint8x16_t b2 = vreinterpretq_u8_u32(c2);
+   uint8x16_t ba = vreinterpretq_u8_u32(a);
+   uint8x16_t bra = vmvnq_u8(ba);
+   uint16x8_t lo = vaddq_u16(TitanDiv255NEON(vmull_u8(vget_low_u8(b1), vget_low_u8(ba))),
+                             TitanDiv255NEON(vmull_u8(vget_low_u8(b2), vget_low_u8(bra))));
+   uint16x8_t hi = vaddq_u16(TitanDiv255NEON(vmull_u8(vget_high_u8(b1), vget_high_u8(ba))),
+                             TitanDiv255NEON(vmull_u8(vget_high_u8(b2), vget_high_u8(bra))));
+   return vreinterpretq_u32_u8(vcombine_u8(vmovn_u16(lo), vmovn_u16(hi)));
+}
+
+static INLINE uint32x4_t TitanAlphaNEON(uint32x4_t pixel)
+{
+   uint32x4_t a = vaddq_u32(vshlq_n_u32(vandq_u32(vshrq_n_u32(pixel, 24), vdupq_n_u32(0x3F)), 2), vdupq_n_u32(3));
+   return vorrq_u32(vorrq_u32(a, vshlq_n_u32(a, 8)), vshlq_n_u32(a, 16));
+}
+
+static INLINE uint32x4_t TitanTransNEON(int mode, uint32x4_t pixel)
+{
+   if (mode == TITAN_BLEND_TOP)
+      return vcltq_u32(vandq_u32(vshrq_n_u32(pixel, 24), vdupq_n_u32(0x3F)), vdupq_n_u32(0x3F));
+   return vreinterpretq_u32_s32(vshrq_n_s32(vreinterpretq_s32_u32(pixel), 31));
+}
+
+static INLINE uint32x4_t TitanBlendNEON(int mode, uint32x4_t top, uint32x4_t bottom)
+{
+   uint32x4_t rgb = vdupq_n_u32(0x00FFFFFF);
+
+   if (mode == TITAN_BLEND_BOTTOM)
+   {
+      uint32x4_t mix = TitanMixNEON(top, bottom, TitanAlphaNEON(bottom));
+      mix = vorrq_u32(vandq_u32(mix, rgb), vandq_u32(top, vdupq_n_u32(0x3F000000)));
+      return vbslq_u32(vreinterpretq_u32_s32(vshrq_n_s32(vreinterpretq_s32_u32(top), 31)), mix, top);
+   }
+   else if (mode == TITAN_BLEND_ADD)
+      return vorrq_u32(vandq_u32(vreinterpretq_u32_u8(vqaddq_u8(vreinterpretq_u8_u32(top), vreinterpretq_u8_u32(bottom))), rgb), vdupq_n_u32(0x3F000000));
+   else
+      return vorrq_u32(vandq_u32(TitanMixNEON(top, bottom, TitanAlphaNEON(top)), rgb), vdupq_n_u32(0x3F000000));
+}
+
+static int TitanRenderNEON(pixel_t * dispbuffer, int pos, int count)
+{
+   const int mode = tt_context.blend_mode;
+   const uint32x4_t zero = vdupq_n_u32(0);
+   int i, p;
+
+   for (i = 0; i + 4 <= count; i += 4)
+   {
+      u32 * back = tt_context.vdp2framebuffer[0] + pos + i;
+      u32 * disp = dispbuffer + pos + i;
+      uint32x4_t backpixel = vld1q_u32(back);
+      uint32x4_t dot = backpixel;
+      uint32x4_t opaque = zero;
+      uint32x4_t fixed;
+
+      for (p = 1; p < 8; p++)
+      {
+         u32 * buffer = tt_context.vdp2framebuffer[p] + pos + i;
+         uint32x4_t pixel = vld1q_u32(buffer);
+         uint32x4_t empty = vceqq_u32(pixel, zero);
+         uint32x2_t allempty = vand_u32(vget_low_u32(empty), vget_high_u32(empty));
+         uint32x4_t trans;
+
+         if ((vget_lane_u32(allempty, 0) & vget_lane_u32(allempty, 1)) == 0xFFFFFFFF) continue;
+
+         trans = TitanTransNEON(mode, pixel);
+         pixel = vbslq_u32(trans, TitanBlendNEON(mode, pixel, dot), pixel);
+         dot = vbslq_u32(empty, dot, pixel);
+         opaque = vorrq_u32(opaque, vmvnq_u32(vorrq_u32(empty, trans)));
+         vst1q_u32(buffer, zero);
+      }
+
+      vst1q_u32(back, vandq_u32(backpixel, opaque));
+
+      fixed = vorrq_u32(vaddq_u32(vshlq_n_u32(vandq_u32(dot, vdupq_n_u32(0x3F000000)), 2), vdupq_n_u32(0x03000000)),
+                        vandq_u32(dot, vdupq_n_u32(0x00FFFFFF)));
+      vst1q_u32(disp, vbslq_u32(vceqq_u32(dot, zero), vld1q_u32(disp), fixed));
+   }
+
+   return i;
+}
+#endif
+
+static int TitanSimdSupported(int simd)
+{
+   switch (simd)
+   {
+      case TITAN_SIMD_NONE:
+         return 1;
+#ifdef TITAN_HAVE_SSE2
+      case TITAN_SIMD_SSE2:
+         return 1;
+#endif
+#ifdef TITAN_HAVE_AVX2
+      case TITAN_SIMD_AVX2:
+         return __builtin_cpu_supports("avx2");
+#endif
+#ifdef TITAN_HAVE_NEON
+      case TITAN_SIMD_NEON:
+         return 1;
+#endif
+      default:
+         return 0;
+   }
+}
+
+/* composites pixels pos to pos + count - 1 of the priority framebuffers */
+static void TitanRenderPixels(pixel_t * dispbuffer, int pos, int count)
+{
+   int i = 0;
+   u32 dot;
+
+   switch (tt_context.simd)
+   {
+#ifdef TITAN_HAVE_SSE2
+      case TITAN_SIMD_SSE2:
+         i = TitanRenderSSE2(dispbuffer, pos, count);
+         break;
+#endif
+#ifdef TITAN_HAVE_AVX2
+      case TITAN_SIMD_AVX2:
+         i = TitanRenderAVX2(dispbuffer, pos, count);
+         break;
+#endif
+#ifdef TITAN_HAVE_NEON
+      case TITAN_SIMD_NEON:
+         i = TitanRenderNEON(dispbuffer, pos, count);
+         break;
+#endif
+      default:
+         break;
+   }
+
+   for (; i < count; i++)
+   {
+      dot = TitanDigPixel(7, pos + i);
+      if (dot)
+      {
+         dispbuffer[pos + i] = TitanFixAlpha(dot);
+      }
+   }
+}
+
 /* public */
 int TitanInit()
 {
@@ -188,6 +573,8 @@ int TitanInit()
    for(i = 1;i < 4;i++)
       memset(tt_context.linescreen[i], 0, sizeof(u32) * 512);
 
+   TitanSetSimd(TitanGetBestSimd());
+
    return 0;
 }
 
@@ -201,9 +588,70 @@ int TitanDeInit()
    for(i = 1;i < 4;i++)
       free(tt_context.linescreen[i]);
 
+   for(i = 0;i < TITAN_NUM_LAYERS;i++)
+   {
+      free(tt_context.layer[i].pixel);
+      free(tt_context.layer[i].priority);
+      tt_context.layer[i].pixel = NULL;
+      tt_context.layer[i].priority = NULL;
+   }
+
+   return 0;
+}
+
+/* layer buffers are only needed by the threaded renderer, so they're
+   allocated on first use rather than by TitanInit */
+int TitanInitLayers(void)
+{
+   int i;
+
+   for(i = 0;i < TITAN_NUM_LAYERS;i++)
+   {
+      TitanLayer * layer = &tt_context.layer[i];
+
+      if (layer->pixel != NULL)
+         continue;
+
+      layer->pixel = (u32 *)malloc(sizeof(u32) * 704 * 512);
+      layer->priority = (u8 *)calloc(sizeof(u8), 704 * 512);
+      layer->used = 0;
+      if ((layer->pixel == NULL) || (layer->priority == NULL))
+      {
+         free(layer->pixel);
+         free(layer->priority);
+         layer->pixel = NULL;
+         layer->priority = NULL;
+         return -1;
+      }
+   }
+
    return 0;
 }
 
+int TitanGetBestSimd(void)
+{
+   if (TitanSimdSupported(TITAN_SIMD_AVX2))
+      return TITAN_SIMD_AVX2;
+   if (TitanSimdSupported(TITAN_SIMD_SSE2))
+      return TITAN_SIMD_SSE2;
+   if (TitanSimdSupported(TITAN_SIMD_NEON))
+      return TITAN_SIMD_NEON;
+   return TITAN_SIMD_NONE;
+}
+
+int TitanSetSimd(int simd)
+{
+   if (! TitanSimdSupported(simd))
+      simd = TITAN_SIMD_NONE;
+   tt_context.simd = simd;
+   return simd;
+}
+
+int TitanGetSimd(void)
+{
+   return tt_context.simd;
+}
+
 void TitanSetResolution(int width, int height)
 {
    tt_context.vdp2width = width;
@@ -218,6 +666,7 @@ void TitanGetResolution(int * width, int * height)
 
 void TitanSetBlendingMode(int blend_mode)
 {
+   tt_context.blend_mode = blend_mode;
    if (blend_mode == TITAN_BLEND_BOTTOM)
    {
       tt_context.blend = TitanBlendPixelsBottom;
@@ -269,6 +718,45 @@ void TitanPutPixel(int priority, s32 x, s32 y, u32 color, int linescreen)
    }
 }
 
+void TitanPutLayerPixel(int layer, int priority, s32 x, s32 y, u32 color, int linescreen)
+{
+   if (priority == 0) return;
+
+   {
+      int pos = (y * tt_context.vdp2width) + x;
+      TitanLayer * l = &tt_context.layer[layer];
+      if (linescreen)
+         color = TitanBlendPixelsTop(color, tt_context.linescreen[linescreen][y]);
+      l->pixel[pos] = color;
+      l->priority[pos] = priority;
+      l->used = 1;
+   }
+}
+
+/* same result as if the layer's pixels had been put with TitanPutPixel,
+   provided layers are merged in the order they would have been drawn */
+void TitanMergeLayer(int layer)
+{
+   TitanLayer * l = &tt_context.layer[layer];
+   int i;
+
+   if (! l->used) return;
+
+   for (i = 0; i < (tt_context.vdp2width * tt_context.vdp2height); i++)
+   {
+      if (l->priority[i])
+      {
+         u32 * buffer = tt_context.vdp2framebuffer[l->priority[i]] + i;
+         u32 color = l->pixel[i];
+         if (tt_context.trans(color) && *buffer)
+            color = tt_context.blend(color, *buffer);
+         *buffer = color;
+         l->priority[i] = 0;
+      }
+   }
+   l->used = 0;
+}
+
 void TitanPutHLine(int priority, s32 x, s32 y, s32 width, u32 color)
 {
    if (priority == 0) return;
@@ -295,17 +783,17 @@ void TitanPutShadow(int priority, s32 x, s32 y)
 
 void TitanRender(pixel_t * dispbuffer)
 {
-   u32 dot;
-   int i;
+   TitanRenderLines(dispbuffer, 0, tt_context.vdp2height);
+}
 
-   for (i = 0; i < (tt_context.vdp2width * tt_context.vdp2height); i++)
-   {
-      dot = TitanDigPixel(7, i);
-      if (dot)
-      {
-         dispbuffer[i] = TitanFixAlpha(dot);
-      }
-   }
+/* each pixel is composited independently, so bands of lines can be
+   rendered concurrently */
+void TitanRenderLines(pixel_t * dispbuffer, int start_line, int end_line)
+{
+   int y;
+
+   for (y = start_line; y < end_line; y++)
+      TitanRenderPixels(dispbuffer, y * tt_context.vdp2width, tt_context.vdp2width);
 }
 
 #ifdef WORDS_BIGENDIAN
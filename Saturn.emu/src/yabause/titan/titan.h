@@ -26,9 +26,25 @@
 #define TITAN_BLEND_BOTTOM  1
 #define TITAN_BLEND_ADD     2
 
+#define TITAN_SIMD_NONE     0
+#define TITAN_SIMD_SSE2     1
+#define TITAN_SIMD_AVX2     2
+#define TITAN_SIMD_NEON     3
+
+#define TITAN_NBG0          0
+#define TITAN_NBG1          1
+#define TITAN_NBG2          2
+#define TITAN_NBG3          3
+#define TITAN_RBG0          4
+#define TITAN_NUM_LAYERS    5
+
 int TitanInit();
 int TitanDeInit();
 
+int TitanGetBestSimd(void);
+int TitanSetSimd(int simd);
+int TitanGetSimd(void);
+
 void TitanSetResolution(int width, int height);
 void TitanGetResolution(int * width, int * height);
 
@@ -43,7 +59,12 @@ void TitanPutHLine(int priority, s32 x, s32 y, s32 width, u32 color);
 
 void TitanPutShadow(int priority, s32 x, s32 y);
 
+int TitanInitLayers(void);
+void TitanPutLayerPixel(int layer, int priority, s32 x, s32 y, u32 color, int linescreen);
+void TitanMergeLayer(int layer);
+
 void TitanRender(pixel_t * dispbuffer);
+void TitanRenderLines(pixel_t * dispbuffer, int start_line, int end_line);
 
 void TitanWriteColor(pixel_t * dispbuffer, s32 bufwidth, s32 x, s32 y, u32 color);
 
@@ -179,6 +179,9 @@ typedef struct
    u32 LineColorBase;
    
    void (*LoadLineParams)(void *, int line);
+
+   // Titan layer buffer to draw into (vidsoft only, -1 = draw directly)
+   int titanlayer;
 } vdp2draw_struct;
 
 
@@ -25,6 +25,7 @@
 #include "debug.h"
 #include "vdp2.h"
 #include "titan/titan.h"
+#include "threads.h"
 
 #ifdef HAVE_LIBGL
 #define USE_OPENGL
@@ -163,6 +164,8 @@ static int outputheight;
 static int resxratio;
 static int resyratio;
 
+static int mosaic_table[16][1024];
+
 typedef struct { s16 x; s16 y; } vdp1vertex;
 
 typedef struct
@@ -623,6 +626,16 @@ static INLINE void SetupScreenVars(vdp2draw_struct *info, screeninfo_struct *sin
 
 //////////////////////////////////////////////////////////////////////////////
 
+static INLINE void Vdp2PutPixel(vdp2draw_struct *info, s32 x, s32 y, u32 color)
+{
+   if (info->titanlayer < 0)
+      TitanPutPixel(info->priority, x, y, color, info->linescreen);
+   else
+      TitanPutLayerPixel(info->titanlayer, info->priority, x, y, color, info->linescreen);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
 static u8 FASTCALL GetAlpha(vdp2draw_struct * info, u32 color)
 {
    if (((info->specialcolormode == 1) || (info->specialcolormode == 2)) && ((info->specialcolorfunction & 1) == 0)) {
@@ -668,18 +681,6 @@ static void FASTCALL Vdp2DrawScroll(vdp2draw_struct *info)
    /* color calculation window: in => no color calc, out => color calc */
    ReadWindowData(Vdp2Regs->WCTLD >> 8, colorcalcwindow);
    {
-	   static int tables_initialized = 0;
-	   static int mosaic_table[16][1024];
-	   if(!tables_initialized)
-	   {
-		   tables_initialized = 1;
-			for(i=0;i<16;i++)
-			{
-				int m = i+1;
-				for(j=0;j<1024;j++)
-					mosaic_table[i][j] = j/m*m;
-			}
-	   }
 	   mosaic_x = mosaic_table[info->mosaicxmask-1];
 	   mosaic_y = mosaic_table[info->mosaicymask-1];
    }
@@ -786,7 +787,7 @@ static void FASTCALL Vdp2DrawScroll(vdp2draw_struct *info)
             else
                alpha = GetAlpha(info, color);
 
-            TitanPutPixel(info->priority, i, j, info->PostPixelFetchCalc(info, COLSAT2YAB32(alpha, color)), info->linescreen);
+            Vdp2PutPixel(info, i, j, info->PostPixelFetchCalc(info, COLSAT2YAB32(alpha, color)));
          }
       }
    }    
@@ -861,7 +862,7 @@ static void FASTCALL Vdp2DrawRotationFP(vdp2draw_struct *info, vdp2rotationparam
                   continue;
                }
 
-               TitanPutPixel(info->priority, i, j, info->PostPixelFetchCalc(info, COLSAT2YAB32(GetAlpha(info, color), color)), info->linescreen);
+               Vdp2PutPixel(info, i, j, info->PostPixelFetchCalc(info, COLSAT2YAB32(GetAlpha(info, color), color)));
             }
             xmul += p->deltaXst;
             ymul += p->deltaYst;
@@ -1059,7 +1060,7 @@ static void FASTCALL Vdp2DrawRotationFP(vdp2draw_struct *info, vdp2rotationparam
                continue;
             }
 
-            TitanPutPixel(info->priority, i, j, info->PostPixelFetchCalc(info, COLSAT2YAB32(GetAlpha(info, color), color)), info->linescreen);
+            Vdp2PutPixel(info, i, j, info->PostPixelFetchCalc(info, COLSAT2YAB32(GetAlpha(info, color), color)));
          }
          xmul += p->deltaXst;
          ymul += p->deltaYst;
@@ -1187,11 +1188,13 @@ static void LoadLineParamsNBG0(vdp2draw_struct * info, int line)
 
 //////////////////////////////////////////////////////////////////////////////
 
-static void Vdp2DrawNBG0(void)
+static void Vdp2DrawNBG0(int layerbuffer)
 {
    vdp2draw_struct info;
    vdp2rotationparameterfp_struct parameter[2];
 
+   info.titanlayer = layerbuffer ? TITAN_NBG0 : -1;
+
    parameter[0].PlaneAddr = (void FASTCALL (*)(void *, int))&Vdp2ParameterAPlaneAddr;
    parameter[1].PlaneAddr = (void FASTCALL (*)(void *, int))&Vdp2ParameterBPlaneAddr;
 
@@ -1335,10 +1338,12 @@ static void LoadLineParamsNBG1(vdp2draw_struct * info, int line)
 
 //////////////////////////////////////////////////////////////////////////////
 
-static void Vdp2DrawNBG1(void)
+static void Vdp2DrawNBG1(int layerbuffer)
 {
    vdp2draw_struct info;
 
+   info.titanlayer = layerbuffer ? TITAN_NBG1 : -1;
+
    info.enable = Vdp2Regs->BGON & 0x2;
    info.transparencyenable = !(Vdp2Regs->BGON & 0x200);
    info.specialprimode = (Vdp2Regs->SFPRMD >> 2) & 0x3;
@@ -1436,10 +1441,12 @@ static void LoadLineParamsNBG2(vdp2draw_struct * info, int line)
 
 //////////////////////////////////////////////////////////////////////////////
 
-static void Vdp2DrawNBG2(void)
+static void Vdp2DrawNBG2(int layerbuffer)
 {
    vdp2draw_struct info;
 
+   info.titanlayer = layerbuffer ? TITAN_NBG2 : -1;
+
    info.enable = Vdp2Regs->BGON & 0x4;
    info.transparencyenable = !(Vdp2Regs->BGON & 0x400);
    info.specialprimode = (Vdp2Regs->SFPRMD >> 4) & 0x3;
@@ -1503,10 +1510,12 @@ static void LoadLineParamsNBG3(vdp2draw_struct * info, int line)
 
 //////////////////////////////////////////////////////////////////////////////
 
-static void Vdp2DrawNBG3(void)
+static void Vdp2DrawNBG3(int layerbuffer)
 {
    vdp2draw_struct info;
 
+   info.titanlayer = layerbuffer ? TITAN_NBG3 : -1;
+
    info.enable = Vdp2Regs->BGON & 0x8;
    info.transparencyenable = !(Vdp2Regs->BGON & 0x800);
    info.specialprimode = (Vdp2Regs->SFPRMD >> 6) & 0x3;
@@ -1572,11 +1581,13 @@ static void LoadLineParamsRBG0(vdp2draw_struct * info, int line)
 
 //////////////////////////////////////////////////////////////////////////////
 
-static void Vdp2DrawRBG0(void)
+static void Vdp2DrawRBG0(int layerbuffer)
 {
    vdp2draw_struct info;
    vdp2rotationparameterfp_struct parameter[2];
 
+   info.titanlayer = layerbuffer ? TITAN_RBG0 : -1;
+
    parameter[0].PlaneAddr = (void FASTCALL (*)(void *, int))&Vdp2ParameterAPlaneAddr;
    parameter[1].PlaneAddr = (void FASTCALL (*)(void *, int))&Vdp2ParameterBPlaneAddr;
 
@@ -1690,6 +1701,197 @@ static void LoadLineParamsSprite(vdp2draw_struct * info, int line)
    ReadVdp2ColorOffset(regs, info, 0x40, 0x40);
 }
 
+//////////////////////////////////////////////////////////////////////////////
+// Layer threads
+//
+// With layer threads enabled, VIDSoftVdp2DrawScreens() draws each VDP2
+// layer as a separate task into its own Titan layer buffer, and the
+// buffers are then merged in the same order the layers are drawn in
+// single-threaded mode, so the output doesn't change. The final Titan
+// composite in VIDSoftVdp2DrawEnd() is split into bands of lines the same
+// way. Tasks are run both by the worker threads and by the emulation
+// thread, so a worker that misses its wakeup only costs parallelism.
+//////////////////////////////////////////////////////////////////////////////
+
+#define VIDSOFT_MAX_LAYER_THREADS 4
+#define VIDSOFT_MAX_TASKS 8
+
+enum { TASK_IDLE = 0, TASK_PENDING, TASK_RUNNING, TASK_DONE };
+
+static struct
+{
+   void (*func[VIDSOFT_MAX_TASKS])(int arg);
+   int arg[VIDSOFT_MAX_TASKS];
+   volatile int state[VIDSOFT_MAX_TASKS];
+   int numtasks;
+   int numthreads;
+   volatile int requestedthreads;
+   volatile int running;
+   volatile int exited[VIDSOFT_MAX_LAYER_THREADS];
+   int numbands;
+} vidsoftthreads;
+
+static void (* const Vdp2DrawLayer[TITAN_NUM_LAYERS])(int layerbuffer) =
+{
+   Vdp2DrawNBG0, Vdp2DrawNBG1, Vdp2DrawNBG2, Vdp2DrawNBG3, Vdp2DrawRBG0
+};
+
+static int VidsoftRunPendingTasks(void)
+{
+   int i, ran = 0;
+
+   for (i = 0; i < VIDSOFT_MAX_TASKS; i++)
+   {
+      if (vidsoftthreads.state[i] == TASK_PENDING &&
+          __sync_bool_compare_and_swap(&vidsoftthreads.state[i], TASK_PENDING, TASK_RUNNING))
+      {
+         vidsoftthreads.func[i](vidsoftthreads.arg[i]);
+         __sync_synchronize();
+         vidsoftthreads.state[i] = TASK_DONE;
+         ran = 1;
+      }
+   }
+
+   return ran;
+}
+
+static void VidsoftLayerThread(void *data)
+{
+   int id = (int)(pointer)data;
+
+   while (vidsoftthreads.running)
+   {
+      if (!VidsoftRunPendingTasks())
+         YabThreadSleep();
+   }
+
+   vidsoftthreads.exited[id] = 1;
+}
+
+static void VidsoftStopThreads(void)
+{
+   int i;
+
+   if (vidsoftthreads.numthreads == 0)
+      return;
+
+   vidsoftthreads.running = 0;
+   for (i = 0; i < vidsoftthreads.numthreads; i++)
+   {
+      while (!vidsoftthreads.exited[i])
+      {
+         YabThreadWake(YAB_THREAD_VIDSOFT_LAYER0 + i);
+         YabThreadYield();
+      }
+      YabThreadWait(YAB_THREAD_VIDSOFT_LAYER0 + i);
+   }
+   vidsoftthreads.numthreads = 0;
+}
+
+static void VidsoftUpdateThreads(void)
+{
+   int num = vidsoftthreads.requestedthreads;
+   int i;
+
+   if (num == vidsoftthreads.numthreads)
+      return;
+
+   VidsoftStopThreads();
+   if (num == 0 || TitanInitLayers() != 0)
+      return;
+
+   vidsoftthreads.running = 1;
+   for (i = 0; i < num; i++)
+   {
+      vidsoftthreads.exited[i] = 0;
+      if (YabThreadStart(YAB_THREAD_VIDSOFT_LAYER0 + i, VidsoftLayerThread, (void *)(pointer)i) != 0)
+      {
+         vidsoftthreads.exited[i] = 1;
+         break;
+      }
+   }
+   vidsoftthreads.numthreads = i;
+   // don't retry a failed start every frame
+   vidsoftthreads.requestedthreads = i;
+}
+
+static void VidsoftAddTask(void (*func)(int arg), int arg)
+{
+   vidsoftthreads.func[vidsoftthreads.numtasks] = func;
+   vidsoftthreads.arg[vidsoftthreads.numtasks] = arg;
+   vidsoftthreads.numtasks++;
+}
+
+static void VidsoftRunTasks(void)
+{
+   int i;
+
+   __sync_synchronize();
+   for (i = 0; i < vidsoftthreads.numtasks; i++)
+      vidsoftthreads.state[i] = TASK_PENDING;
+   for (i = 0; i < vidsoftthreads.numthreads; i++)
+      YabThreadWake(YAB_THREAD_VIDSOFT_LAYER0 + i);
+
+   VidsoftRunPendingTasks();
+
+   for (i = 0; i < vidsoftthreads.numtasks; i++)
+   {
+      while (vidsoftthreads.state[i] != TASK_DONE)
+         YabThreadYield();
+   }
+   __sync_synchronize();
+
+   for (i = 0; i < vidsoftthreads.numtasks; i++)
+      vidsoftthreads.state[i] = TASK_IDLE;
+   vidsoftthreads.numtasks = 0;
+}
+
+static void VidsoftDrawLayerTask(int layer)
+{
+   Vdp2DrawLayer[layer](1);
+}
+
+static void VidsoftRenderTask(int band)
+{
+   int start = vdp2height * band / vidsoftthreads.numbands;
+   int end = vdp2height * (band + 1) / vidsoftthreads.numbands;
+
+   TitanRenderLines(dispbuffer, start, end);
+}
+
+// RBG0 and RBG1 both write line color screen 3 while drawing, so they
+// can only be drawn concurrently when at most one of them uses it
+static int VidsoftLineScreenShared(void)
+{
+   return (Vdp2Regs->BGON & 0x20) && (Vdp2Regs->BGON & 0x10) &&
+          (Vdp2Regs->LNCLEN & 0x11) == 0x11 && (Vdp2Regs->KTCTL & 0x1000);
+}
+
+void VIDSoftSetLayerThreads(int num)
+{
+   if (num < 0)
+      num = 0;
+   else if (num > VIDSOFT_MAX_LAYER_THREADS)
+      num = VIDSOFT_MAX_LAYER_THREADS;
+
+   // applied on the emulation thread by the next VIDSoftVdp2DrawScreens()
+   vidsoftthreads.requestedthreads = num;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void Vdp2InitMosaicTable(void)
+{
+   int i, j;
+
+   for (i = 0; i < 16; i++)
+   {
+      int m = i + 1;
+      for (j = 0; j < 1024; j++)
+         mosaic_table[i][j] = j / m * m;
+   }
+}
+
 //////////////////////////////////////////////////////////////////////////////
 
 int VIDSoftInit(void)
@@ -1713,6 +1915,8 @@ int VIDSoftInit(void)
    vdp2width = 320;
    vdp2height = 224;
 
+   Vdp2InitMosaicTable();
+
 #ifdef USE_OPENGL
    glClear(GL_COLOR_BUFFER_BIT);
 
@@ -1734,6 +1938,8 @@ int VIDSoftInit(void)
 
 void VIDSoftDeInit(void)
 {
+   VidsoftStopThreads();
+
    if (dispbuffer)
    {
       free(dispbuffer);
@@ -3075,7 +3281,16 @@ void VIDSoftVdp2DrawEnd(void)
          }
       }
    }
-   TitanRender(dispbuffer);
+
+   if (vidsoftthreads.numthreads > 0)
+   {
+      vidsoftthreads.numbands = vidsoftthreads.numthreads + 1;
+      for (i = 0; i < vidsoftthreads.numbands; i++)
+         VidsoftAddTask(VidsoftRenderTask, i);
+      VidsoftRunTasks();
+   }
+   else
+      TitanRender(dispbuffer);
 
    VIDSoftVdp1SwapFrameBuffer();
 
@@ -3112,18 +3327,48 @@ void VIDSoftVdp2DrawScreens(void)
    VIDSoftVdp2SetPriorityNBG3((Vdp2Regs->PRINB >> 8) & 0x7);
    VIDSoftVdp2SetPriorityRBG0(Vdp2Regs->PRIR & 0x7);
 
+   VidsoftUpdateThreads();
+
+   if (vidsoftthreads.numthreads > 0 && !VidsoftLineScreenShared())
+   {
+      int order[TITAN_NUM_LAYERS];
+      int numlayers = 0;
+
+      for (i = 7; i > 0; i--)
+      {
+         if (nbg3priority == i)
+            order[numlayers++] = TITAN_NBG3;
+         if (nbg2priority == i)
+            order[numlayers++] = TITAN_NBG2;
+         if (nbg1priority == i)
+            order[numlayers++] = TITAN_NBG1;
+         if (nbg0priority == i)
+            order[numlayers++] = TITAN_NBG0;
+         if (rbg0priority == i)
+            order[numlayers++] = TITAN_RBG0;
+      }
+
+      for (i = 0; i < numlayers; i++)
+         VidsoftAddTask(VidsoftDrawLayerTask, order[i]);
+      VidsoftRunTasks();
+
+      for (i = 0; i < numlayers; i++)
+         TitanMergeLayer(order[i]);
+      return;
+   }
+
    for (i = 7; i > 0; i--)
    {   
       if (nbg3priority == i)
-         Vdp2DrawNBG3();
+         Vdp2DrawNBG3(0);
       if (nbg2priority == i)
-         Vdp2DrawNBG2();
+         Vdp2DrawNBG2(0);
       if (nbg1priority == i)
-         Vdp2DrawNBG1();
+         Vdp2DrawNBG1(0);
       if (nbg0priority == i)
-         Vdp2DrawNBG0();
+         Vdp2DrawNBG0(0);
       if (rbg0priority == i)
-         Vdp2DrawRBG0();
+         Vdp2DrawRBG0(0);
    }
 }
 
@@ -3140,19 +3385,19 @@ void VIDSoftVdp2DrawScreen(int screen)
    switch(screen)
    {
       case 0:
-         Vdp2DrawNBG0();
+         Vdp2DrawNBG0(0);
          break;
       case 1:
-         Vdp2DrawNBG1();
+         Vdp2DrawNBG1(0);
          break;
       case 2:
-         Vdp2DrawNBG2();
+         Vdp2DrawNBG2(0);
          break;
       case 3:
-         Vdp2DrawNBG3();
+         Vdp2DrawNBG3(0);
          break;
       case 4:
-         Vdp2DrawRBG0();
+         Vdp2DrawRBG0(0);
          break;
    }
 }
@@ -29,5 +29,6 @@ extern pixel_t *dispbuffer;
 extern VideoInterface_struct VIDSoft;
 
 void VIDSoftVdp2DrawScreen(int screen);
+void VIDSoftSetLayerThreads(int num);
 
 #endif
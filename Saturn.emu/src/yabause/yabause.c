@@ -73,6 +73,7 @@
 
 #if defined(SH2_DYNAREC)
 #include "sh2_dynarec/sh2_dynarec.h"
+#include "sh2int.h"
 #endif
 
 #if HAVE_GDBSTUB
@@ -258,7 +259,11 @@ int YabauseInit(yabauseinit_struct *init)
 
    #if defined(SH2_DYNAREC)
    if(SH2Core->id==2) {
-     sh2_dynarec_init();
+     if (sh2_dynarec_init() != 0) {
+       // Code cache couldn't be mapped, run the interpreter instead
+       SH2Core = &SH2Interpreter;
+       SH2Core->Init();
+     }
    }
    #endif
 
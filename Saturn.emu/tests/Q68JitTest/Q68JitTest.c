@@ -0,0 +1,486 @@
+/*  This file is part of Saturn.emu.
+
+	Saturn.emu is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Saturn.emu is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with Saturn.emu.  If not, see <http://www.gnu.org/licenses/> */
+
+// Runs randomly generated 68000 programs through the Q68 interpreter and
+// the Q68 JIT and checks they end with the same registers and sound RAM.
+// Programs mix ALU, BCD, multiply/divide, shift, bit and memory
+// instructions with conditional skips, DBcc loops, subroutine calls and
+// stores that rewrite already translated code. After each block the
+// registers and SR are pushed to a results area so any divergence is kept
+// in RAM. Each run is split into randomly sized q68_run() slices, and
+// after the program ends the host rewrites a translated subroutine, calls
+// q68_touch_memory() and runs the program again.
+// Build & run from Saturn.emu (x86_64, drop -DCPU_X64=1 on x86; Q68's only
+// other JIT back end is the PSP one):
+// cd src/yabause/q68 && cc -O2 -w -DQ68_USE_JIT=1 -DCPU_X64=1 -I. ../../../tests/Q68JitTest/Q68JitTest.c \
+//  q68.c q68-core.c q68-disasm.c q68-jit.c q68-jit-x86.S -o /tmp/Q68JitTest && /tmp/Q68JitTest [programs]
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "q68.h"
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+
+#define CHECK(cond) do { if(!(cond)) { fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); exit(1); } } while(0)
+
+enum
+{
+	RAM_SIZE = 0x80000, // sound RAM
+	CODE_ADDR = 0x400,
+	SUBS_ADDR = 0x30000, // subroutines rewritten by the program
+	HOST_SUB_ADDR = 0x38000, // subroutine rewritten by the host between passes
+	SCRATCH_ADDR = 0x40000, // A0-A3, random loads/stores within the first 256 bytes
+	RESULTS_ADDR = 0x70000, // A5, registers pushed downwards after each block
+	STACK_ADDR = 0x7FF00,
+	MAX_CODE_WORDS = 0x8000,
+	MAX_SUBS = 16,
+	BLOCKS = 300,
+	PUSHED_WORDS = 11 * 2 + 1, // D0-D6 & A0-A3 longs, then SR
+	MAX_SLICES = 100000,
+};
+
+typedef struct
+{
+	u16 code[MAX_CODE_WORDS];
+	unsigned codeWords;
+	u32 initRegs[11]; // D0-D6 & A0-A3
+	u16 subCode[MAX_SUBS][3];
+	u16 patchOp[MAX_SUBS];
+	unsigned subs;
+	u16 hostSubOp[2]; // first instruction of the host's subroutine in each pass
+	unsigned blockStart[BLOCKS];
+} Program;
+
+typedef struct
+{
+	u32 d[8], a[8], pc;
+	u16 sr;
+	u8 ram[RAM_SIZE];
+} RunResult;
+
+static u32 rngState;
+
+static u32 rnd(u32 range)
+{
+	rngState = rngState * 1103515245 + 12345;
+	return ((rngState >> 8) & 0xFFFFFF) % range;
+}
+
+static void emit(Program *p, u16 op)
+{
+	CHECK(p->codeWords < MAX_CODE_WORDS);
+	p->code[p->codeWords++] = op;
+}
+
+static void emitLong(Program *p, u32 v)
+{
+	emit(p, v >> 16);
+	emit(p, v & 0xFFFF);
+}
+
+// short branch at word index "at" to the current end of the program
+static void patchBranch(Program *p, unsigned at)
+{
+	int disp = ((int)p->codeWords - (int)at - 1) * 2;
+	CHECK(disp > 0 && disp < 128);
+	p->code[at] |= disp;
+}
+
+static unsigned dreg(void) { return rnd(7); } // D0-D6, D7 is the loop counter
+static unsigned areg(void) { return rnd(4); } // A0-A3 point into the scratch area
+static unsigned size(void) { return rnd(3); } // byte, word, long
+
+static void emitImm(Program *p, unsigned sz)
+{
+	if(sz == 2)
+		emitLong(p, rnd(0x10000) << 16 | rnd(0x10000));
+	else
+		emit(p, sz ? rnd(0x10000) : rnd(256));
+}
+
+// an instruction with no control flow that only touches D0-D6, the
+// condition codes and the scratch area
+static void emitOp(Program *p)
+{
+	static const u16 twoReg[] =
+	{
+		0xD000, 0x9000, 0xC000, 0x8000, 0xB000, // add, sub, and, or, cmp Dm,Dn
+		0xB100, 0xD100, 0x9100, // eor Dn,Dm, addx, subx
+	};
+	static const u16 oneReg[] = { 0x4400, 0x4600, 0x4000, 0x4200, 0x4A00 }; // neg, not, negx, clr, tst
+	static const u16 immOp[] = { 0x0000, 0x0200, 0x0A00, 0x0600, 0x0400, 0x0C00 }; // ori, andi, eori, addi, subi, cmpi
+	static const u16 memOp[] = { 0xD000, 0x9000, 0xC000, 0x8000, 0xB000 }; // add, sub, and, or, cmp d16(An),Dn
+	unsigned sz = size();
+	switch(rnd(20))
+	{
+		case 0: case 1: case 2: case 3:
+			emit(p, twoReg[rnd(sizeof(twoReg) / 2)] | (dreg() << 9) | (sz << 6) | dreg());
+			break;
+		case 4: case 5:
+			emit(p, oneReg[rnd(sizeof(oneReg) / 2)] | (sz << 6) | dreg());
+			break;
+		case 6:
+			emit(p, immOp[rnd(sizeof(immOp) / 2)] | (sz << 6) | dreg());
+			emitImm(p, sz);
+			break;
+		case 7:
+			emit(p, 0x7000 | (dreg() << 9) | rnd(256)); // moveq
+			break;
+		case 8:
+			emit(p, (rnd(2) ? 0x5100 : 0x5000) | (rnd(8) << 9) | (sz << 6) | dreg()); // addq/subq
+			break;
+		case 9: case 10: // asl/asr/lsl/lsr/roxl/roxr/rol/ror by immediate or register count
+			emit(p, 0xE000 | (rnd(8) << 9) | (rnd(2) << 8) | (sz << 6) | (rnd(2) << 5) | (rnd(4) << 3) | dreg());
+			break;
+		case 11:
+		{
+			static const u16 misc[] = { 0x4880, 0x48C0, 0x4840, 0x44C0 }; // ext.w, ext.l, swap, move Dn,ccr
+			emit(p, misc[rnd(sizeof(misc) / 2)] | dreg());
+			break;
+		}
+		case 12:
+			emit(p, (rnd(2) ? 0xC1C0 : 0xC0C0) | (dreg() << 9) | dreg()); // muls/mulu
+			break;
+		case 13: // divs/divu by a divisor made nonzero first
+		{
+			unsigned m = dreg();
+			emit(p, 0x0040 | m); // ori.w #1,Dm
+			emit(p, 1);
+			emit(p, (rnd(2) ? 0x81C0 : 0x80C0) | (dreg() << 9) | m);
+			break;
+		}
+		case 14:
+			emit(p, (rnd(2) ? 0xC100 : 0x8100) | (dreg() << 9) | dreg()); // abcd/sbcd
+			break;
+		case 15:
+			emit(p, 0x0100 | (dreg() << 9) | (rnd(4) << 6) | dreg()); // btst/bchg/bclr/bset Dm,Dn
+			break;
+		case 16:
+			emit(p, 0x50C0 | (rnd(16) << 8) | dreg()); // scc
+			break;
+		case 17:
+			emit(p, 0xC140 | (dreg() << 9) | dreg()); // exg
+			break;
+		case 18: // move.b/w/l Dm,d16(An) or d16(An),Dn
+		{
+			static const u16 moveSize[] = { 0x1000, 0x3000, 0x2000 };
+			if(rnd(2))
+				emit(p, moveSize[sz] | (areg() << 9) | (5 << 6) | dreg());
+			else
+				emit(p, moveSize[sz] | (dreg() << 9) | (5 << 3) | areg());
+			emit(p, rnd(128) * 2);
+			break;
+		}
+		default:
+			emit(p, memOp[rnd(sizeof(memOp) / 2)] | (dreg() << 9) | (sz << 6) | (5 << 3) | areg());
+			emit(p, rnd(128) * 2);
+			break;
+	}
+}
+
+static void emitOps(Program *p, unsigned count)
+{
+	for(unsigned i = 0; i < count; i++)
+		emitOp(p);
+}
+
+static void emitBlock(Program *p)
+{
+	switch(rnd(5))
+	{
+		case 0: // straight-line code, then a call to the host's subroutine
+			emitOps(p, 4 + rnd(9));
+			emit(p, 0x4EB9); // jsr HOST_SUB_ADDR
+			emitLong(p, HOST_SUB_ADDR);
+			break;
+		case 1: // bcc over a few instructions
+		{
+			emitOp(p);
+			unsigned at = p->codeWords;
+			emit(p, 0x6000 | ((2 + rnd(14)) << 8));
+			emitOps(p, 1 + rnd(3));
+			patchBranch(p, at);
+			break;
+		}
+		case 2: // dbcc loop
+		{
+			emit(p, 0x7E00 | rnd(6)); // moveq #n,D7
+			unsigned loop = p->codeWords;
+			emitOps(p, 1 + rnd(6));
+			emit(p, 0x50C8 | ((rnd(3) ? 1 : rnd(16)) << 8) | 7); // dbcc D7,loop (mostly dbra)
+			emit(p, (loop - p->codeWords) * 2);
+			break;
+		}
+		case 3: // bsr into a subroutine placed after an unconditional bra
+		{
+			unsigned call = p->codeWords;
+			emit(p, 0x6100); // bsr.s sub
+			emitOp(p);
+			unsigned skip = p->codeWords;
+			emit(p, 0x6000); // bra.s over sub
+			patchBranch(p, call);
+			emitOps(p, 1 + rnd(4));
+			emit(p, 0x4E75); // rts
+			patchBranch(p, skip);
+			break;
+		}
+		default: // call a subroutine, rewrite its first instruction, call it again
+		{
+			if(p->subs == MAX_SUBS)
+			{
+				emitOps(p, 4);
+				break;
+			}
+			unsigned n = p->subs++;
+			u32 sub = SUBS_ADDR + n * 8;
+			u16 orig = 0x7200 | rnd(256); // moveq #imm,D1
+			p->patchOp[n] = 0x7200 | ((orig + 1 + rnd(255)) & 0xFF);
+			const u16 subCode[] = { orig, 0xD481, 0x4E75 }; // add.l D1,D2, rts
+			memcpy(p->subCode[n], subCode, sizeof(subCode));
+			emit(p, 0x4EB9); // jsr sub
+			emitLong(p, sub);
+			emit(p, 0x33FC); // move.w #patchOp,sub
+			emit(p, p->patchOp[n]);
+			emitLong(p, sub);
+			emit(p, 0x4EB9); // jsr sub
+			emitLong(p, sub);
+			break;
+		}
+	}
+	emit(p, 0x48E5); // movem.l D0-D6/A0-A3,-(A5)
+	emit(p, 0xFEF0);
+	emit(p, 0x40E5); // move sr,-(A5)
+}
+
+static void generateProgram(Program *p, u32 seed)
+{
+	memset(p, 0, sizeof(*p));
+	rngState = seed;
+	for(unsigned r = 0; r < 7; r++)
+		p->initRegs[r] = rnd(2) ? rnd(0x1000000) * 256 + rnd(256) : rnd(16) - 8;
+	for(unsigned r = 0; r < 4; r++)
+		p->initRegs[7 + r] = SCRATCH_ADDR + r * 64;
+	p->hostSubOp[0] = 0x7200 | rnd(256); // moveq #imm,D1
+	p->hostSubOp[1] = 0x7200 | ((p->hostSubOp[0] + 1 + rnd(255)) & 0xFF);
+	for(unsigned r = 0; r < 11; r++)
+	{
+		emit(p, r < 7 ? 0x203C | (r << 9) : 0x207C | ((r - 7) << 9)); // move.l/movea.l #imm
+		emitLong(p, p->initRegs[r]);
+	}
+	emit(p, 0x2A7C); // movea.l #RESULTS_ADDR,A5
+	emitLong(p, RESULTS_ADDR);
+	for(unsigned b = 0; b < BLOCKS; b++)
+	{
+		p->blockStart[b] = p->codeWords;
+		emitBlock(p);
+	}
+	emit(p, 0x60FE); // bra.s self
+}
+
+static u8 *ram;
+
+static u32 readb(u32 address) { return ram[address & (RAM_SIZE - 1)]; }
+static u32 readw(u32 address) { address &= RAM_SIZE - 2; return ram[address] << 8 | ram[address + 1]; }
+static void writeb(u32 address, u32 data) { ram[address & (RAM_SIZE - 1)] = data; }
+static void writew(u32 address, u32 data) { address &= RAM_SIZE - 2; ram[address] = data >> 8; ram[address + 1] = data; }
+
+static void writeLong(u32 address, u32 data)
+{
+	writew(address, data >> 16);
+	writew(address + 2, data);
+}
+
+// translated code runs from the processor state, which must be executable
+static void *execMalloc(size_t size)
+{
+	u8 *base = mmap(NULL, size + 16, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if(base == MAP_FAILED)
+		return NULL;
+	*(size_t *)base = size + 16;
+	return base + 16;
+}
+
+static void execFree(void *ptr)
+{
+	if(ptr)
+	{
+		u8 *base = (u8 *)ptr - 16;
+		munmap(base, *(size_t *)base);
+	}
+}
+
+static void *execRealloc(void *ptr, size_t size)
+{
+	if(!ptr)
+		return execMalloc(size);
+	size_t oldSize = *(size_t *)((u8 *)ptr - 16) - 16;
+	void *newPtr = execMalloc(size);
+	if(newPtr)
+	{
+		memcpy(newPtr, ptr, oldSize < size ? oldSize : size);
+		execFree(ptr);
+	}
+	return newPtr;
+}
+
+// runs until the final bra.s self in slices of random length, which may
+// end in the middle of a translated block
+static void runToEnd(Q68State *state, const Program *p, u32 seed)
+{
+	const u32 endAddr = CODE_ADDR + (p->codeWords - 1) * 2;
+	rngState = seed;
+	for(unsigned slices = 0; q68_get_pc(state) != endAddr; slices++)
+	{
+		CHECK(slices < MAX_SLICES);
+		q68_run(state, 1 + rnd(2000));
+	}
+}
+
+static void runProgram(const Program *p, u32 seed, int jit, RunResult *result)
+{
+	ram = result->ram;
+	memset(ram, 0, RAM_SIZE);
+	writeLong(0, STACK_ADDR);
+	writeLong(4, CODE_ADDR);
+	for(unsigned i = 0; i < p->codeWords; i++)
+		writew(CODE_ADDR + i * 2, p->code[i]);
+	for(unsigned i = 0; i < p->subs; i++)
+		for(unsigned j = 0; j < 3; j++)
+			writew(SUBS_ADDR + i * 8 + j * 2, p->subCode[i][j]);
+	writew(HOST_SUB_ADDR, p->hostSubOp[0]);
+	writew(HOST_SUB_ADDR + 2, 0xD681); // add.l D1,D3
+	writew(HOST_SUB_ADDR + 4, 0x4E75); // rts
+	Q68State *state = q68_create_ex(execMalloc, execRealloc, execFree);
+	CHECK(state);
+	q68_set_irq(state, 0);
+	q68_set_readb_func(state, readb);
+	q68_set_readw_func(state, readw);
+	q68_set_writeb_func(state, writeb);
+	q68_set_writew_func(state, writew);
+	q68_set_jit_enabled(state, jit);
+	q68_reset(state);
+	runToEnd(state, p, seed);
+	// rewrite the host's subroutine behind the processor's back (code the
+	// program rewrites itself is blacklisted and always interpreted) and
+	// run everything again from the current registers
+	writew(HOST_SUB_ADDR, p->hostSubOp[1]);
+	q68_touch_memory(state, HOST_SUB_ADDR, 2);
+	q68_set_pc(state, CODE_ADDR + 6 * 12); // skip the register setup
+	runToEnd(state, p, seed + 1);
+	for(unsigned i = 0; i < 8; i++)
+	{
+		result->d[i] = q68_get_dreg(state, i);
+		result->a[i] = q68_get_areg(state, i);
+	}
+	result->pc = q68_get_pc(state);
+	result->sr = q68_get_sr(state);
+	q68_destroy(state);
+}
+
+static u32 readResult(const u8 *ram, u32 addr)
+{
+	return ram[addr] << 24 | ram[addr + 1] << 16 | ram[addr + 2] << 8 | ram[addr + 3];
+}
+
+static void printBlock(const Program *p, unsigned block)
+{
+	unsigned end = block + 1 < BLOCKS ? p->blockStart[block + 1] : p->codeWords;
+	fprintf(stderr, "block %u addr %06X code:", block, CODE_ADDR + p->blockStart[block] * 2);
+	for(unsigned i = p->blockStart[block]; i < end; i++)
+		fprintf(stderr, " %04X", p->code[i]);
+	fprintf(stderr, "\n");
+}
+
+static int compare(const Program *p, u32 seed, const RunResult *ref, const RunResult *run)
+{
+	// find the first block whose pushed registers differ, in either pass
+	static const char *pushed[] = { "SR", "D0", "D1", "D2", "D3", "D4", "D5", "D6", "A0", "A1", "A2", "A3" };
+	for(unsigned n = 0; n < BLOCKS * 2; n++)
+	{
+		unsigned block = n % BLOCKS;
+		u32 addr = RESULTS_ADDR - (n + 1) * PUSHED_WORDS * 2;
+		for(unsigned i = 0; i < 12; i++)
+		{
+			u32 refVal, runVal;
+			if(i == 0)
+			{
+				refVal = ref->ram[addr] << 8 | ref->ram[addr + 1];
+				runVal = run->ram[addr] << 8 | run->ram[addr + 1];
+			}
+			else
+			{
+				u32 at = addr + 2 + (i - 1) * 4;
+				refVal = readResult(ref->ram, at);
+				runVal = readResult(run->ram, at);
+			}
+			if(refVal != runVal)
+			{
+				fprintf(stderr, "program %u: pass %u after block %u %s interpreter %08X jit %08X\n",
+					seed, n / BLOCKS + 1, block, pushed[i], refVal, runVal);
+				if(block)
+					printBlock(p, block - 1);
+				printBlock(p, block);
+				return 0;
+			}
+		}
+	}
+	for(unsigned i = 0; i < 8; i++)
+	{
+		if(ref->d[i] != run->d[i] || ref->a[i] != run->a[i])
+		{
+			fprintf(stderr, "program %u: D%u/A%u interpreter %08X/%08X jit %08X/%08X\n",
+				seed, i, i, ref->d[i], ref->a[i], run->d[i], run->a[i]);
+			return 0;
+		}
+	}
+	if(ref->sr != run->sr || ref->pc != run->pc)
+	{
+		fprintf(stderr, "program %u: SR/PC interpreter %04X/%06X jit %04X/%06X\n",
+			seed, ref->sr, ref->pc, run->sr, run->pc);
+		return 0;
+	}
+	for(u32 i = 0; i < RAM_SIZE; i++)
+	{
+		if(ref->ram[i] != run->ram[i])
+		{
+			fprintf(stderr, "program %u: RAM %05X interpreter %02X jit %02X\n", seed, i, ref->ram[i], run->ram[i]);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int main(int argc, char **argv)
+{
+	unsigned programs = argc > 1 ? atoi(argv[1]) : 100;
+	static Program prog;
+	static RunResult ref, run;
+	unsigned failed = 0;
+	for(u32 seed = 1; seed <= programs; seed++)
+	{
+		generateProgram(&prog, seed);
+		runProgram(&prog, seed, 0, &ref);
+		runProgram(&prog, seed, 1, &run);
+		if(!compare(&prog, seed, &ref, &run))
+			failed++;
+	}
+	printf("%u of %u programs matched\n", programs - failed, programs);
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,470 @@
+/*  This file is part of Saturn.emu.
+
+	Saturn.emu is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Saturn.emu is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with Saturn.emu.  If not, see <http://www.gnu.org/licenses/> */
+
+// Runs randomly generated SH2 programs on the master SH2 through both the
+// interpreter and the dynarec and checks they end with the same registers
+// and work RAM. Programs mix ALU, multiply/divide-step, shift and memory
+// instructions with conditional skips, delayed branches, loops, subroutine
+// calls and stores that rewrite already executed code. After each block
+// the registers are pushed to a results area so any divergence is kept in
+// RAM. Each run is done in its own process since the cores keep global
+// state. Also checks the dynarec falls back to the interpreter when its
+// code cache address is already taken.
+// Build & run from Saturn.emu (x86_64 Linux, the dynarec needs a non-PIE binary):
+// cd src/yabause && cc -O1 -w -fno-pie -no-pie -I.. -I. -DHAVE_SYS_TIME_H=1 -DHAVE_GETTIMEOFDAY=1 \
+//  -DHAVE_STDINT_H=1 -DHAVE_STRCASECMP=1 -DVERSION=\"0.9.10\" -DCPU_X64=1 -DUSE_DYNAREC=1 -DSH2_DYNAREC=1 \
+//  -DHAVE_SCSP2=1 ../../tests/SH2DynarecTest/SH2DynarecTest.c {bios,cdbase,cheat,coffelf,cs0,cs1,cs2,debug,error}.c \
+//  {memory,m68kcore,m68kd,movie,netlink,peripheral,profile,scu,sh2core,sh2d,sh2idle,sh2int,sh2trace}.c \
+//  {smpc,snddummy,titan/titan,vdp1,vdp2,vdp2debug,vidshared,vidsoft,yabause,scsp,scsp2,japmodem}.c thr-linux.c \
+//  sh2_dynarec/sh2_dynarec.c sh2_dynarec/linkage_x64.s -lm -lpthread -o /tmp/SH2DynarecTest && \
+//  /tmp/SH2DynarecTest [programs]
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "yabause.h"
+#include "cdbase.h"
+#include "m68kcore.h"
+#include "memory.h"
+#include "peripheral.h"
+#include "scsp.h"
+#include "sh2core.h"
+#include "sh2int.h"
+#include "smpc.h"
+#include "vdp1.h"
+
+#define SH2CORE_DYNAREC 2
+
+SH2Interface_struct *SH2CoreList[] = { &SH2Interpreter, &SH2Dynarec, NULL };
+PerInterface_struct *PERCoreList[] = { &PERDummy, NULL };
+CDInterface *CDCoreList[] = { &DummyCD, NULL };
+SoundInterface_struct *SNDCoreList[] = { &SNDDummy, NULL };
+VideoInterface_struct *VIDCoreList[] = { &VIDDummy, NULL };
+M68K_struct *M68KCoreList[] = { &M68KDummy, NULL };
+
+void DisplayMessage(const char *str) {}
+void OSDPushMessage(int msgtype, int ttl, const char *message, ...) {}
+void OSDDisplayMessages(void) {}
+int OSDUseBuffer(void) { return 0; }
+int OSDChangeCore(int coreid) { return 0; }
+void YuiSwapBuffers(void) {}
+void YuiErrorMsg(const char *string) { fprintf(stderr, "%s\n", string); }
+
+#define CHECK(cond) do { if(!(cond)) { fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); exit(1); } } while(0)
+
+enum
+{
+	CODE_ADDR = 0x06004000,
+	SUBS_ADDR = 0x06040000, // subroutines rewritten by the program
+	SCRATCH_ADDR = 0x06080000, // R13, random loads/stores within the first 64 bytes
+	PATCH_CONSTS_ADDR = SCRATCH_ADDR + 64, // subroutine address & new opcode pairs
+	RESULTS_ADDR = 0x060A0000, // R14, registers pushed downwards after each block
+	MAX_CODE_WORDS = 0x8000,
+	MAX_PATCHES = 8, // limited by add #imm reaching the pairs
+	BLOCKS = 300,
+	FRAMES = 3,
+};
+
+static const char *biosPath = "/tmp/SH2DynarecTest.bios";
+
+typedef struct
+{
+	u16 code[MAX_CODE_WORDS];
+	unsigned codeWords;
+	u32 initRegs[13]; // R0-R11 & R13
+	u16 subCode[MAX_PATCHES][4];
+	u32 patchOp[MAX_PATCHES];
+	unsigned patches;
+	unsigned blockStart[BLOCKS];
+} Program;
+
+typedef struct
+{
+	int ran, coreID;
+	sh2regs_struct regs;
+	u8 highWram[0x100000];
+} RunResult;
+
+static u32 rngState;
+
+static u32 rnd(u32 range)
+{
+	rngState = rngState * 1103515245 + 12345;
+	return ((rngState >> 8) & 0xFFFFFF) % range;
+}
+
+static void emit(Program *p, u16 op)
+{
+	CHECK(p->codeWords < MAX_CODE_WORDS);
+	p->code[p->codeWords++] = op;
+}
+
+static u32 pcAddr(const Program *p)
+{
+	return CODE_ADDR + p->codeWords * 2;
+}
+
+// branch at word index "at" to the current end of the program
+static void patchBranch(Program *p, unsigned at, unsigned dispBits)
+{
+	int disp = ((int)p->codeWords - (int)at - 2);
+	CHECK(disp >= 0 && disp < (1 << (dispBits - 1)));
+	p->code[at] |= disp;
+}
+
+static unsigned reg(void) { return rnd(12); } // R0-R11, R12 is the loop counter
+
+// an instruction with no control flow that only touches R0-R11, T/M/Q,
+// MACH/MACL and the scratch area
+static u16 randomOp(void)
+{
+	// no addv/subv, the dynarec doesn't implement them
+	static const u16 twoReg[] =
+	{
+		0x300C, 0x300E, 0x3008, 0x300A, // add, addc, sub, subc
+		0x2009, 0x200B, 0x200A, 0x2008, 0x200C, 0x200D, // and, or, xor, tst, cmp/str, xtrct
+		0x3000, 0x3002, 0x3003, 0x3006, 0x3007, // cmp/eq, cmp/hs, cmp/ge, cmp/hi, cmp/gt
+		0x6003, 0x6007, 0x600B, 0x600A, 0x6008, 0x6009, // mov, not, neg, negc, swap.b, swap.w
+		0x600C, 0x600D, 0x600E, 0x600F, // extu.b, extu.w, exts.b, exts.w
+		0x0007, 0x200F, 0x200E, 0x300D, 0x3005, // mul.l, muls.w, mulu.w, dmuls.l, dmulu.l
+		0x2007, 0x3004, 0x3004, 0x3004, // div0s, div1
+	};
+	static const u16 oneReg[] =
+	{
+		0x4000, 0x4001, 0x4020, 0x4021, 0x4004, 0x4005, 0x4024, 0x4025, // shifts & rotates
+		0x4008, 0x4009, 0x4018, 0x4019, 0x4028, 0x4029,
+		0x4010, 0x4011, 0x4015, 0x0029, 0x001A, 0x000A, // dt, cmp/pz, cmp/pl, movt, sts macl, sts mach
+	};
+	static const u16 noReg[] = { 0x0008, 0x0018, 0x0028, 0x0019 }; // clrt, sett, clrmac, div0u
+	static const u16 r0Imm[] = { 0x8800, 0xC900, 0xCB00, 0xCA00, 0xC800 }; // cmp/eq, and, or, xor, tst #imm with R0
+	switch(rnd(16))
+	{
+		case 0: case 1: case 2: case 3: case 4: case 5:
+			return twoReg[rnd(sizeof(twoReg) / 2)] | (reg() << 8) | (reg() << 4);
+		case 6: case 7: case 8:
+			return oneReg[rnd(sizeof(oneReg) / 2)] | (reg() << 8);
+		case 9:
+			return noReg[rnd(sizeof(noReg) / 2)];
+		case 10:
+			return r0Imm[rnd(sizeof(r0Imm) / 2)] | rnd(256);
+		case 11:
+			return (rnd(2) ? 0xE000 : 0x7000) | (reg() << 8) | rnd(256); // mov/add #imm
+		case 12:
+			return 0x1D00 | (reg() << 4) | rnd(16); // mov.l Rm,@(disp,R13)
+		case 13:
+			return 0x50D0 | (reg() << 8) | rnd(16); // mov.l @(disp,R13),Rn
+		case 14:
+			return (rnd(2) ? 0x81D0 : 0x80D0) | rnd(16); // mov.w/mov.b R0,@(disp,R13)
+		default:
+			return (rnd(2) ? 0x85D0 : 0x84D0) | rnd(16); // mov.w/mov.b @(disp,R13),R0
+	}
+}
+
+static void emitOps(Program *p, unsigned count)
+{
+	for(unsigned i = 0; i < count; i++)
+		emit(p, randomOp());
+}
+
+static void emitBlock(Program *p)
+{
+	switch(rnd(6))
+	{
+		case 0: // straight-line code
+			emitOps(p, 4 + rnd(9));
+			break;
+		case 1: // bt/bf over a few instructions
+		{
+			emit(p, randomOp());
+			unsigned at = p->codeWords;
+			emit(p, rnd(2) ? 0x8900 : 0x8B00);
+			emitOps(p, 1 + rnd(3));
+			patchBranch(p, at, 8);
+			break;
+		}
+		case 2: // bt/s or bf/s with a delay slot
+		{
+			emit(p, randomOp());
+			unsigned at = p->codeWords;
+			emit(p, rnd(2) ? 0x8D00 : 0x8F00);
+			emit(p, randomOp());
+			emitOps(p, 1 + rnd(3));
+			patchBranch(p, at, 8);
+			break;
+		}
+		case 3: // counted loop
+		{
+			emit(p, 0xEC01 + rnd(5)); // mov #n,R12
+			unsigned loop = p->codeWords;
+			emitOps(p, 1 + rnd(6));
+			emit(p, 0x4C10); // dt R12
+			emit(p, 0x8B00 | ((loop - p->codeWords - 2) & 0xFF)); // bf loop
+			break;
+		}
+		case 4: // bsr into a subroutine placed after an unconditional bra
+		{
+			unsigned call = p->codeWords;
+			emit(p, 0xB000); // bsr sub
+			emit(p, randomOp());
+			unsigned skip = p->codeWords;
+			emit(p, 0xA000); // bra over sub
+			emit(p, 0x0009);
+			patchBranch(p, call, 12);
+			emitOps(p, 1 + rnd(6));
+			emit(p, 0x000B); // rts
+			emit(p, randomOp());
+			patchBranch(p, skip, 12);
+			break;
+		}
+		default: // call a subroutine, rewrite its first instruction, call it again
+		{
+			if(p->patches == MAX_PATCHES)
+			{
+				emitOps(p, 4);
+				break;
+			}
+			unsigned n = p->patches++;
+			emit(p, 0x69D3); // mov R13,R9
+			emit(p, 0x7940 + n * 8); // add #(64 + n * 8),R9
+			emit(p, 0x6B92); // mov.l @R9,R11
+			emit(p, 0x5A91); // mov.l @(4,R9),R10
+			emit(p, 0x4B0B); // jsr @R11
+			emit(p, 0x0009);
+			emit(p, 0x2BA1); // mov.w R10,@R11
+			emit(p, 0x4B0B); // jsr @R11
+			emit(p, 0x0009);
+			u16 orig = 0xE100 | rnd(256); // mov #imm,R1
+			p->patchOp[n] = 0xE100 | ((orig + 1 + rnd(255)) & 0xFF);
+			const u16 subCode[] = { orig, 0x321C, 0x000B, 0x0009 }; // add R1,R2, rts
+			memcpy(p->subCode[n], subCode, sizeof(subCode));
+			break;
+		}
+	}
+	// push R0-R11, SR, MACH & MACL to the results area
+	for(unsigned r = 0; r < 12; r++)
+		emit(p, 0x2E06 | (r << 4)); // mov.l Rr,@-R14
+	emit(p, 0x4E03); // stc.l sr,@-R14
+	emit(p, 0x4E02); // sts.l mach,@-R14
+	emit(p, 0x4E12); // sts.l macl,@-R14
+}
+
+static void generateProgram(Program *p, u32 seed)
+{
+	memset(p, 0, sizeof(*p));
+	rngState = seed;
+	for(unsigned r = 0; r < 12; r++)
+		p->initRegs[r] = rnd(2) ? rnd(0x1000000) * 256 + rnd(256) : rnd(16) - 8;
+	p->initRegs[12] = SCRATCH_ADDR;
+	// load R0-R11, R13 & R14 from a literal pool the prologue jumps over
+	const unsigned loads = 14, poolWords = loads * 2;
+	unsigned poolAt = loads + 2;
+	poolAt += ((CODE_ADDR / 2 + poolAt) & 1); // longword align
+	for(unsigned i = 0; i < loads; i++)
+	{
+		unsigned rn = i < 12 ? i : i + 1;
+		u32 lit = CODE_ADDR + (poolAt + i * 2) * 2;
+		u32 disp = (lit - ((pcAddr(p) & ~3) + 4)) / 4;
+		emit(p, 0xD000 | (rn << 8) | disp);
+	}
+	unsigned skip = p->codeWords;
+	emit(p, 0xA000); // bra main
+	emit(p, 0x0009);
+	while(p->codeWords < poolAt)
+		emit(p, 0x0009);
+	for(unsigned i = 0; i < loads; i++)
+	{
+		u32 v = i < 13 ? p->initRegs[i] : RESULTS_ADDR;
+		emit(p, v >> 16);
+		emit(p, v & 0xFFFF);
+	}
+	CHECK(p->codeWords == poolAt + poolWords);
+	patchBranch(p, skip, 12);
+	for(unsigned b = 0; b < BLOCKS; b++)
+	{
+		p->blockStart[b] = p->codeWords;
+		emitBlock(p);
+	}
+	emit(p, 0xAFFE); // bra self
+	emit(p, 0x0009);
+}
+
+static void writeBios(void)
+{
+	// reset vectors point to a stub that jumps to the program, which is
+	// written to work RAM after the dynarec has compiled the entry point
+	static u8 bios[0x80000];
+	const u8 vectors[] = { 0x00, 0x00, 0x04, 0x00, 0x06, 0x10, 0x00, 0x00 }; // PC & SP
+	const u8 stub[] =
+	{
+		0xD0, 0x01, // mov.l @(4,PC),R0
+		0x40, 0x2B, // jmp @R0
+		0x00, 0x09, // nop
+		0x00, 0x09,
+		CODE_ADDR >> 24, (CODE_ADDR >> 16) & 0xFF, (CODE_ADDR >> 8) & 0xFF, CODE_ADDR & 0xFF,
+	};
+	memcpy(bios, vectors, sizeof(vectors));
+	memcpy(bios + 0x400, stub, sizeof(stub));
+	FILE *f = fopen(biosPath, "wb");
+	CHECK(f);
+	CHECK(fwrite(bios, sizeof(bios), 1, f) == 1);
+	fclose(f);
+}
+
+static void runProgram(const Program *p, int coreID, int blockCodeCache, RunResult *result)
+{
+	pid_t pid = fork();
+	CHECK(pid >= 0);
+	if(pid)
+	{
+		int status;
+		CHECK(waitpid(pid, &status, 0) == pid);
+		if(!WIFEXITED(status) || WEXITSTATUS(status))
+			result->ran = 0;
+		return;
+	}
+	if(blockCodeCache)
+	{
+		// take the dynarec's fixed code cache address first
+		CHECK(mmap((void*)0x70000000, 4096, PROT_READ, MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0) != MAP_FAILED);
+	}
+	yabauseinit_struct init;
+	memset(&init, 0, sizeof(init));
+	init.sh2coretype = coreID;
+	init.biospath = biosPath;
+	init.regionid = REGION_AUTODETECT;
+	init.clocksync = 1;
+	if(YabauseInit(&init) != 0)
+		_exit(1);
+	for(unsigned i = 0; i < p->codeWords; i++)
+		MappedMemoryWriteWord(CODE_ADDR + i * 2, p->code[i]);
+	for(unsigned i = 0; i < p->patches; i++)
+	{
+		for(unsigned j = 0; j < 4; j++)
+			MappedMemoryWriteWord(SUBS_ADDR + i * 8 + j * 2, p->subCode[i][j]);
+		MappedMemoryWriteLong(PATCH_CONSTS_ADDR + i * 8, SUBS_ADDR + i * 8);
+		MappedMemoryWriteLong(PATCH_CONSTS_ADDR + i * 8 + 4, p->patchOp[i]);
+	}
+	for(unsigned f = 0; f < FRAMES; f++)
+		YabauseEmulate();
+	SH2Core->GetRegisters(MSH2, &result->regs);
+	memcpy(result->highWram, HighWram, sizeof(result->highWram));
+	result->coreID = SH2Core->id;
+	result->ran = 1;
+	_exit(0);
+}
+
+static u32 readLong(const u8 *highWram, u32 addr)
+{
+	return T2ReadLong((u8*)highWram, addr & 0xFFFFF);
+}
+
+static void printBlock(const Program *p, unsigned block)
+{
+	unsigned end = block + 1 < BLOCKS ? p->blockStart[block + 1] : p->codeWords;
+	fprintf(stderr, "block %u addr %08X code:", block, CODE_ADDR + p->blockStart[block] * 2);
+	for(unsigned i = p->blockStart[block]; i < end; i++)
+		fprintf(stderr, " %04X", p->code[i]);
+	fprintf(stderr, "\n");
+}
+
+static int compare(const Program *p, u32 seed, const char *name, const RunResult *ref, const RunResult *run)
+{
+	// find the first block whose pushed registers differ
+	static const char *pushed[] = { "R0", "R1", "R2", "R3", "R4", "R5", "R6", "R7", "R8", "R9", "R10", "R11", "SR", "MACH", "MACL" };
+	for(unsigned block = 0; block < BLOCKS; block++)
+	{
+		for(unsigned i = 0; i < 15; i++)
+		{
+			u32 addr = RESULTS_ADDR - (block * 15 + i + 1) * 4;
+			u32 refVal = readLong(ref->highWram, addr), runVal = readLong(run->highWram, addr);
+			if(refVal != runVal)
+			{
+				fprintf(stderr, "program %u: after block %u %s interpreter %08X %s %08X\n",
+					seed, block, pushed[i], refVal, name, runVal);
+				if(block)
+					printBlock(p, block - 1);
+				printBlock(p, block);
+				return 0;
+			}
+		}
+	}
+	const sh2regs_struct *a = &ref->regs, *b = &run->regs;
+	for(unsigned i = 0; i < 16; i++)
+	{
+		if(a->R[i] != b->R[i])
+		{
+			fprintf(stderr, "program %u: R%u interpreter %08X %s %08X\n", seed, i, a->R[i], name, b->R[i]);
+			return 0;
+		}
+	}
+	const u32 regA[] = { a->SR.all & 0x3F3, a->GBR, a->VBR, a->MACH, a->MACL, a->PR, a->PC };
+	const u32 regB[] = { b->SR.all & 0x3F3, b->GBR, b->VBR, b->MACH, b->MACL, b->PR, b->PC };
+	const char *regName[] = { "SR", "GBR", "VBR", "MACH", "MACL", "PR", "PC" };
+	for(unsigned i = 0; i < 7; i++)
+	{
+		if(regA[i] != regB[i])
+		{
+			fprintf(stderr, "program %u: %s interpreter %08X %s %08X\n", seed, regName[i], regA[i], name, regB[i]);
+			return 0;
+		}
+	}
+	for(u32 i = 0; i < sizeof(ref->highWram); i++)
+	{
+		if(ref->highWram[i] != run->highWram[i])
+		{
+			// work RAM is stored in 16-bit words with the bytes swapped
+			fprintf(stderr, "program %u: HWRAM %08X interpreter %02X %s %02X\n", seed, 0x06000000 + (i ^ 1),
+				ref->highWram[i], name, run->highWram[i]);
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int main(int argc, char **argv)
+{
+	unsigned programs = argc > 1 ? atoi(argv[1]) : 100;
+	RunResult *ref = mmap(NULL, sizeof(RunResult), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	RunResult *run = mmap(NULL, sizeof(RunResult), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	CHECK(ref != MAP_FAILED && run != MAP_FAILED);
+	static Program prog;
+	writeBios();
+	unsigned failed = 0;
+	for(u32 seed = 1; seed <= programs; seed++)
+	{
+		generateProgram(&prog, seed);
+		runProgram(&prog, SH2CORE_INTERPRETER, 0, ref);
+		runProgram(&prog, SH2CORE_DYNAREC, 0, run);
+		CHECK(ref->ran && run->ran);
+		CHECK(run->coreID == SH2CORE_DYNAREC);
+		// the end of the program must have been reached
+		CHECK(ref->regs.PC == CODE_ADDR + (prog.codeWords - 2) * 2);
+		if(!compare(&prog, seed, "dynarec", ref, run))
+			failed++;
+	}
+	printf("%u of %u programs matched\n", programs - failed, programs);
+
+	// with the code cache address taken the dynarec must fall back to the interpreter
+	runProgram(&prog, SH2CORE_DYNAREC, 1, run);
+	CHECK(run->ran);
+	int fallbackOk = run->coreID == SH2CORE_INTERPRETER && compare(&prog, programs, "fallback", ref, run);
+	printf("fallback to interpreter: %s\n", fallbackOk ? "ok" : "FAILED");
+	unlink(biosPath);
+	return !failed && fallbackOk ? 0 : 1;
+}
@@ -0,0 +1,206 @@
+/*  This file is part of Saturn.emu.
+
+	Saturn.emu is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Saturn.emu is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with Saturn.emu.  If not, see <http://www.gnu.org/licenses/> */
+
+// Checks the vectorized Titan compositors against the scalar one. Random
+// frames are drawn into the priority framebuffers for every blend mode and
+// a range of widths, then composited once with TITAN_SIMD_NONE and once with
+// each SIMD path the CPU supports. The output must be bit-exact. A second
+// render of the same framebuffers is compared too, since compositing also
+// clears the layers and masks the back screen. Afterwards the time per frame
+// of each path is printed for a dense 352x240 frame.
+// Build & run from Saturn.emu:
+// cd src/yabause && cc -O2 -msse2 -w -I.. -I. ../../tests/TitanSimdTest/TitanSimdTest.c titan/titan.c \
+//  -o /tmp/TitanSimdTest && /tmp/TitanSimdTest [frames]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "titan/titan.h"
+
+#define MAX_WIDTH 704
+#define MAX_HEIGHT 512
+
+#define CHECK(cond, ...) \
+	do { if(!(cond)) { fprintf(stderr, "failed: " __VA_ARGS__); fputc('\n', stderr); return 0; } } while(0)
+
+static const char *simdName[] = { "none", "sse2", "avx2", "neon" };
+static const char *blendName[] = { "top", "bottom", "add" };
+
+static u32 rngState;
+
+static u32 rand32(void)
+{
+	rngState ^= rngState << 13;
+	rngState ^= rngState >> 17;
+	rngState ^= rngState << 5;
+	return rngState;
+}
+
+// Pixel with a random alpha, transparency bit and color, biased towards
+// the opaque and fully transparent cases the compositor special-cases
+static u32 randPixel(void)
+{
+	u32 pixel = rand32();
+	switch(pixel >> 29)
+	{
+		case 0: return pixel & 0x80FFFFFF; // alpha 0
+		case 1: return pixel | 0x3F000000; // opaque alpha
+		default: return pixel;
+	}
+}
+
+// Draws a frame from the given seed, the same seed always gives the same
+// framebuffers as long as the blend mode and resolution don't change
+static void drawFrame(u32 seed, int width, int height, int dense)
+{
+	int y, i;
+	rngState = seed;
+	for(y = 0; y < height; y++)
+	{
+		TitanPutBackHLine(y, (rand32() & 3) ? randPixel() : 0);
+		if(dense || !(rand32() & 7))
+		{
+			int priority = 1 + rand32() % 7;
+			int x = rand32() % width;
+			TitanPutHLine(priority, x, y, rand32() % (width - x + 1), randPixel());
+		}
+	}
+	for(i = (width * height) / (dense ? 1 : 4); i > 0; i--)
+	{
+		int x = rand32() % width, y = rand32() % height;
+		int priority = rand32() & 7;
+		if(!(rand32() & 15))
+			TitanPutShadow(priority, x, y);
+		else
+			TitanPutPixel(priority, x, y, randPixel(), 0);
+	}
+}
+
+static void clearDisp(pixel_t *disp, u32 seed, int size)
+{
+	int i;
+	rngState = seed;
+	for(i = 0; i < size; i++)
+		disp[i] = rand32();
+}
+
+static pixel_t refDisp[2][MAX_WIDTH * MAX_HEIGHT], simdDisp[2][MAX_WIDTH * MAX_HEIGHT];
+
+// Draws and renders the frame twice with the given SIMD path
+static void renderFrame(pixel_t disp[2][MAX_WIDTH * MAX_HEIGHT], int simd, u32 seed, int width, int height)
+{
+	int pass;
+	TitanSetSimd(simd);
+	drawFrame(seed, width, height, 0);
+	for(pass = 0; pass < 2; pass++)
+	{
+		clearDisp(disp[pass], seed + pass, width * height);
+		TitanRender(disp[pass]);
+	}
+}
+
+static int checkFrame(int simd, int blend, u32 seed, int width, int height)
+{
+	int pass, i;
+	TitanSetResolution(width, height);
+	TitanSetBlendingMode(blend);
+	renderFrame(refDisp, TITAN_SIMD_NONE, seed, width, height);
+	renderFrame(simdDisp, simd, seed, width, height);
+	for(pass = 0; pass < 2; pass++)
+	{
+		for(i = 0; i < width * height; i++)
+		{
+			CHECK(refDisp[pass][i] == simdDisp[pass][i],
+				"%s blend %s, seed %u, %dx%d, render %d: pixel %d,%d is %08X, expected %08X",
+				simdName[simd], blendName[blend], (unsigned)seed, width, height, pass + 1,
+				i % width, i / width, (unsigned)simdDisp[pass][i], (unsigned)refDisp[pass][i]);
+		}
+	}
+	return 1;
+}
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Times only the compositing, drawing is the same for every path
+static void benchSimd(int simd, int blend)
+{
+	const int width = 352, height = 240, frames = 200;
+	double total = 0;
+	int i;
+	TitanSetResolution(width, height);
+	TitanSetBlendingMode(blend);
+	TitanSetSimd(simd);
+	for(i = 0; i < frames; i++)
+	{
+		double start;
+		drawFrame(i + 1, width, height, 1);
+		start = now();
+		TitanRender(simdDisp[0]);
+		total += now() - start;
+	}
+	printf("%s blend %s: %.1f us/frame\n", simdName[simd], blendName[blend], total / frames * 1e6);
+}
+
+int main(int argc, char **argv)
+{
+	static const int widths[] = { 320, 352, 333, 640, 704, 7 };
+	const int frames = argc > 1 ? atoi(argv[1]) : 50;
+	int simd, blend, f, failed = 0;
+
+	if(TitanInit() != 0)
+	{
+		fprintf(stderr, "TitanInit failed\n");
+		return 1;
+	}
+	for(simd = TITAN_SIMD_SSE2; simd <= TITAN_SIMD_NEON; simd++)
+	{
+		int checked = 0;
+		if(TitanSetSimd(simd) != simd)
+		{
+			printf("%s: not supported\n", simdName[simd]);
+			continue;
+		}
+		for(blend = TITAN_BLEND_TOP; blend <= TITAN_BLEND_ADD; blend++)
+		{
+			for(f = 0; f < frames; f++)
+			{
+				int width = widths[f % (sizeof(widths) / sizeof(*widths))];
+				int height = 1 + f * 37 % 240;
+				if(!checkFrame(simd, blend, f + 1, width, height))
+				{
+					failed = 1;
+					break;
+				}
+				checked++;
+			}
+		}
+		printf("%s: %d of %d frames matched\n", simdName[simd], checked, frames * 3);
+	}
+	for(simd = TITAN_SIMD_NONE; simd <= TITAN_SIMD_NEON; simd++)
+	{
+		if(TitanSetSimd(simd) != simd)
+			continue;
+		for(blend = TITAN_BLEND_TOP; blend <= TITAN_BLEND_ADD; blend++)
+			benchSimd(simd, blend);
+	}
+	TitanDeInit();
+	return failed;
+}
@@ -83,6 +83,7 @@ const char *EmuSystem::configFilename = "Snes9x.config";
 #else
 bool EmuSystem::hasBundledGames = true;
 const char *EmuSystem::configFilename = "Snes9xP.config";
+bool EmuSystem::gzipsStateFiles = true; // 1.43 buffers already come from a gzFile
 #endif
 bool EmuSystem::hasCheats = true;
 const uint EmuSystem::maxPlayers = 5;
@@ -382,33 +383,60 @@ static FS::PathString sprintCheatsFilename()
 	return FS::makePathStringPrintf("%s/%s.cht", EmuSystem::savePath(), EmuSystem::gameName().data());
 }
 
-std::error_code EmuSystem::saveState()
+#ifndef SNES9X_VERSION_1_4
+std::error_code EmuSystem::saveStateToBuffer(std::vector<uint8_t> &buff)
 {
-	auto saveStr = sprintStateFilename(saveStateSlot);
-	fixFilePermissions(saveStr);
-	if(!S9xFreezeGame(saveStr.data()))
+	buff.resize(S9xFreezeSize());
+	if(!S9xFreezeGameMem(buff.data(), buff.size()))
 		return {EIO, std::system_category()};
-	else
-		return {};
+	return {};
 }
 
-std::system_error EmuSystem::loadState(int saveStateSlot)
+std::system_error EmuSystem::loadStateFromBuffer(const uint8_t *data, size_t size)
 {
-	auto saveStr = sprintStateFilename(saveStateSlot);
-	if(FS::exists(saveStr.data()))
-	{
-		logMsg("loading state %s", saveStr.data());
-		if(S9xUnfreezeGame(saveStr.data()))
-		{
-			IPPU.RenderThisFrame = TRUE;
-			return {{}};
-		}
-		else
-			return {{EIO, std::system_category()}};
-	}
-	return {{ENOENT, std::system_category()}};
+	if(S9xUnfreezeGameMem(data, size) != SUCCESS)
+		return {{EIO, std::system_category()}};
+	IPPU.RenderThisFrame = TRUE;
+	return {{}};
+}
+#else
+// 1.43 only serializes through a gzFile, so go through a scratch file
+static FS::PathString sprintScratchStateFilename()
+{
+	return FS::makePathStringPrintf("%s/.%s.tmp.s96", EmuSystem::savePath(), EmuSystem::gameName().data());
 }
 
+std::error_code EmuSystem::saveStateToBuffer(std::vector<uint8_t> &buff)
+{
+	auto scratchStr = sprintScratchStateFilename();
+	if(!S9xFreezeGame(scratchStr.data()))
+		return {EIO, std::system_category()};
+	FileIO f;
+	auto ec = f.open(scratchStr);
+	if(ec)
+		return ec;
+	buff.resize(f.size());
+	ec = f.readAll(buff.data(), buff.size());
+	f.close();
+	FS::remove(scratchStr);
+	return ec;
+}
+
+std::system_error EmuSystem::loadStateFromBuffer(const uint8_t *data, size_t size)
+{
+	auto scratchStr = sprintScratchStateFilename();
+	auto ec = writeToNewFile(scratchStr.data(), (void*)data, size);
+	if(ec)
+		return {ec};
+	bool success = S9xUnfreezeGame(scratchStr.data());
+	FS::remove(scratchStr);
+	if(!success)
+		return {{EIO, std::system_category()}};
+	IPPU.RenderThisFrame = TRUE;
+	return {{}};
+}
+#endif
+
 void EmuSystem::saveBackupMem() // for manually saving when not closing game
 {
 	if(gameIsRunning())
@@ -429,17 +457,6 @@ void EmuSystem::saveBackupMem() // for manually saving when not closing game
 	}
 }
 
-void EmuSystem::saveAutoState()
-{
-	if(gameIsRunning() && optionAutoSaveState)
-	{
-		auto saveStr = sprintStateFilename(-1);
-		fixFilePermissions(saveStr);
-		if(!S9xFreezeGame(saveStr.data()))
-			logMsg("error saving state %s", saveStr.data());
-	}
-}
-
 void S9xAutoSaveSRAM (void)
 {
 	EmuSystem::saveBackupMem();
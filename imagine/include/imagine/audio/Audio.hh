@@ -61,6 +61,8 @@ BufferContext getPlayBuffer(uint wantedFrames);
 void commitPlayBuffer(BufferContext buffer, uint frames);
 int frameDelay();
 int framesFree();
+// size of the output buffer set up by openPcm(), the value of framesFree() when empty
+int bufferFrames();
 void setHintOutputLatency(uint us);
 uint hintOutputLatency();
 void setHintStrictUnderrunCheck(bool on);
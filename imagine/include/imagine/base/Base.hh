@@ -45,6 +45,9 @@ static const uint APP_RUNNING = 0, APP_PAUSED = 1, APP_EXITING = 2;
 uint appActivityState();
 static bool appIsRunning() { return appActivityState() == APP_RUNNING; }
 
+// True if launched with no window system, only supported on Linux via "--headless" as the first argument
+bool isHeadless();
+
 // external services
 void openURL(const char *url);
 
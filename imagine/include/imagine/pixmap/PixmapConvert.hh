@@ -0,0 +1,35 @@
+#pragma once
+
+/*  This file is part of Imagine.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with Imagine.  If not, see <http://www.gnu.org/licenses/> */
+
+#include <imagine/config/defs.hh>
+#include <imagine/pixmap/Pixmap.hh>
+
+namespace IG
+{
+
+// Pixel format conversion between RGB565, RGBA8888, BGRA8888 and RGB888
+// using SSE2/SSSE3 or NEON kernels when available. Formats are in memory byte
+// order (RGBA8888 is R,G,B,A), except RGB565 which is a native 16-bit value.
+// Rows are converted separately so either pixmap can be padded.
+
+bool canConvertPixmap(PixelFormat dest, PixelFormat src);
+// dest and src must be the same size, returns false if the formats aren't supported
+bool convertPixmap(const Pixmap &dest, const Pixmap &src);
+// expands the PIXEL_I8 indices in src with a palette of dest's format, which must be 16 or 32-bit
+void convertPixmapWithPalette(const Pixmap &dest, const Pixmap &src, const void *palette);
+
+}
@@ -15,14 +15,28 @@
 	You should have received a copy of the GNU General Public License
 	along with Imagine.  If not, see <http://www.gnu.org/licenses/> */
 
-#include <imagine/util/algorithm.h>
+#include <algorithm>
 #include <atomic>
 #include <cstdlib>
-
-template <class COUNT = std::atomic_uint, class SIZE = unsigned int>
+#include <cstring>
+#include <cassert>
+
+// Wait-free single-producer/single-consumer ring buffer. One thread may call
+// the write functions while another calls the read functions. init(), deinit()
+// and reset() require both sides to be idle, use discard() to empty the
+// buffer while the producer is running.
+template <class SIZE = unsigned int>
 class StaticRingBuffer
 {
 public:
+	// contiguous region returned by writeSpan()/readSpan(),
+	// pass the number of bytes actually used to commitWrite()/commitRead()
+	struct Span
+	{
+		char *data;
+		SIZE size;
+	};
+
 	constexpr StaticRingBuffer() {}
 
 	bool init(SIZE size)
@@ -49,115 +63,155 @@ public:
 
 	void reset()
 	{
-		start = end = buff;
-		written = 0;
+		writeIdx.store(0, std::memory_order_relaxed);
+		readIdx.store(0, std::memory_order_relaxed);
+	}
+
+	SIZE capacity() const
+	{
+		return buffSize;
 	}
 
 	SIZE freeSpace() const
 	{
-		return buffSize - written;
+		return buffSize - used(writeIdx.load(std::memory_order_relaxed), readIdx.load(std::memory_order_acquire));
 	}
 
 	SIZE freeContiguousSpace() const
 	{
-		return ((uintptr_t)buff + buffSize) - (uintptr_t)end;
+		return writeSpan().size;
 	}
 
 	SIZE writtenSize() const
 	{
-		return written;
+		return used(writeIdx.load(std::memory_order_acquire), readIdx.load(std::memory_order_relaxed));
 	}
 
-	SIZE write(const void *buff, SIZE size)
-	{
-		if(size > freeSpace())
-			size = freeSpace();
-
-		char *writePos = end;
-		iterateTimes(size, i)
-		{
-			//logMsg("addr %p", writePos);
-			*writePos = ((char*)buff)[i];
-			writePos = advanceAddr(writePos, 1);
-		}
-		end = writePos;
-		written += size;
-
-		assert((SIZE)written <= buffSize);
+	// producer functions
 
-		//logMsg("wrote %d bytes", (int)size);
+	SIZE write(const void *data, SIZE size)
+	{
+		auto w = writeIdx.load(std::memory_order_relaxed);
+		auto r = readIdx.load(std::memory_order_acquire);
+		size = std::min(size, buffSize - used(w, r));
+		if(!size)
+			return 0;
+		auto pos = offset(w);
+		auto firstSize = std::min(size, buffSize - pos);
+		memcpy(&buff[pos], data, firstSize);
+		memcpy(buff, (const char*)data + firstSize, size - firstSize);
+		writeIdx.store(advance(w, size), std::memory_order_release);
 		return size;
 	}
 
+	Span writeSpan() const
+	{
+		auto w = writeIdx.load(std::memory_order_relaxed);
+		auto r = readIdx.load(std::memory_order_acquire);
+		auto pos = offset(w);
+		return {&buff[pos], std::min(buffSize - used(w, r), buffSize - pos)};
+	}
+
 	char *writeAddr() const
 	{
-		return end;
+		return &buff[offset(writeIdx.load(std::memory_order_relaxed))];
 	}
 
 	void commitWrite(SIZE size)
 	{
 		assert(size <= freeSpace());
-		end = advanceAddr(end, size);
-		written += size;
+		writeIdx.store(advance(writeIdx.load(std::memory_order_relaxed), size), std::memory_order_release);
 	}
 
-	SIZE read(void *buff, SIZE size)
-	{
-		if(size > (SIZE)written)
-			size = written;
+	// consumer functions
 
-		char *readPos = start;
-		iterateTimes(size, i)
-		{
-			//logMsg("addr %p", readPos);
-			((char*)buff)[i] = *readPos;
-			readPos = advanceAddr(readPos, 1);
-		}
-		start = readPos;
-		written -= size;
-
-		//logMsg("read %d bytes", (int)size);
+	SIZE read(void *data, SIZE size)
+	{
+		auto r = readIdx.load(std::memory_order_relaxed);
+		auto w = writeIdx.load(std::memory_order_acquire);
+		size = std::min(size, used(w, r));
+		if(!size)
+			return 0;
+		auto pos = offset(r);
+		auto firstSize = std::min(size, buffSize - pos);
+		memcpy(data, &buff[pos], firstSize);
+		memcpy((char*)data + firstSize, buff, size - firstSize);
+		readIdx.store(advance(r, size), std::memory_order_release);
 		return size;
 	}
 
+	Span readSpan() const
+	{
+		auto r = readIdx.load(std::memory_order_relaxed);
+		auto w = writeIdx.load(std::memory_order_acquire);
+		auto pos = offset(r);
+		return {&buff[pos], std::min(used(w, r), buffSize - pos)};
+	}
+
 	char *readAddr() const
 	{
-		return start;
+		return &buff[offset(readIdx.load(std::memory_order_relaxed))];
 	}
 
 	void commitRead(SIZE size)
 	{
-		assert(size <= (SIZE)written);
-		start = advanceAddr(start, size);
-		written -= size;
+		assert(size <= writtenSize());
+		readIdx.store(advance(readIdx.load(std::memory_order_relaxed), size), std::memory_order_release);
+	}
+
+	// drop all written data by moving the read index up to the write index
+	void discard()
+	{
+		readIdx.store(writeIdx.load(std::memory_order_acquire), std::memory_order_release);
 	}
 
 	// given an address inside the ring buffer, return the address
 	// after moving the pointer forward, wrapping as needed
 	char *advanceAddr(char *ptr, SIZE size) const
 	{
-		assert(ptr >= buff && ptr < buff+buffSize*2);
+		assert(ptr >= buff && ptr < buff + buffSize);
 		ptr += size;
-		if(ptr >= buff+buffSize)
+		if(ptr >= buff + buffSize)
 			ptr -= buffSize;
 		return ptr;
 	}
 
 private:
-	char *buff{};
-	char *start{}, *end{};
-	COUNT written{};
+	// indices run from 0 to 2 * buffSize - 1 so a full buffer
+	// can be told apart from an empty one without a shared counter
+	static constexpr unsigned CACHE_LINE_SIZE = 64;
+	alignas(CACHE_LINE_SIZE) std::atomic<SIZE> writeIdx{};
+	alignas(CACHE_LINE_SIZE) std::atomic<SIZE> readIdx{};
+	alignas(CACHE_LINE_SIZE) char *buff{};
 	SIZE buffSize{};
+
+	SIZE used(SIZE w, SIZE r) const
+	{
+		return w >= r ? w - r : w + 2 * buffSize - r;
+	}
+
+	SIZE offset(SIZE idx) const
+	{
+		return idx >= buffSize ? idx - buffSize : idx;
+	}
+
+	SIZE advance(SIZE idx, SIZE size) const
+	{
+		idx += size;
+		if(idx >= 2 * buffSize)
+			idx -= 2 * buffSize;
+		return idx;
+	}
 };
 
-template <class COUNT = std::atomic_uint, class SIZE = unsigned int>
-class RingBuffer : public StaticRingBuffer<COUNT, SIZE>
+template <class SIZE = unsigned int>
+class RingBuffer : public StaticRingBuffer<SIZE>
 {
 public:
-	using StaticRingBuffer<COUNT, SIZE>::StaticRingBuffer;
+	using StaticRingBuffer<SIZE>::StaticRingBuffer;
 
 	~RingBuffer()
 	{
-		StaticRingBuffer<COUNT, SIZE>::deinit();
+		StaticRingBuffer<SIZE>::deinit();
 	}
 };
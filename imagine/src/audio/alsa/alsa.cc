@@ -23,9 +23,11 @@
 #include <alsa/asoundlib.h>
 #include <sys/time.h>
 #include <math.h>
+#include <atomic>
 #include <imagine/audio/Audio.hh>
 #include <imagine/logger/logger.h>
 #include <imagine/base/Base.hh>
+#include <imagine/util/ringbuffer/RingBuffer.hh>
 #include "alsautils.h"
 
 namespace Audio
@@ -36,6 +38,11 @@ static snd_pcm_t *pcmHnd{};
 static snd_pcm_uframes_t bufferSize, periodSize;
 static bool useMmap;
 static uint wantedLatency = 100000;
+// holds up to a period of samples the device can't accept yet so they aren't dropped,
+// both filled and drained by writePcm()
+static StaticRingBuffer<> rBuff{};
+// set by clearPcm(), the ring is emptied on the next writePcm()
+static std::atomic_bool clearRingBuffer{};
 
 int maxRate()
 {
@@ -83,7 +90,7 @@ int frameDelay()
 		return 0;
 	snd_pcm_sframes_t delay;
 	snd_pcm_delay(pcmHnd, &delay);
-	return delay;
+	return delay + pcmFormat.bytesToFrames(rBuff.writtenSize());
 }
 
 int framesFree()
@@ -96,7 +103,14 @@ int framesFree()
 		logWarn("error %d getting frames free", (int)frames);
 		frames = 0;
 	}
-	return frames;
+	return std::max((int)frames - (int)pcmFormat.bytesToFrames(rBuff.writtenSize()), 0);
+}
+
+int bufferFrames()
+{
+	if(unlikely(!isOpen()))
+		return 0;
+	return bufferSize;
 }
 
 void pausePcm()
@@ -134,6 +148,7 @@ void clearPcm()
 	logMsg("clearing queued samples");
 	snd_pcm_drop(pcmHnd);
 	snd_pcm_prepare(pcmHnd);
+	clearRingBuffer.store(true, std::memory_order_release);
 }
 
 class AlsaMmapContext : public BufferContext
@@ -188,20 +203,48 @@ public:
 	}
 };
 
+static void writeRingBuffer(snd_pcm_sframes_t framesFreeOnHW)
+{
+	while(framesFreeOnHW > 0)
+	{
+		auto span = rBuff.readSpan();
+		auto frames = std::min((snd_pcm_sframes_t)pcmFormat.bytesToFrames(span.size), framesFreeOnHW);
+		if(!frames)
+			break;
+		auto written = useMmap ? snd_pcm_mmap_writei(pcmHnd, span.data, frames)
+			: snd_pcm_writei(pcmHnd, span.data, frames);
+		if(written < 0)
+		{
+			logWarn("error writing %d frames: %s", (int)frames, alsaPcmWriteErrorToString(written));
+			break;
+		}
+		rBuff.commitRead(pcmFormat.framesToBytes(written));
+		if(written != frames)
+		{
+			logWarn("only %ld of %d frames written", written, (int)frames);
+			break;
+		}
+		framesFreeOnHW -= written;
+	}
+}
+
 void writePcm(const void *samples, uint framesToWrite)
 {
 	if(unlikely(!isOpen()))
 		return;
 
-	auto framesFreeOnHW = framesFree();
+	if(clearRingBuffer.exchange(false, std::memory_order_acquire))
+		rBuff.discard();
+
+	auto framesFreeOnHW = snd_pcm_avail_update(pcmHnd);
 
 	// verify PCM state
 	switch((int)snd_pcm_state(pcmHnd))
 	{
 		bcase SND_PCM_STATE_XRUN:
 			snd_pcm_recover(pcmHnd, -EPIPE, 0);
-			framesFreeOnHW = framesFree();
-			logMsg("recovered from xrun, %d frames free", framesFreeOnHW);
+			framesFreeOnHW = snd_pcm_avail_update(pcmHnd);
+			logMsg("recovered from xrun, %d frames free", (int)framesFreeOnHW);
 		bcase SND_PCM_STATE_PAUSED:
 			logMsg("unpausing PCM");
 			snd_pcm_pause(pcmHnd, 0);
@@ -224,45 +267,18 @@ void writePcm(const void *samples, uint framesToWrite)
 		}
 	}*/
 
-	if(framesFreeOnHW < (int)framesToWrite)
-	{
-		logWarn("sending %d frames but only %d free", framesToWrite, framesFreeOnHW);
-		framesToWrite = framesFreeOnHW;
-	}
-	snd_pcm_sframes_t written;
-	if(useMmap)
+	if(framesFreeOnHW < 0)
 	{
-		written = snd_pcm_mmap_writei(pcmHnd, samples, framesToWrite);
-		/*AlsaMmapContext ctx;
-		//logMsg("starting mmap loop");
-		auto samplePtr = (char*)samples;
-		for(snd_pcm_uframes_t frames; framesToWrite; framesToWrite -= frames)
-		{
-			frames = framesToWrite;
-			if(ctx.begin(pcmHnd, &frames) != OK)
-				return;
-			assert(frames <= framesToWrite);
-
-			memcpy(ctx.data, samples, pcmFormat.framesToBytes(frames));
-			samplePtr += pcmFormat.framesToBytes(frames);
-
-			if(ctx.commit(frames) != OK)
-				return;
-		}*/
+		logWarn("error %d getting frames free", (int)framesFreeOnHW);
+		framesFreeOnHW = 0;
 	}
-	else
+	auto bytes = pcmFormat.framesToBytes(framesToWrite);
+	auto bytesBuffered = rBuff.write(samples, bytes);
+	if(bytesBuffered != bytes)
 	{
-		written = snd_pcm_writei(pcmHnd, samples, framesToWrite);
-	}
-	if(written != (snd_pcm_sframes_t)framesToWrite)
-	{
-		if(written < 0)
-		{
-			logWarn("error writing %d frames: %s", framesToWrite, alsaPcmWriteErrorToString(written));
-		}
-		else
-			logWarn("only %ld of %d frames written", written, framesToWrite);
+		logWarn("sending %d frames but only %d free", framesToWrite, (int)pcmFormat.bytesToFrames(bytesBuffered));
 	}
+	writeRingBuffer(framesFreeOnHW);
 }
 
 static int setupPcm(const PcmFormat &format, snd_pcm_access_t access)
@@ -339,6 +355,10 @@ static std::error_code openAlsaPcm(const PcmFormat &format)
 	//snd_pcm_dump(alsaHnd, output);
 	//logMsg("pcm state: %s", alsaPcmStateToString(snd_pcm_state(pcmHnd)));
 
+	if(!rBuff.init(format.framesToBytes(periodSize)))
+	{
+		ec = {ENOMEM, std::system_category()}; goto CLEANUP;
+	}
 	return {};
 
 	CLEANUP:
@@ -359,6 +379,8 @@ static void closeAlsaPcm()
 		logDMsg("closing pcm");
 		snd_pcm_close(pcmHnd);
 		pcmHnd = nullptr;
+		rBuff.deinit();
+		clearRingBuffer = false;
 	}
 }
 
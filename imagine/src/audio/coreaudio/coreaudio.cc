@@ -257,4 +257,9 @@ int framesFree()
 	return rBuff.freeSpace() / streamFormat.mBytesPerFrame;
 }
 
+int bufferFrames()
+{
+	return (rBuff.freeSpace() + rBuff.writtenSize()) / streamFormat.mBytesPerFrame;
+}
+
 }
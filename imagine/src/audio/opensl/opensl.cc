@@ -21,8 +21,9 @@
 #include "../../base/android/android.hh"
 #include <SLES/OpenSLES.h>
 #include <SLES/OpenSLES_Android.h>
-#include <imagine/util/ringbuffer/LinuxRingBuffer.hh>
-using RingBufferType = StaticLinuxRingBuffer<>;
+#include <imagine/util/ringbuffer/RingBuffer.hh>
+#include <atomic>
+using RingBufferType = StaticRingBuffer<>;
 
 namespace Audio
 {
@@ -38,6 +39,9 @@ static bool reachedEndOfPlayback = false;
 static RingBufferType rBuff{};
 static uint unqueuedBytes = 0; // number of bytes in ring buffer that haven't been enqueued to SL yet
 static char *ringBuffNextQueuePos{};
+// set by clearPcm(), the ring is reset by the next writer since the
+// queue positions belong to the producer
+static std::atomic_bool clearRingBuffer{};
 
 int maxRate()
 {
@@ -195,6 +199,7 @@ void closePcm()
 		rBuff.deinit();
 		reachedEndOfPlayback = false;
 		unqueuedBytes = 0;
+		clearRingBuffer = false;
 	}
 	else
 		logMsg("called closePcm when pcm already off");
@@ -249,6 +254,17 @@ void clearPcm()
 	pausePcm();
 	SLresult result = (*slBuffQI)->Clear(slBuffQI);
 	assert(result == SL_RESULT_SUCCESS);
+	clearRingBuffer.store(true, std::memory_order_release);
+}
+
+// called by the producer before writing, the player is paused
+// so the queue callback isn't reading from the ring
+static void applyClear()
+{
+	if(likely(!clearRingBuffer.exchange(false, std::memory_order_acquire)))
+		return;
+	// drop any buffers enqueued between clearPcm() and now
+	(*slBuffQI)->Clear(slBuffQI);
 	rBuff.reset();
 	ringBuffNextQueuePos = rBuff.writeAddr();
 	unqueuedBytes = 0;
@@ -294,8 +310,11 @@ int contiguousFramesFree()
 
 BufferContext getPlayBuffer(uint wantedFrames)
 {
-	// use contiguousFramesFree() since we may have a plain ring buffer without mirroring
-	if(unlikely(!isOpen() || !contiguousFramesFree()))
+	// only return the space up to the end of the ring buffer
+	if(unlikely(!isOpen()))
+		return {};
+	applyClear();
+	if(unlikely(!contiguousFramesFree()))
 		return {};
 	if((uint)contiguousFramesFree() < wantedFrames)
 	{
@@ -316,6 +335,7 @@ void writePcm(const void *samples, uint framesToWrite)
 {
 	if(unlikely(!isOpen()))
 		return;
+	applyClear();
 	uint bytes = pcmFormat.framesToBytes(framesToWrite);
 	auto written = rBuff.write(samples, bytes);
 	if(written != bytes)
@@ -335,6 +355,11 @@ int framesFree()
 	return pcmFormat.bytesToFrames(rBuff.freeSpace());
 }
 
+int bufferFrames()
+{
+	return pcmFormat.bytesToFrames(rBuff.capacity());
+}
+
 void setHintStrictUnderrunCheck(bool on)
 {
 	strictUnderrunCheck = on;
@@ -18,6 +18,7 @@
 #include <imagine/logger/logger.h>
 #include <imagine/base/Base.hh>
 #include <imagine/util/ScopeGuard.hh>
+#include <imagine/util/ringbuffer/RingBuffer.hh>
 #include <pulse/pulseaudio.h>
 #ifdef CONFIG_AUDIO_PULSEAUDIO_GLIB
 #include <pulse/glib-mainloop.h>
@@ -33,6 +34,11 @@ static uint wantedLatency = 100000;
 static pa_context* context{};
 static pa_stream* stream{};
 static bool isCorked = true;
+static uint targetBufferBytes = 0; // tlength set by the server
+// holds up to minreq bytes the stream can't accept yet, filled without
+// locking by writePcm(), drained or discarded with the main loop locked
+// by writePcm(), clearPcm() and the write callback
+static StaticRingBuffer<> rBuff{};
 
 #ifdef CONFIG_AUDIO_PULSEAUDIO_GLIB
 static pa_glib_mainloop* mainloop{};
@@ -170,7 +176,7 @@ int frameDelay()
 		logErr("error getting stream latency");
 		return 0;
 	}
-	return pcmFormat.uSecsToFrames(delay);
+	return pcmFormat.uSecsToFrames(delay) + pcmFormat.bytesToFrames(rBuff.writtenSize());
 }
 
 int framesFree()
@@ -181,7 +187,14 @@ int framesFree()
 	lockMainLoop();
 	auto bytes = pa_stream_writable_size(stream);
 	unlockMainLoop();
-	return pcmFormat.bytesToFrames(bytes);
+	return std::max((int)pcmFormat.bytesToFrames(bytes) - (int)pcmFormat.bytesToFrames(rBuff.writtenSize()), 0);
+}
+
+int bufferFrames()
+{
+	if(unlikely(!isOpen()))
+		return 0;
+	return pcmFormat.bytesToFrames(targetBufferBytes);
 }
 
 void pausePcm()
@@ -214,43 +227,45 @@ void clearPcm()
 	logMsg("clearing queued samples");
 	lockMainLoop();
 	pa_stream_flush(stream, nullptr, nullptr);
+	rBuff.discard();
 	unlockMainLoop();
 	iterateMainLoop();
 }
 
+// called with the main loop locked
+static void writeRingBuffer(size_t bytesFreeOnHW)
+{
+	while(bytesFreeOnHW)
+	{
+		auto span = rBuff.readSpan();
+		auto bytes = std::min((size_t)span.size, bytesFreeOnHW);
+		if(!bytes)
+			break;
+		if(pa_stream_write(stream, span.data, bytes, nullptr, 0, PA_SEEK_RELATIVE) < 0)
+		{
+			logWarn("error writing %d bytes", (int)bytes);
+			break;
+		}
+		rBuff.commitRead(bytes);
+		bytesFreeOnHW -= bytes;
+	}
+}
+
 void writePcm(const void *samples, uint framesToWrite)
 {
 	if(unlikely(!isOpen()))
 		return;
 
-	iterateMainLoop();
-	lockMainLoop(); // TODO: locking here is sub-optimal, writes should be async using a ring-buffer
-	auto bytesFreeOnHW = pa_stream_writable_size(stream);
-	auto framesFreeOnHW = pcmFormat.bytesToFrames(bytesFreeOnHW);
-	auto bytesToWrite = pcmFormat.framesToBytes(framesToWrite);
-	//logMsg("writing %d frames, %d free", framesToWrite, framesFreeOnHW);
-	/*{
-		static uint framesToWriteAvg = 0, writeCount = 0;
-		framesToWriteAvg += framesToWrite;
-		writeCount++;
-		if(writeCount == 120)
-		{
-			logMsg("avg frames: %f, %d free", framesToWriteAvg / (double)120., framesFree());
-			framesToWriteAvg = 0;
-			writeCount = 0;
-		}
-	}*/
-	if(framesFreeOnHW < framesToWrite)
+	auto bytes = pcmFormat.framesToBytes(framesToWrite);
+	auto bytesBuffered = rBuff.write(samples, bytes);
+	if(bytesBuffered != bytes)
 	{
-		logWarn("sending %d frames but only %d free", framesToWrite, framesFreeOnHW);
-		bytesToWrite = bytesFreeOnHW;
+		logWarn("sending %d frames but only %d free", framesToWrite, (int)pcmFormat.bytesToFrames(bytesBuffered));
 	}
-	int err = pa_stream_write(stream, samples, bytesToWrite, nullptr, 0, PA_SEEK_RELATIVE);
+	iterateMainLoop();
+	lockMainLoop();
+	writeRingBuffer(pa_stream_writable_size(stream));
 	unlockMainLoop();
-	if(err < 0)
-	{
-		logWarn("error writing %d bytes", bytesToWrite);
-	}
 	iterateMainLoop();
 }
 
@@ -380,8 +395,15 @@ std::error_code openPcm(const PcmFormat &format)
 		return {EINVAL, std::system_category()};
 	}
 	auto serverAttr = pa_stream_get_buffer_attr(stream);
-	unlockMainLoop();
 	assert(serverAttr);
+	targetBufferBytes = serverAttr->tlength;
+	rBuff.init(format.framesToBytes(format.bytesToFrames(serverAttr->minreq)));
+	pa_stream_set_write_callback(stream,
+		[](pa_stream *, size_t nbytes, void *)
+		{
+			writeRingBuffer(nbytes);
+		}, nullptr);
+	unlockMainLoop();
 	isCorked = false;
 	logMsg("opened stream with target fill bytes: %d", serverAttr->tlength);
 	return {};
@@ -395,12 +417,14 @@ void closePcm()
 		return;
 	}
 	lockMainLoop();
+	pa_stream_set_write_callback(stream, nullptr, nullptr);
 	pa_stream_disconnect(stream);
 	pa_stream_unref(stream);
 	unlockMainLoop();
 	iterateMainLoop();
 	isCorked = true;
 	stream = nullptr;
+	rBuff.deinit();
 }
 
 bool isOpen()
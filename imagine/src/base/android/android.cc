@@ -70,6 +70,8 @@ JavaInstMethod<jint()> jWinFormat{}, jWinFlags{};
 
 uint appActivityState() { return appState; }
 
+bool isHeadless() { return false; }
+
 void exit(int returnVal)
 {
 	// TODO: return exit value as activity result
@@ -92,6 +92,8 @@ uint appState = APP_RUNNING;
 
 uint appActivityState() { return appState; }
 
+bool isHeadless() { return false; }
+
 static Screen &setupUIScreen(UIScreen *screen, bool setOverscanCompensation)
 {
 	// prevent overscan compensation
@@ -29,18 +29,22 @@ namespace Base
 {
 
 static FS::PathString appPath{};
+static bool headless = false;
 extern void runMainEventLoop();
 extern void initMainEventLoop();
 
 uint appActivityState() { return APP_RUNNING; }
 
+bool isHeadless() { return headless; }
+
 static void cleanup()
 {
 	#ifdef CONFIG_BASE_DBUS
 	deinitDBus();
 	#endif
 	#ifdef CONFIG_BASE_X11
-	deinitWindowSystem();
+	if(!headless)
+		deinitWindowSystem();
 	#endif
 }
 
@@ -147,7 +151,14 @@ int main(int argc, char** argv)
 	logger_init();
 	engineInit();
 	appPath = FS::makeAppPathFromLaunchCommand(argv[0]);
+	headless = argc > 1 && !strcmp(argv[1], "--headless");
 	initMainEventLoop();
+	if(headless)
+	{
+		logMsg("running headless");
+		onInit(argc, argv);
+		return 0;
+	}
 	#ifdef CONFIG_BASE_X11
 	EventLoopFileSource x11Src;
 	if(initWindowSystem(x11Src) != OK)
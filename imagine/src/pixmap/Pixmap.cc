@@ -15,6 +15,7 @@
 
 #define LOGTAG "Pixmap"
 #include <imagine/pixmap/Pixmap.hh>
+#include <imagine/pixmap/PixmapConvert.hh>
 #include <imagine/logger/logger.h>
 #include <imagine/util/assume.h>
 #include <imagine/util/algorithm.h>
@@ -30,7 +31,13 @@ char *Pixmap::pixel(IG::WP pos) const
 
 void Pixmap::write(const IG::Pixmap &pixmap)
 {
-	assumeExpr(format() == pixmap.format());
+	if(format() != pixmap.format())
+	{
+		// callers must only pass formats canConvertPixmap() accepts
+		bool converted = convertPixmap(subPixmap({}, pixmap.size()), pixmap);
+		assumeExpr(converted);
+		return;
+	}
 	if(w() == pixmap.w() && !isPadded() && !pixmap.isPadded())
 	{
 		// whole block
@@ -0,0 +1,491 @@
+/*  This file is part of Imagine.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with Imagine.  If not, see <http://www.gnu.org/licenses/> */
+
+#define LOGTAG "PixmapConvert"
+#include <imagine/pixmap/PixmapConvert.hh>
+#include <imagine/logger/logger.h>
+#include <imagine/util/assume.h>
+#include <imagine/util/algorithm.h>
+#include <imagine/util/utility.h>
+#include <cstring>
+#include <type_traits>
+#if defined __ARM_NEON__ || defined __ARM_NEON
+#define PIXMAP_CONVERT_NEON
+#include <arm_neon.h>
+#elif defined __SSE2__
+#define PIXMAP_CONVERT_SSE2
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#endif
+
+namespace IG
+{
+
+using RowConvertFunc = void (*)(void *dest, const void *src, uint pixels);
+
+// byte offsets of the color components in formats stored as separate bytes
+template <uint BPP, uint R, uint B>
+struct ByteLayout
+{
+	static constexpr uint bpp = BPP, r = R, b = B;
+};
+
+using LayoutRGBA8888 = ByteLayout<4, 0, 2>;
+using LayoutBGRA8888 = ByteLayout<4, 2, 0>;
+using LayoutRGB888 = ByteLayout<3, 0, 2>;
+
+template <class DEST>
+static void rgb565ToBytes(void *dest, const void *src, uint pixels)
+{
+	auto s = (const uint16*)src;
+	auto d = (uint8*)dest;
+	iterateTimes(pixels, i)
+	{
+		uint p = s[i];
+		uint r = p >> 11, g = (p >> 5) & 0x3F, b = p & 0x1F;
+		d[DEST::r] = (r << 3) | (r >> 2);
+		d[1] = (g << 2) | (g >> 4);
+		d[DEST::b] = (b << 3) | (b >> 2);
+		if(DEST::bpp == 4)
+			d[3] = 0xFF;
+		d += DEST::bpp;
+	}
+}
+
+template <class SRC>
+static void bytesToRGB565(void *dest, const void *src, uint pixels)
+{
+	auto s = (const uint8*)src;
+	auto d = (uint16*)dest;
+	iterateTimes(pixels, i)
+	{
+		d[i] = ((s[SRC::r] & 0xF8) << 8) | ((s[1] & 0xFC) << 3) | (s[SRC::b] >> 3);
+		s += SRC::bpp;
+	}
+}
+
+template <class DEST, class SRC>
+static void bytesToBytes(void *dest, const void *src, uint pixels)
+{
+	auto s = (const uint8*)src;
+	auto d = (uint8*)dest;
+	iterateTimes(pixels, i)
+	{
+		d[DEST::r] = s[SRC::r];
+		d[1] = s[1];
+		d[DEST::b] = s[SRC::b];
+		if(DEST::bpp == 4)
+			d[3] = SRC::bpp == 4 ? s[3] : 0xFF;
+		s += SRC::bpp;
+		d += DEST::bpp;
+	}
+}
+
+#if defined PIXMAP_CONVERT_NEON
+
+template <class DEST>
+static void rgb565ToBytesNEON(void *dest, const void *src, uint pixels)
+{
+	auto s = (const uint16*)src;
+	auto d = (uint8*)dest;
+	for(; pixels >= 8; pixels -= 8, s += 8, d += 8 * DEST::bpp)
+	{
+		uint16x8_t p = vld1q_u16(s);
+		// shift each component to the top of a byte and replicate its high bits into the low ones
+		uint8x8_t r = vand_u8(vshrn_n_u16(p, 8), vdup_n_u8(0xF8));
+		uint8x8_t g = vand_u8(vshrn_n_u16(p, 3), vdup_n_u8(0xFC));
+		uint8x8_t b = vmovn_u16(vshlq_n_u16(p, 3));
+		r = vsri_n_u8(r, r, 5);
+		g = vsri_n_u8(g, g, 6);
+		b = vsri_n_u8(b, b, 5);
+		if(DEST::bpp == 4)
+		{
+			uint8x8x4_t out;
+			out.val[DEST::r] = r;
+			out.val[1] = g;
+			out.val[DEST::b] = b;
+			out.val[3] = vdup_n_u8(0xFF);
+			vst4_u8(d, out);
+		}
+		else
+		{
+			uint8x8x3_t out;
+			out.val[DEST::r] = r;
+			out.val[1] = g;
+			out.val[DEST::b] = b;
+			vst3_u8(d, out);
+		}
+	}
+	rgb565ToBytes<DEST>(d, s, pixels);
+}
+
+template <class SRC>
+static uint8x8x3_t loadRGB8NEON(const uint8 *s)
+{
+	uint8x8x3_t rgb;
+	if(SRC::bpp == 4)
+	{
+		uint8x8x4_t p = vld4_u8(s);
+		rgb.val[0] = p.val[SRC::r];
+		rgb.val[1] = p.val[1];
+		rgb.val[2] = p.val[SRC::b];
+	}
+	else
+	{
+		uint8x8x3_t p = vld3_u8(s);
+		rgb.val[0] = p.val[SRC::r];
+		rgb.val[1] = p.val[1];
+		rgb.val[2] = p.val[SRC::b];
+	}
+	return rgb;
+}
+
+template <class SRC>
+static void bytesToRGB565NEON(void *dest, const void *src, uint pixels)
+{
+	auto s = (const uint8*)src;
+	auto d = (uint16*)dest;
+	for(; pixels >= 8; pixels -= 8, s += 8 * SRC::bpp, d += 8)
+	{
+		auto rgb = loadRGB8NEON<SRC>(s);
+		uint16x8_t p = vshll_n_u8(rgb.val[0], 8);
+		p = vsriq_n_u16(p, vshll_n_u8(rgb.val[1], 8), 5);
+		p = vsriq_n_u16(p, vshll_n_u8(rgb.val[2], 8), 11);
+		vst1q_u16(d, p);
+	}
+	bytesToRGB565<SRC>(d, s, pixels);
+}
+
+template <class DEST, class SRC>
+static void bytesToBytesNEON(void *dest, const void *src, uint pixels)
+{
+	auto s = (const uint8*)src;
+	auto d = (uint8*)dest;
+	for(; pixels >= 8; pixels -= 8, s += 8 * SRC::bpp, d += 8 * DEST::bpp)
+	{
+		if(SRC::bpp == 4 && DEST::bpp == 4)
+		{
+			// keep the source alpha
+			uint8x8x4_t p = vld4_u8(s);
+			uint8x8x4_t out = p;
+			out.val[DEST::r] = p.val[SRC::r];
+			out.val[DEST::b] = p.val[SRC::b];
+			vst4_u8(d, out);
+			continue;
+		}
+		auto rgb = loadRGB8NEON<SRC>(s);
+		if(DEST::bpp == 4)
+		{
+			uint8x8x4_t out;
+			out.val[DEST::r] = rgb.val[0];
+			out.val[1] = rgb.val[1];
+			out.val[DEST::b] = rgb.val[2];
+			out.val[3] = vdup_n_u8(0xFF);
+			vst4_u8(d, out);
+		}
+		else
+		{
+			uint8x8x3_t out;
+			out.val[DEST::r] = rgb.val[0];
+			out.val[1] = rgb.val[1];
+			out.val[DEST::b] = rgb.val[2];
+			vst3_u8(d, out);
+		}
+	}
+	bytesToBytes<DEST, SRC>(d, s, pixels);
+}
+
+#elif defined PIXMAP_CONVERT_SSE2
+
+template <bool BGR>
+static void rgb565To32SSE2(void *dest, const void *src, uint pixels)
+{
+	auto s = (const uint16*)src;
+	auto d = (uint32*)dest;
+	const __m128i mask5 = _mm_set1_epi16(0x1F), mask6 = _mm_set1_epi16(0x3F),
+		alpha = _mm_set1_epi16((short)0xFF00);
+	for(; pixels >= 8; pixels -= 8, s += 8, d += 8)
+	{
+		__m128i p = _mm_loadu_si128((const __m128i*)s);
+		__m128i r = _mm_srli_epi16(p, 11);
+		__m128i g = _mm_and_si128(_mm_srli_epi16(p, 5), mask6);
+		__m128i b = _mm_and_si128(p, mask5);
+		r = _mm_or_si128(_mm_slli_epi16(r, 3), _mm_srli_epi16(r, 2));
+		g = _mm_or_si128(_mm_slli_epi16(g, 2), _mm_srli_epi16(g, 4));
+		b = _mm_or_si128(_mm_slli_epi16(b, 3), _mm_srli_epi16(b, 2));
+		// 16-bit lanes holding bytes 0-1 and 2-3 of each pixel, interleaved into 32-bit pixels
+		__m128i lo = _mm_or_si128(BGR ? b : r, _mm_slli_epi16(g, 8));
+		__m128i hi = _mm_or_si128(BGR ? r : b, alpha);
+		_mm_storeu_si128((__m128i*)d, _mm_unpacklo_epi16(lo, hi));
+		_mm_storeu_si128((__m128i*)(d + 4), _mm_unpackhi_epi16(lo, hi));
+	}
+	using Layout = typename std::conditional<BGR, LayoutBGRA8888, LayoutRGBA8888>::type;
+	rgb565ToBytes<Layout>(d, s, pixels);
+}
+
+template <bool BGR>
+static __m128i pack32To565SSE2(__m128i p)
+{
+	const __m128i byteMask = _mm_set1_epi32(0xFF);
+	__m128i c0 = _mm_and_si128(p, byteMask);
+	__m128i g = _mm_and_si128(_mm_srli_epi32(p, 8), byteMask);
+	__m128i c2 = _mm_and_si128(_mm_srli_epi32(p, 16), byteMask);
+	__m128i r = BGR ? c2 : c0, b = BGR ? c0 : c2;
+	__m128i v = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(r, _mm_set1_epi32(0xF8)), 8),
+		_mm_or_si128(_mm_slli_epi32(_mm_and_si128(g, _mm_set1_epi32(0xFC)), 3), _mm_srli_epi32(b, 3)));
+	// sign extend so the signed saturating pack keeps all 16 bits
+	return _mm_srai_epi32(_mm_slli_epi32(v, 16), 16);
+}
+
+template <bool BGR>
+static void bytes32ToRGB565SSE2(void *dest, const void *src, uint pixels)
+{
+	auto s = (const uint32*)src;
+	auto d = (uint16*)dest;
+	for(; pixels >= 8; pixels -= 8, s += 8, d += 8)
+	{
+		__m128i p0 = pack32To565SSE2<BGR>(_mm_loadu_si128((const __m128i*)s));
+		__m128i p1 = pack32To565SSE2<BGR>(_mm_loadu_si128((const __m128i*)(s + 4)));
+		_mm_storeu_si128((__m128i*)d, _mm_packs_epi32(p0, p1));
+	}
+	using Layout = typename std::conditional<BGR, LayoutBGRA8888, LayoutRGBA8888>::type;
+	bytesToRGB565<Layout>(d, s, pixels);
+}
+
+static void swapRB32SSE2(void *dest, const void *src, uint pixels)
+{
+	auto s = (const uint32*)src;
+	auto d = (uint32*)dest;
+	const __m128i gaMask = _mm_set1_epi32(0xFF00FF00), rbMask = _mm_set1_epi32(0x00FF00FF);
+	for(; pixels >= 4; pixels -= 4, s += 4, d += 4)
+	{
+		__m128i p = _mm_loadu_si128((const __m128i*)s);
+		__m128i rb = _mm_and_si128(p, rbMask);
+		rb = _mm_or_si128(_mm_srli_epi32(rb, 16), _mm_slli_epi32(rb, 16));
+		_mm_storeu_si128((__m128i*)d, _mm_or_si128(_mm_and_si128(p, gaMask), rb));
+	}
+	bytesToBytes<LayoutBGRA8888, LayoutRGBA8888>(d, s, pixels);
+}
+
+// 24-bit formats need byte shuffles, only available with SSSE3 so they're selected at runtime
+
+static bool hasSSSE3()
+{
+	static const bool supported =
+		[]()
+		{
+			__builtin_cpu_init();
+			return (bool)__builtin_cpu_supports("ssse3");
+		}();
+	return supported;
+}
+
+template <bool BGR>
+__attribute__((target("ssse3"))) static void bytes24To32SSSE3(void *dest, const void *src, uint pixels)
+{
+	auto s = (const uint8*)src;
+	auto d = (uint32*)dest;
+	const __m128i shuffle = BGR ?
+		_mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1) :
+		_mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+	const __m128i alpha = _mm_set1_epi32(0xFF000000);
+	// each 16 byte load uses 4 pixels, stop early enough to not read past the row
+	for(; pixels >= 6; pixels -= 4, s += 12, d += 4)
+	{
+		__m128i p = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)s), shuffle);
+		_mm_storeu_si128((__m128i*)d, _mm_or_si128(p, alpha));
+	}
+	using Layout = typename std::conditional<BGR, LayoutBGRA8888, LayoutRGBA8888>::type;
+	bytesToBytes<Layout, LayoutRGB888>(d, s, pixels);
+}
+
+template <bool BGR>
+__attribute__((target("ssse3"))) static void bytes32To24SSSE3(void *dest, const void *src, uint pixels)
+{
+	auto s = (const uint32*)src;
+	auto d = (uint8*)dest;
+	const __m128i shuffle = BGR ?
+		_mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1) :
+		_mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+	for(; pixels >= 4; pixels -= 4, s += 4, d += 12)
+	{
+		__m128i p = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)s), shuffle);
+		_mm_storel_epi64((__m128i*)d, p);
+		uint32 last = _mm_cvtsi128_si32(_mm_srli_si128(p, 8));
+		memcpy(d + 8, &last, 4);
+	}
+	using Layout = typename std::conditional<BGR, LayoutBGRA8888, LayoutRGBA8888>::type;
+	bytesToBytes<LayoutRGB888, Layout>(d, s, pixels);
+}
+
+#endif
+
+template <class DEST>
+static RowConvertFunc rgb565ToBytesFunc()
+{
+	#if defined PIXMAP_CONVERT_NEON
+	return rgb565ToBytesNEON<DEST>;
+	#else
+	#if defined PIXMAP_CONVERT_SSE2
+	if(DEST::bpp == 4)
+		return rgb565To32SSE2<DEST::r == 2>;
+	#endif
+	return rgb565ToBytes<DEST>;
+	#endif
+}
+
+template <class SRC>
+static RowConvertFunc bytesToRGB565Func()
+{
+	#if defined PIXMAP_CONVERT_NEON
+	return bytesToRGB565NEON<SRC>;
+	#else
+	#if defined PIXMAP_CONVERT_SSE2
+	if(SRC::bpp == 4)
+		return bytes32ToRGB565SSE2<SRC::r == 2>;
+	#endif
+	return bytesToRGB565<SRC>;
+	#endif
+}
+
+template <class DEST, class SRC>
+static RowConvertFunc bytesToBytesFunc()
+{
+	#if defined PIXMAP_CONVERT_NEON
+	return bytesToBytesNEON<DEST, SRC>;
+	#else
+	#if defined PIXMAP_CONVERT_SSE2
+	if(DEST::bpp == 4 && SRC::bpp == 4)
+		return swapRB32SSE2;
+	if(hasSSSE3())
+	{
+		if(SRC::bpp == 3)
+			return bytes24To32SSSE3<DEST::r == 2>;
+		else
+			return bytes32To24SSSE3<SRC::r == 2>;
+	}
+	#endif
+	return bytesToBytes<DEST, SRC>;
+	#endif
+}
+
+static RowConvertFunc rowConvertFunc(PixelFormatID dest, PixelFormatID src)
+{
+	switch(src)
+	{
+		case PIXEL_RGB565:
+			switch(dest)
+			{
+				case PIXEL_RGBA8888: return rgb565ToBytesFunc<LayoutRGBA8888>();
+				case PIXEL_BGRA8888: return rgb565ToBytesFunc<LayoutBGRA8888>();
+				case PIXEL_RGB888: return rgb565ToBytesFunc<LayoutRGB888>();
+				default: return nullptr;
+			}
+		case PIXEL_RGBA8888:
+			switch(dest)
+			{
+				case PIXEL_RGB565: return bytesToRGB565Func<LayoutRGBA8888>();
+				case PIXEL_BGRA8888: return bytesToBytesFunc<LayoutBGRA8888, LayoutRGBA8888>();
+				case PIXEL_RGB888: return bytesToBytesFunc<LayoutRGB888, LayoutRGBA8888>();
+				default: return nullptr;
+			}
+		case PIXEL_BGRA8888:
+			switch(dest)
+			{
+				case PIXEL_RGB565: return bytesToRGB565Func<LayoutBGRA8888>();
+				case PIXEL_RGBA8888: return bytesToBytesFunc<LayoutRGBA8888, LayoutBGRA8888>();
+				case PIXEL_RGB888: return bytesToBytesFunc<LayoutRGB888, LayoutBGRA8888>();
+				default: return nullptr;
+			}
+		case PIXEL_RGB888:
+			switch(dest)
+			{
+				case PIXEL_RGB565: return bytesToRGB565Func<LayoutRGB888>();
+				case PIXEL_RGBA8888: return bytesToBytesFunc<LayoutRGBA8888, LayoutRGB888>();
+				case PIXEL_BGRA8888: return bytesToBytesFunc<LayoutBGRA8888, LayoutRGB888>();
+				default: return nullptr;
+			}
+		default: return nullptr;
+	}
+}
+
+bool canConvertPixmap(PixelFormat dest, PixelFormat src)
+{
+	return dest == src || rowConvertFunc(dest, src);
+}
+
+bool convertPixmap(const Pixmap &dest, const Pixmap &src)
+{
+	assumeExpr(dest.w() == src.w() && dest.h() == src.h());
+	if(dest.format() == src.format())
+	{
+		Pixmap{dest}.write(src);
+		return true;
+	}
+	auto convert = rowConvertFunc(dest.format(), src.format());
+	if(!convert)
+	{
+		logErr("no conversion from %s to %s", src.format().name(), dest.format().name());
+		return false;
+	}
+	if(!dest.isPadded() && !src.isPadded())
+	{
+		convert(dest.pixel({}), src.pixel({}), dest.w() * dest.h());
+		return true;
+	}
+	iterateTimes(dest.h(), y)
+	{
+		convert(dest.pixel({0, (int)y}), src.pixel({0, (int)y}), dest.w());
+	}
+	return true;
+}
+
+template <class T>
+static void paletteRow(T *d, const uint8 *s, const T *palette, uint pixels)
+{
+	// table lookups don't vectorize, unroll so the loads can overlap
+	uint i = 0;
+	for(; i + 4 <= pixels; i += 4)
+	{
+		T p0 = palette[s[i]], p1 = palette[s[i + 1]], p2 = palette[s[i + 2]], p3 = palette[s[i + 3]];
+		d[i] = p0;
+		d[i + 1] = p1;
+		d[i + 2] = p2;
+		d[i + 3] = p3;
+	}
+	for(; i < pixels; i++)
+	{
+		d[i] = palette[s[i]];
+	}
+}
+
+void convertPixmapWithPalette(const Pixmap &dest, const Pixmap &src, const void *palette)
+{
+	assumeExpr(src.format() == PIXEL_I8);
+	assumeExpr(dest.w() == src.w() && dest.h() == src.h());
+	iterateTimes(dest.h(), y)
+	{
+		auto s = (const uint8*)src.pixel({0, (int)y});
+		auto d = dest.pixel({0, (int)y});
+		switch(dest.format().bytesPerPixel())
+		{
+			bcase 2: paletteRow((uint16*)d, s, (const uint16*)palette, dest.w());
+			bcase 4: paletteRow((uint32*)d, s, (const uint32*)palette, dest.w());
+			bdefault: bug_branch("%d", dest.format().bytesPerPixel());
+		}
+	}
+}
+
+}
@@ -0,0 +1,196 @@
+/*  This file is part of Imagine.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with Imagine.  If not, see <http://www.gnu.org/licenses/> */
+
+// Times IG::convertPixmap() and IG::convertPixmapWithPalette() on a 320x240
+// frame against plain per-pixel loops, checking both give the same result.
+// Build & run from imagine (add -mssse3 or a -march to enable more kernels):
+// c++ -std=gnu++14 -O2 -Iinclude -Iinclude/imagine/override -DIMAGINE_CONFIG_H=cstddef \
+//  tests/PixmapConvertBench/PixmapConvertBench.cc src/pixmap/PixmapConvert.cc src/pixmap/Pixmap.cc \
+//  -o PixmapConvertBench && ./PixmapConvertBench
+
+#include <imagine/pixmap/PixmapConvert.hh>
+#include <imagine/logger/logger.h>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+CLINK void logger_printf(LoggerSeverity, const char *msg, ...)
+{
+	va_list args;
+	va_start(args, msg);
+	vfprintf(stderr, msg, args);
+	va_end(args);
+}
+
+CLINK void bug_doExit(const char *msg, ...)
+{
+	va_list args;
+	va_start(args, msg);
+	vfprintf(stderr, msg, args);
+	va_end(args);
+	abort();
+}
+
+using namespace IG;
+
+static constexpr int frameW = 320, frameH = 240, runs = 200;
+
+struct RGBA { uint r, g, b, a; };
+
+static RGBA readPixel(PixelFormatID format, const uint8 *p)
+{
+	switch(format)
+	{
+		case PIXEL_RGB565:
+		{
+			uint16 v;
+			memcpy(&v, p, 2);
+			uint r = v >> 11, g = (v >> 5) & 0x3F, b = v & 0x1F;
+			return {(r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2), 0xFF};
+		}
+		case PIXEL_RGBA8888: return {p[0], p[1], p[2], p[3]};
+		case PIXEL_BGRA8888: return {p[2], p[1], p[0], p[3]};
+		case PIXEL_RGB888: return {p[0], p[1], p[2], 0xFF};
+		default: abort();
+	}
+}
+
+static void writePixel(PixelFormatID format, uint8 *p, RGBA c)
+{
+	switch(format)
+	{
+		case PIXEL_RGB565:
+		{
+			uint16 v = ((c.r >> 3) << 11) | ((c.g >> 2) << 5) | (c.b >> 3);
+			memcpy(p, &v, 2);
+			return;
+		}
+		case PIXEL_RGBA8888: p[0] = c.r; p[1] = c.g; p[2] = c.b; p[3] = c.a; return;
+		case PIXEL_BGRA8888: p[0] = c.b; p[1] = c.g; p[2] = c.r; p[3] = c.a; return;
+		case PIXEL_RGB888: p[0] = c.r; p[1] = c.g; p[2] = c.b; return;
+		default: abort();
+	}
+}
+
+// the byte-at-a-time conversion that callers used before PixmapConvert
+[[gnu::noinline]] static void convertPerPixel(const Pixmap &dest, const Pixmap &src)
+{
+	auto destBPP = dest.format().bytesPerPixel(), srcBPP = src.format().bytesPerPixel();
+	for(int y = 0; y < (int)src.h(); y++)
+	{
+		auto s = (const uint8*)src.pixel({0, y});
+		auto d = (uint8*)dest.pixel({0, y});
+		for(uint x = 0; x < src.w(); x++, s += srcBPP, d += destBPP)
+		{
+			writePixel(dest.format(), d, readPixel(src.format(), s));
+		}
+	}
+}
+
+template <class T>
+[[gnu::noinline]] static void paletteConvertPerPixel(const Pixmap &dest, const Pixmap &src, const void *palette)
+{
+	for(int y = 0; y < (int)src.h(); y++)
+	{
+		auto s = (const uint8*)src.pixel({0, y});
+		auto d = (T*)dest.pixel({0, y});
+		for(uint x = 0; x < src.w(); x++)
+		{
+			d[x] = ((const T*)palette)[s[x]];
+		}
+	}
+}
+
+template <class F>
+static double bestTimeUSecs(F func)
+{
+	double best = 1e12;
+	for(int i = 0; i < runs; i++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		func();
+		auto time = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+		if(time < best)
+			best = time;
+	}
+	return best;
+}
+
+static bool report(const char *srcName, const char *destName, double convertTime, double refTime,
+	const std::vector<uint8> &out, const std::vector<uint8> &refOut)
+{
+	bool match = out == refOut;
+	printf("%-9s -> %-9s %7.1fus vs %7.1fus per-pixel (%.1fx)%s\n", srcName, destName,
+		convertTime, refTime, refTime / convertTime, match ? "" : " MISMATCH");
+	return match;
+}
+
+int main()
+{
+	const PixelFormatID formats[]{PIXEL_RGB565, PIXEL_RGBA8888, PIXEL_BGRA8888, PIXEL_RGB888};
+	bool ok = true;
+	for(auto srcID : formats)
+	{
+		PixelFormat srcFormat{srcID};
+		std::vector<uint8> srcData(srcFormat.pixelBytes(frameW * frameH));
+		for(size_t i = 0; i < srcData.size(); i++)
+			srcData[i] = i * 7 + (i >> 8);
+		Pixmap src{{{frameW, frameH}, srcFormat}, srcData.data()};
+		for(auto destID : formats)
+		{
+			PixelFormat destFormat{destID};
+			if(destID == srcID || !canConvertPixmap(destFormat, srcFormat))
+				continue;
+			std::vector<uint8> out(destFormat.pixelBytes(frameW * frameH)), refOut(out.size());
+			Pixmap dest{{{frameW, frameH}, destFormat}, out.data()};
+			Pixmap refDest{{{frameW, frameH}, destFormat}, refOut.data()};
+			auto convertTime = bestTimeUSecs([&](){ convertPixmap(dest, src); });
+			auto refTime = bestTimeUSecs([&](){ convertPerPixel(refDest, src); });
+			ok &= report(srcFormat.name(), destFormat.name(), convertTime, refTime, out, refOut);
+		}
+	}
+	std::vector<uint8> indexData(frameW * frameH);
+	for(size_t i = 0; i < indexData.size(); i++)
+		indexData[i] = i * 13 + (i >> 9);
+	Pixmap indexSrc{{{frameW, frameH}, PIXEL_FMT_I8}, indexData.data()};
+	uint32 palette32[256];
+	uint16 palette16[256];
+	for(uint i = 0; i < 256; i++)
+	{
+		palette32[i] = i * 0x01030507;
+		palette16[i] = i * 0x0103;
+	}
+	for(auto destFormat : {PIXEL_FMT_RGB565, PIXEL_FMT_RGBA8888})
+	{
+		std::vector<uint8> out(destFormat.pixelBytes(frameW * frameH)), refOut(out.size());
+		Pixmap dest{{{frameW, frameH}, destFormat}, out.data()};
+		Pixmap refDest{{{frameW, frameH}, destFormat}, refOut.data()};
+		const void *palette = destFormat.bytesPerPixel() == 2 ? (const void*)palette16 : palette32;
+		auto convertTime = bestTimeUSecs([&](){ convertPixmapWithPalette(dest, indexSrc, palette); });
+		auto refTime = bestTimeUSecs(
+			[&]()
+			{
+				if(destFormat.bytesPerPixel() == 2)
+					paletteConvertPerPixel<uint16>(refDest, indexSrc, palette);
+				else
+					paletteConvertPerPixel<uint32>(refDest, indexSrc, palette);
+			});
+		ok &= report("I8", destFormat.name(), convertTime, refTime, out, refOut);
+	}
+	return ok ? 0 : 1;
+}
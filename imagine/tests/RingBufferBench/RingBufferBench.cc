@@ -0,0 +1,183 @@
+/*  This file is part of Imagine.
+
+	Imagine is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	Imagine is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with Imagine.  If not, see <http://www.gnu.org/licenses/> */
+
+// Times write()+read() through a StaticRingBuffer against the previous
+// byte-at-a-time ring, then streams data between a producer and consumer
+// thread, with the consumer calling discard() now and then, and checks
+// nothing arrives corrupted or out of order.
+// Build & run from imagine:
+// c++ -std=gnu++14 -O2 -pthread -Iinclude tests/RingBufferBench/RingBufferBench.cc \
+//  -o RingBufferBench && ./RingBufferBench
+
+#include <imagine/util/ringbuffer/RingBuffer.hh>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+static constexpr unsigned ringSize = 16 * 1024, runs = 20;
+static constexpr size_t bytesPerRun = 16 * 1024 * 1024;
+
+// the ring used by the audio backends before the SPSC version,
+// kept here as the baseline
+class ByteRingBuffer
+{
+public:
+	ByteRingBuffer(unsigned size): buff(size) {}
+
+	unsigned write(const void *data, unsigned size)
+	{
+		size = std::min(size, (unsigned)buff.size() - written);
+		for(unsigned i = 0; i < size; i++)
+		{
+			buff[end] = ((const char*)data)[i];
+			end = end + 1 == buff.size() ? 0 : end + 1;
+		}
+		written += size;
+		return size;
+	}
+
+	unsigned read(void *data, unsigned size)
+	{
+		size = std::min(size, (unsigned)written);
+		for(unsigned i = 0; i < size; i++)
+		{
+			((char*)data)[i] = buff[start];
+			start = start + 1 == buff.size() ? 0 : start + 1;
+		}
+		written -= size;
+		return size;
+	}
+
+private:
+	std::vector<char> buff;
+	unsigned start = 0, end = 0;
+	std::atomic_uint written{};
+};
+
+template <class Ring>
+static double bestMiBPerSec(Ring &ring, unsigned chunk, bool &match)
+{
+	std::vector<char> in(chunk), out(chunk);
+	double best = 0;
+	for(unsigned r = 0; r < runs; r++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		for(size_t done = 0; done < bytesPerRun; done += chunk)
+		{
+			in[0] = done >> 8;
+			ring.write(in.data(), chunk);
+			ring.read(out.data(), chunk);
+			match &= out[0] == in[0];
+		}
+		auto secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		best = std::max(best, bytesPerRun / secs / (1024. * 1024.));
+	}
+	match &= in == out;
+	return best;
+}
+
+// producer writes an increasing uint32 sequence, the consumer must only
+// ever see it increasing, with gaps only where it discarded
+static bool streamThreaded(unsigned words, unsigned discardEvery)
+{
+	RingBuffer<> ring;
+	ring.init(ringSize);
+	std::atomic_bool done{};
+	std::thread producer{[&]()
+		{
+			uint32_t chunk[97];
+			uint32_t next = 1;
+			while(next <= words)
+			{
+				for(auto &w : chunk)
+					w = next++;
+				const char *data = (const char*)chunk;
+				unsigned left = sizeof(chunk);
+				while(left)
+				{
+					auto written = ring.write(data, left);
+					if(!written)
+						std::this_thread::yield();
+					data += written;
+					left -= written;
+				}
+			}
+			done = true;
+		}};
+	uint32_t last = 0, reads = 0;
+	bool ok = true;
+	for(;;)
+	{
+		bool producerDone = done.load();
+		uint32_t w[61];
+		auto bytes = ring.read(w, sizeof(w));
+		if(bytes % 4)
+		{
+			fprintf(stderr, "read %u bytes, not a whole word\n", bytes);
+			ok = false;
+			break;
+		}
+		for(unsigned i = 0; i < bytes / 4; i++)
+		{
+			if(w[i] <= last)
+			{
+				fprintf(stderr, "got %u after %u\n", w[i], last);
+				ok = false;
+			}
+			last = w[i];
+		}
+		if(!bytes)
+		{
+			if(producerDone)
+				break;
+			std::this_thread::yield();
+		}
+		if(discardEvery && ++reads % discardEvery == 0)
+			ring.discard();
+	}
+	producer.join();
+	if(!discardEvery && last != words + 96 - (words + 96) % 97)
+	{
+		fprintf(stderr, "stream ended at %u\n", last);
+		ok = false;
+	}
+	return ok;
+}
+
+int main()
+{
+	bool ok = true;
+	printf("%u byte ring, %zu MiB per run, best of %u:\n", ringSize, bytesPerRun / (1024 * 1024), runs);
+	for(unsigned chunk : {64u, 1470u, 4096u})
+	{
+		RingBuffer<> ring;
+		ring.init(ringSize);
+		ByteRingBuffer byteRing{ringSize};
+		bool match = true, byteMatch = true;
+		auto speed = bestMiBPerSec(ring, chunk, match);
+		auto byteSpeed = bestMiBPerSec(byteRing, chunk, byteMatch);
+		printf("%5uB chunks: %8.0f MiB/s vs %6.0f MiB/s byte ring (%.1fx)%s\n", chunk,
+			speed, byteSpeed, speed / byteSpeed, match && byteMatch ? "" : " MISMATCH");
+		ok &= match && byteMatch;
+	}
+	bool streamOk = streamThreaded(16 * 1024 * 1024, 0);
+	printf("threaded stream: %s\n", streamOk ? "ok" : "FAILED");
+	bool discardOk = streamThreaded(16 * 1024 * 1024, 1000);
+	printf("threaded stream with discard(): %s\n", discardOk ? "ok" : "FAILED");
+	return ok && streamOk && discardOk ? 0 : 1;
+}